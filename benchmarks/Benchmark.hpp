@@ -0,0 +1,53 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include <sys/resource.h>
+
+// Common utilities of the bcgen benchmarks
+namespace benchmark {
+    // Restarts the peak resident set size of the process, so that the next reading only covers what comes after
+    // > Linux only. If it is not supported, the peak of the whole process is read instead
+    inline void reset_peak_rss() {
+        std::ofstream clear_refs("/proc/self/clear_refs");
+        clear_refs << "5";
+    }
+
+    // Reads the peak resident set size of the process (kB)
+    inline uint64_t peak_rss_kb() {
+        std::ifstream status("/proc/self/status");
+        for (std::string line; std::getline(status, line);) {
+            if (line.rfind("VmHWM:", 0) == 0) {
+                return std::stoull(line.substr(6));
+            }
+        }
+
+        // Fallback - Peak of the whole process
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+    }
+
+    // Reads the current resident set size of the process (kB)
+    // > Linux only. If it is not supported, 0 is returned
+    inline uint64_t current_rss_kb() {
+        std::ifstream status("/proc/self/status");
+        for (std::string line; std::getline(status, line);) {
+            if (line.rfind("VmRSS:", 0) == 0) {
+                return std::stoull(line.substr(6));
+            }
+        }
+        return 0;
+    }
+
+    // Measures the wall time of a function (ms)
+    template <typename F>
+    double time_ms(F&& function) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
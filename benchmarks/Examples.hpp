@@ -0,0 +1,42 @@
+#pragma once
+
+#include <bcgen/CircuitGenerator.hpp>
+
+#include <addition64_circuit.hpp>
+#include <subtract64_circuit.hpp>
+#include <negation64_circuit.hpp>
+#include <signed_multiplication64_128_circuit.hpp>
+#include <unsigned_multiplication64_128_circuit.hpp>
+#include <signed_division64_circuit.hpp>
+#include <unsigned_division64_circuit.hpp>
+#include <zero_equality64_circuit.hpp>
+#include <aes128_ecb_encryption_circuit.hpp>
+#include <aes128_ecb_decryption_circuit.hpp>
+
+#include <string>
+#include <vector>
+
+// Example circuits of the project (examples directory)
+namespace examples {
+    // Example circuit and the name of its files
+    struct Example {
+        std::string name;
+        void (*circuit)(gabe::bcgen::CircuitGenerator* generator);
+    };
+
+    // All the example circuits
+    inline std::vector<Example> all() {
+        return {
+            { "Addition64", addition64::circuit },
+            { "Subtract64", subtract64::circuit },
+            { "Negation64", negation64::circuit },
+            { "SignedMultiplication64_128", signed_multiplication64_128::circuit },
+            { "UnsignedMultiplication64_128", unsigned_multiplication64_128::circuit },
+            { "SignedDivision64", signed_division64::circuit },
+            { "UnsignedDivision64", unsigned_division64::circuit },
+            { "ZeroEquality64", zero_equality64::circuit },
+            { "AES128_ECB_Encryption", aes128_ecb_encryption::circuit },
+            { "AES128_ECB_Decryption", aes128_ecb_decryption::circuit },
+        };
+    }
+}
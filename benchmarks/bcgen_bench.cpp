@@ -0,0 +1,769 @@
+#include <bcgen/CircuitGenerator.hpp>
+#include <bcgen/version.hpp>
+#include <fmt/format.h>
+
+#include <bit>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <filesystem>
+
+#include "Benchmark.hpp"
+#include "Examples.hpp"
+
+typedef gabe::bcgen::CircuitGenerator cGen;
+typedef gabe::bcgen::Variable Var;
+
+// Bristol generator that exposes its gates counters
+class BenchGenerator : public gabe::bcgen::BristolCircuitGenerator
+{
+public:
+    using BristolCircuitGenerator::BristolCircuitGenerator;
+
+    uint64_t gates() const { return _counter_gates; }
+    uint64_t and_gates() { return _gates_counters[_gates_map["and"]]; }
+
+    // Deepest wire of the whole circuit
+    gabe::bcgen::Depth max_depth() const {
+        gabe::bcgen::Depth result = { 0, 0 };
+        for (auto & depth : _wires_depths) {
+            result.depth = std::max(result.depth, depth.depth);
+            result.and_depth = std::max(result.and_depth, depth.and_depth);
+        }
+        return result;
+    }
+};
+
+// Benchmark of a primitive
+// > The primitive has two inputs with the benchmark width, and outputs with sizes given by the benchmark width
+struct Primitive {
+    std::string name;
+    std::function<std::vector<uint64_t>(uint64_t)> outputs;
+    std::function<void(cGen&, const Var&, const Var&, std::vector<Var>&)> operation;
+};
+
+// Measurements of a benchmark
+struct Result {
+    std::string name;
+    uint64_t width = 0;
+    uint64_t gates = 0;
+    uint64_t and_gates = 0;
+    uint64_t depth = 0;
+    uint64_t and_depth = 0;
+    double operation_ms = 0;
+    double total_ms = 0;
+    uint64_t peak_rss_kb = 0;
+    uint64_t comparators = 0;
+    uint64_t comparators_depth = 0;
+};
+
+static std::vector<Primitive> primitives() {
+    auto same = [](uint64_t width) { return std::vector<uint64_t>{ width }; };
+    auto twice = [](uint64_t width) { return std::vector<uint64_t>{ 2 * width }; };
+    auto pair = [](uint64_t width) { return std::vector<uint64_t>{ width, width }; };
+    auto bit = [](uint64_t) { return std::vector<uint64_t>{ 1 }; };
+    auto bits = [](uint64_t) { return std::vector<uint64_t>{ 1, 1, 1 }; };
+    auto count = [](uint64_t width) { uint64_t size = 1; while ((uint64_t(1) << size) <= width) size++; return std::vector<uint64_t>{ size }; };
+
+    return {
+        { "sum", same, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.sum(a, b, o[0]); } },
+        { "subtract", same, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.subtract(a, b, o[0]); } },
+        { "increment", same, [](cGen& g, const Var& a, const Var&, std::vector<Var>& o) { g.increment(a, o[0]); } },
+        { "decrement", same, [](cGen& g, const Var& a, const Var&, std::vector<Var>& o) { g.decrement(a, o[0]); } },
+        { "negate", same, [](cGen& g, const Var& a, const Var&, std::vector<Var>& o) { g.negate(a, o[0]); } },
+        { "multiply_u", twice, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.multiply_u(a, b, o[0]); } },
+        { "multiply_s", twice, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.multiply_s(a, b, o[0]); } },
+        { "divide_u", pair, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.divide_u(a, b, o[0], o[1]); } },
+        { "divide_u_quotient", same, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.divide_u_quotient(a, b, o[0]); } },
+        { "divide_u_remainder", same, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.divide_u_remainder(a, b, o[0]); } },
+        { "divide_s", pair, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.divide_s(a, b, o[0], o[1]); } },
+        { "divide_s_quotient", same, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.divide_s_quotient(a, b, o[0]); } },
+        { "divide_s_remainder", same, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.divide_s_remainder(a, b, o[0]); } },
+        { "popcount", count, [](cGen& g, const Var& a, const Var&, std::vector<Var>& o) { g.popcount(a, o[0]); } },
+        { "hamming_distance", count, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.hamming_distance(a, b, o[0]); } },
+        { "priority_encoder", same, [](cGen& g, const Var& a, const Var&, std::vector<Var>& o) { g.priority_encoder(a, o[0]); } },
+        { "clz", count, [](cGen& g, const Var& a, const Var&, std::vector<Var>& o) { g.clz(a, o[0]); } },
+        { "ctz", count, [](cGen& g, const Var& a, const Var&, std::vector<Var>& o) { g.ctz(a, o[0]); } },
+        { "ilog2", count, [](cGen& g, const Var& a, const Var&, std::vector<Var>& o) { g.ilog2(a, o[0]); } },
+        { "equal", bit, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.equal(a, b, o[0][0]); } },
+        { "greater_u", bit, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.greater_u(a, b, o[0][0]); } },
+        { "greater_s", bit, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.greater_s(a, b, o[0][0]); } },
+        { "smaller_u", bit, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.smaller_u(a, b, o[0][0]); } },
+        { "smaller_s", bit, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.smaller_s(a, b, o[0][0]); } },
+        { "greater_or_equal_u", bit, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.greater_or_equal_u(a, b, o[0][0]); } },
+        { "greater_or_equal_s", bit, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.greater_or_equal_s(a, b, o[0][0]); } },
+        { "smaller_or_equal_u", bit, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.smaller_or_equal_u(a, b, o[0][0]); } },
+        { "smaller_or_equal_s", bit, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.smaller_or_equal_s(a, b, o[0][0]); } },
+        { "comparator_u", bits, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.comparator_u(a, b, o[0][0], o[1][0], o[2][0]); } },
+        { "comparator_s", bits, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.comparator_s(a, b, o[0][0], o[1][0], o[2][0]); } },
+        { "multiplexer", same, [](cGen& g, const Var& a, const Var& b, std::vector<Var>& o) { g.multiplexer(a, b, a[0], o[0]); } },
+        { "shift_left", same, [](cGen& g, const Var& a, const Var&, std::vector<Var>& o) { g.shift_left(a, a.size() / 2, o[0]); } },
+        { "shift_right", same, [](cGen& g, const Var& a, const Var&, std::vector<Var>& o) { g.shift_right(a, a.size() / 2, o[0]); } },
+    };
+}
+
+static Result run_primitive(const Primitive& primitive, uint64_t width) {
+    Result result;
+    result.name = primitive.name;
+    result.width = width;
+
+    benchmark::reset_peak_rss();
+
+    result.total_ms = benchmark::time_ms([&]() {
+        BenchGenerator generator(fmt::format("{}_{}", primitive.name, width), "circuits/bench");
+        generator.limit_buffer(64 << 20);
+        generator.track_depth(true);
+
+        // Parties
+        const std::vector<uint64_t> outputs_sizes = primitive.outputs(width);
+        generator.add_input_party(width);
+        generator.add_input_party(width);
+        for (auto size : outputs_sizes) {
+            generator.add_output_party(size);
+        }
+
+        // Inputs and outputs
+        Var in_1(width), in_2(width);
+        generator.add_input(in_1);
+        generator.add_input(in_2);
+
+        std::vector<Var> outputs;
+        for (auto size : outputs_sizes) {
+            outputs.emplace_back(size);
+        }
+        for (auto & output : outputs) {
+            generator.add_output(output);
+        }
+
+        generator.start();
+
+        // Only the gates of the operation are accounted
+        const uint64_t gates = generator.gates();
+        const uint64_t and_gates = generator.and_gates();
+
+        result.operation_ms = benchmark::time_ms([&]() { primitive.operation(generator, in_1, in_2, outputs); });
+        result.gates = generator.gates() - gates;
+        result.and_gates = generator.and_gates() - and_gates;
+
+        for (auto & output : outputs) {
+            const gabe::bcgen::Depth depth = generator.depth(output);
+            result.depth = std::max(result.depth, depth.depth);
+            result.and_depth = std::max(result.and_depth, depth.and_depth);
+        }
+
+        generator.stop();
+    });
+
+    result.peak_rss_kb = benchmark::peak_rss_kb();
+    return result;
+}
+
+// Benchmark of a multi-operand operation
+// > The operation has a vector of inputs with the benchmark width, and an output wide enough for their sum
+struct MultiOperand {
+    std::string name;
+    uint64_t n_inputs;
+    std::function<void(cGen&, const std::vector<Var>&, Var&)> operation;
+};
+
+static std::vector<MultiOperand> multi_operands() {
+    // Chained operations, as done before the compressor trees
+    auto sum_chain = [](cGen& g, const std::vector<Var>& in, Var& o) {
+        g.sum(in[0], in[1], o);
+        for (uint64_t i = 2; i < in.size(); i++) g.sum(o, in[i], o);
+    };
+    auto inner_product_chain = [](cGen& g, const std::vector<Var>& in, Var& o) {
+        Var product(o.size());
+        g.multiply_u(in[0], in[1], o);
+        for (uint64_t i = 2; i < in.size(); i += 2) { g.multiply_u(in[i], in[i + 1], product); g.sum(o, product, o); }
+    };
+    auto split = [](const std::vector<Var>& in, uint64_t parity) {
+        std::vector<Var> result;
+        for (uint64_t i = parity; i < in.size(); i += 2) result.push_back(in[i]);
+        return result;
+    };
+
+    std::vector<MultiOperand> result;
+    for (uint64_t n_inputs : { 4, 16, 64 }) {
+        result.push_back({ fmt::format("sum_chain_{}", n_inputs), n_inputs, sum_chain });
+        result.push_back({ fmt::format("sum_many_{}", n_inputs), n_inputs, [](cGen& g, const std::vector<Var>& in, Var& o) { g.sum_many(in, o); } });
+        result.push_back({ fmt::format("inner_product_chain_{}", n_inputs / 2), n_inputs, inner_product_chain });
+        result.push_back({ fmt::format("inner_product_u_{}", n_inputs / 2), n_inputs, [=](cGen& g, const std::vector<Var>& in, Var& o) { g.inner_product_u(split(in, 0), split(in, 1), o); } });
+        result.push_back({ fmt::format("inner_product_s_{}", n_inputs / 2), n_inputs, [=](cGen& g, const std::vector<Var>& in, Var& o) { g.inner_product_s(split(in, 0), split(in, 1), o); } });
+    }
+    return result;
+}
+
+static Result run_multi_operand(const MultiOperand& multi_operand, uint64_t width) {
+    Result result;
+    result.name = multi_operand.name;
+    result.width = width;
+
+    benchmark::reset_peak_rss();
+
+    result.total_ms = benchmark::time_ms([&]() {
+        BenchGenerator generator(fmt::format("{}_{}", multi_operand.name, width), "circuits/bench");
+        generator.limit_buffer(64 << 20);
+        generator.track_depth(true);
+
+        // Parties
+        // > The output has room for the products and the carries of the sum
+        const uint64_t output_size = 2 * width + 6;
+        for (uint64_t i = 0; i < multi_operand.n_inputs; i++) {
+            generator.add_input_party(width);
+        }
+        generator.add_output_party(output_size);
+
+        // Inputs and outputs
+        std::vector<Var> inputs(multi_operand.n_inputs, Var(width));
+        for (auto & input : inputs) {
+            generator.add_input(input);
+        }
+
+        Var output(output_size);
+        generator.add_output(output);
+
+        generator.start();
+
+        // Only the gates of the operation are accounted
+        const uint64_t gates = generator.gates();
+        const uint64_t and_gates = generator.and_gates();
+
+        result.operation_ms = benchmark::time_ms([&]() { multi_operand.operation(generator, inputs, output); });
+        result.gates = generator.gates() - gates;
+        result.and_gates = generator.and_gates() - and_gates;
+
+        const gabe::bcgen::Depth depth = generator.depth(output);
+        result.depth = depth.depth;
+        result.and_depth = depth.and_depth;
+
+        generator.stop();
+    });
+
+    result.peak_rss_kb = benchmark::peak_rss_kb();
+    return result;
+}
+
+// Benchmark of a sorting algorithm
+// > The algorithm sorts a vector of keys with the benchmark width, and gives the comparators it uses
+struct Sorting {
+    std::string name;
+    uint64_t n_keys;
+    std::function<std::vector<gabe::bcgen::Comparator>(cGen&, std::vector<Var>&)> sort;
+};
+
+static std::vector<Sorting> sortings() {
+    using gabe::bcgen::SortingNetwork;
+
+    // Comparison of every pair with greater_u and two multiplexers, as done before the sorting networks
+    auto naive = [](cGen& g, std::vector<Var>& keys) {
+        std::vector<gabe::bcgen::Comparator> comparators;
+        for (uint64_t i = 0; i < keys.size(); i++) {
+            for (uint64_t j = i + 1; j < keys.size(); j++) {
+                Var min(keys[i].size()), max(keys[i].size());
+                Var swap(1);
+                g.greater_u(keys[i], keys[j], swap[0]);
+                g.multiplexer(keys[i], keys[j], swap[0], min);
+                g.multiplexer(keys[j], keys[i], swap[0], max);
+                keys[i] = min;
+                keys[j] = max;
+                comparators.push_back({ i, j });
+            }
+        }
+        return comparators;
+    };
+    auto network = [](SortingNetwork network) {
+        return [=](cGen& g, std::vector<Var>& keys) {
+            g.sort(keys, true, network);
+            return cGen::sorting_network(keys.size(), network);
+        };
+    };
+
+    std::vector<Sorting> result;
+    for (uint64_t n_keys : { 8, 32, 128 }) {
+        result.push_back({ fmt::format("sort_naive_{}", n_keys), n_keys, naive });
+        result.push_back({ fmt::format("sort_odd_even_merge_{}", n_keys), n_keys, network(SortingNetwork::OddEvenMerge) });
+        result.push_back({ fmt::format("sort_bitonic_{}", n_keys), n_keys, network(SortingNetwork::Bitonic) });
+    }
+    return result;
+}
+
+static Result run_sorting(const Sorting& sorting, uint64_t width) {
+    Result result;
+    result.name = sorting.name;
+    result.width = width;
+
+    benchmark::reset_peak_rss();
+
+    result.total_ms = benchmark::time_ms([&]() {
+        BenchGenerator generator(fmt::format("{}_{}", sorting.name, width), "circuits/bench");
+        generator.limit_buffer(64 << 20);
+        generator.track_depth(true);
+
+        // Parties
+        // > The keys are sorted in place, thus they are the outputs too
+        generator.add_input_party(sorting.n_keys * width);
+        generator.add_output_party(sorting.n_keys * width);
+
+        std::vector<Var> keys(sorting.n_keys, Var(width));
+        for (auto & key : keys) {
+            generator.add_input(key);
+        }
+        for (auto & key : keys) {
+            generator.add_output(key);
+        }
+
+        generator.start();
+
+        // Only the gates of the operation are accounted
+        const uint64_t gates = generator.gates();
+        const uint64_t and_gates = generator.and_gates();
+
+        std::vector<gabe::bcgen::Comparator> comparators;
+        result.operation_ms = benchmark::time_ms([&]() { comparators = sorting.sort(generator, keys); });
+        result.gates = generator.gates() - gates;
+        result.and_gates = generator.and_gates() - and_gates;
+
+        for (auto & key : keys) {
+            const gabe::bcgen::Depth depth = generator.depth(key);
+            result.depth = std::max(result.depth, depth.depth);
+            result.and_depth = std::max(result.and_depth, depth.and_depth);
+        }
+
+        // Comparators depth
+        // > A comparator is applied after the previous comparators of both its positions
+        std::vector<uint64_t> levels(sorting.n_keys, 0);
+        for (auto & comparator : comparators) {
+            const uint64_t level = std::max(levels[comparator.low], levels[comparator.high]) + 1;
+            levels[comparator.low] = levels[comparator.high] = level;
+            result.comparators_depth = std::max(result.comparators_depth, level);
+        }
+        result.comparators = comparators.size();
+
+        generator.stop();
+    });
+
+    result.peak_rss_kb = benchmark::peak_rss_kb();
+    return result;
+}
+
+// Benchmark of the permutation network
+// > The switches of the network are reported as its comparators
+static Result run_permutation(uint64_t n_keys, uint64_t width) {
+    Result result;
+    result.name = fmt::format("permute_waksman_{}", n_keys);
+    result.width = width;
+
+    const std::vector<gabe::bcgen::Comparator> switches = cGen::permutation_network(n_keys);
+
+    benchmark::reset_peak_rss();
+
+    result.total_ms = benchmark::time_ms([&]() {
+        BenchGenerator generator(fmt::format("{}_{}", result.name, width), "circuits/bench");
+        generator.limit_buffer(64 << 20);
+        generator.track_depth(true);
+
+        // Parties
+        // > The keys are permuted in place, thus they are the outputs too
+        generator.add_input_party(n_keys * width);
+        generator.add_input_party(switches.size());
+        generator.add_output_party(n_keys * width);
+
+        std::vector<Var> keys(n_keys, Var(width));
+        Var control(switches.size());
+        for (auto & key : keys) {
+            generator.add_input(key);
+        }
+        generator.add_input(control);
+        for (auto & key : keys) {
+            generator.add_output(key);
+        }
+
+        generator.start();
+
+        // Only the gates of the operation are accounted
+        const uint64_t gates = generator.gates();
+        const uint64_t and_gates = generator.and_gates();
+
+        result.operation_ms = benchmark::time_ms([&]() { generator.permute(keys, control); });
+        result.gates = generator.gates() - gates;
+        result.and_gates = generator.and_gates() - and_gates;
+
+        for (auto & key : keys) {
+            const gabe::bcgen::Depth depth = generator.depth(key);
+            result.depth = std::max(result.depth, depth.depth);
+            result.and_depth = std::max(result.and_depth, depth.and_depth);
+        }
+
+        // Switches depth
+        std::vector<uint64_t> levels(n_keys, 0);
+        for (auto & comparator : switches) {
+            const uint64_t level = std::max(levels[comparator.low], levels[comparator.high]) + 1;
+            levels[comparator.low] = levels[comparator.high] = level;
+            result.comparators_depth = std::max(result.comparators_depth, level);
+        }
+        result.comparators = switches.size();
+
+        generator.stop();
+    });
+
+    result.peak_rss_kb = benchmark::peak_rss_kb();
+    return result;
+}
+
+// Benchmark of an array access
+// > The access reads or writes an element of the benchmark width at a secret index, and the array and the element are both
+// inputs and outputs of the circuit
+struct ArrayAccess {
+    std::string name;
+    uint64_t n_elements;
+    std::function<void(cGen&, std::vector<Var>&, const Var&, Var&)> access;
+};
+
+static std::vector<ArrayAccess> array_accesses() {
+    // Comparison of the index with every position, as done before the decoder
+    auto naive_read = [](cGen& g, std::vector<Var>& array, const Var& index, Var& value) {
+        g.assign_value(value, 0);
+        for (uint64_t i = 0; i < array.size(); i++) {
+            Var position(index.size()), control(1);
+            g.assign_value(position, i);
+            g.equal(index, position, control[0]);
+            g.multiplexer(value, array[i], control[0], value);
+        }
+    };
+    auto naive_write = [](cGen& g, std::vector<Var>& array, const Var& index, Var& value) {
+        for (uint64_t i = 0; i < array.size(); i++) {
+            Var position(index.size()), control(1);
+            g.assign_value(position, i);
+            g.equal(index, position, control[0]);
+            g.multiplexer(array[i], value, control[0], array[i]);
+        }
+    };
+    auto read = [](cGen& g, std::vector<Var>& array, const Var& index, Var& value) { g.array_read(array, index, value); };
+    auto write = [](cGen& g, std::vector<Var>& array, const Var& index, Var& value) { g.array_write(array, index, value); };
+
+    std::vector<ArrayAccess> result;
+    for (uint64_t n_elements = 16; n_elements <= 4096; n_elements *= 4) {
+        result.push_back({ fmt::format("array_read_naive_{}", n_elements), n_elements, naive_read });
+        result.push_back({ fmt::format("array_read_{}", n_elements), n_elements, read });
+        result.push_back({ fmt::format("array_write_naive_{}", n_elements), n_elements, naive_write });
+        result.push_back({ fmt::format("array_write_{}", n_elements), n_elements, write });
+    }
+    return result;
+}
+
+static Result run_array_access(const ArrayAccess& array_access, uint64_t width) {
+    Result result;
+    result.name = array_access.name;
+    result.width = width;
+
+    benchmark::reset_peak_rss();
+
+    result.total_ms = benchmark::time_ms([&]() {
+        BenchGenerator generator(fmt::format("{}_{}", array_access.name, width), "circuits/bench");
+        generator.limit_buffer(64 << 20);
+        generator.track_depth(true);
+
+        // Parties
+        // > The index has the bits of the array positions
+        const uint64_t index_size = std::bit_width(array_access.n_elements - 1);
+        generator.add_input_party(array_access.n_elements * width);
+        generator.add_input_party(index_size + width);
+        generator.add_output_party(array_access.n_elements * width);
+        generator.add_output_party(width);
+
+        std::vector<Var> array(array_access.n_elements, Var(width));
+        Var index(index_size), value(width);
+        for (auto & element : array) {
+            generator.add_input(element);
+        }
+        generator.add_input(index);
+        generator.add_input(value);
+        for (auto & element : array) {
+            generator.add_output(element);
+        }
+        generator.add_output(value);
+
+        generator.start();
+
+        // Only the gates of the operation are accounted
+        const uint64_t gates = generator.gates();
+        const uint64_t and_gates = generator.and_gates();
+
+        result.operation_ms = benchmark::time_ms([&]() { array_access.access(generator, array, index, value); });
+        result.gates = generator.gates() - gates;
+        result.and_gates = generator.and_gates() - and_gates;
+
+        const gabe::bcgen::Depth depth = generator.max_depth();
+        result.depth = depth.depth;
+        result.and_depth = depth.and_depth;
+
+        generator.stop();
+    });
+
+    result.peak_rss_kb = benchmark::peak_rss_kb();
+    return result;
+}
+
+// Benchmark of a fixed point operation
+// > The operation has two inputs and an output in the same Q format, given by its integer and fraction bits
+struct FixedOperation {
+    std::string name;
+    std::function<void(cGen&, const gabe::bcgen::FixedPoint&, const gabe::bcgen::FixedPoint&, gabe::bcgen::FixedPoint&)> operation;
+};
+
+static std::vector<FixedOperation> fixed_operations() {
+    using gabe::bcgen::FixedPoint;
+    using gabe::bcgen::Rounding;
+
+    // Hand-rolled integer code, as done before the fixed point operations
+    // > The full product is shifted, rounded by adding half of the last bit, and saturated with two comparisons
+    auto hand_multiply = [](bool round, bool saturate) {
+        return [=](cGen& g, const FixedPoint& a, const FixedPoint& b, FixedPoint& out) {
+            Var product(2 * a.size());
+            g.multiply_s(a, b, product);
+            if (round) {
+                Var half(2 * a.size());
+                g.assign_value(half, uint64_t(1) << (a.fraction_bits() - 1));
+                g.sum(product, half, product);
+            }
+
+            Var shifted(2 * a.size());
+            g.shift_right(product, a.fraction_bits(), shifted);
+            for (uint64_t i = a.size() - a.fraction_bits(); i < shifted.size(); i++) {
+                shifted[i] = product[shifted.size() - 1];
+            }
+
+            if (!saturate) {
+                out = shifted.slice(0, out.size());
+                return;
+            }
+
+            Var max(out.size()), min(out.size());
+            g.assign_value(max, (uint64_t(1) << (out.size() - 1)) - 1);
+            g.assign_value(min, uint64_t(1) << (out.size() - 1));
+            Var greater(1), smaller(1), result(out.size());
+            g.greater_s(shifted, max, greater[0]);
+            g.smaller_s(shifted, min, smaller[0]);
+            g.multiplexer(shifted.slice(0, out.size()), max, greater[0], result);
+            g.multiplexer(result, min, smaller[0], result);
+            out = result;
+        };
+    };
+    auto hand_divide = [](cGen& g, const FixedPoint& a, const FixedPoint& b, FixedPoint& out) {
+        Var dividend(2 * a.size()), divisor(2 * a.size()), quotient(2 * a.size());
+        for (uint64_t i = 0; i < dividend.size(); i++) {
+            dividend[i] = i < a.size() ? a[i] : a[a.size() - 1];
+            divisor[i] = i < b.size() ? b[i] : b[b.size() - 1];
+        }
+        g.shift_left(dividend, a.fraction_bits());
+        g.divide_s_quotient(dividend, divisor, quotient);
+        out = quotient.slice(0, out.size());
+    };
+
+    return {
+        { "multiply_hand", hand_multiply(false, false) },
+        { "multiply", [](cGen& g, const FixedPoint& a, const FixedPoint& b, FixedPoint& out) { g.multiply_fixed(a, b, out); } },
+        { "multiply_nearest_hand", hand_multiply(true, false) },
+        { "multiply_nearest", [](cGen& g, const FixedPoint& a, const FixedPoint& b, FixedPoint& out) { g.multiply_fixed(a, b, out, Rounding::Nearest); } },
+        { "multiply_saturate_hand", hand_multiply(false, true) },
+        { "multiply_saturate", [](cGen& g, const FixedPoint& a, const FixedPoint& b, FixedPoint& out) { g.multiply_fixed(a, b, out, Rounding::Truncate, true); } },
+        { "divide_hand", hand_divide },
+        { "divide", [](cGen& g, const FixedPoint& a, const FixedPoint& b, FixedPoint& out) { g.divide_fixed(a, b, out); } },
+    };
+}
+
+static Result run_fixed_operation(const FixedOperation& fixed_operation, uint64_t width) {
+    Result result;
+    result.name = fmt::format("fixed_{}_q{}_{}", fixed_operation.name, width / 2, width / 2);
+    result.width = width;
+
+    benchmark::reset_peak_rss();
+
+    result.total_ms = benchmark::time_ms([&]() {
+        BenchGenerator generator(fmt::format("{}_{}", result.name, width), "circuits/bench");
+        generator.limit_buffer(64 << 20);
+        generator.track_depth(true);
+
+        // Parties
+        generator.add_input_party(width);
+        generator.add_input_party(width);
+        generator.add_output_party(width);
+
+        gabe::bcgen::FixedPoint a(width / 2, width / 2), b(width / 2, width / 2), out(width / 2, width / 2);
+        generator.add_input(a);
+        generator.add_input(b);
+        generator.add_output(out);
+
+        generator.start();
+
+        // Only the gates of the operation are accounted
+        const uint64_t gates = generator.gates();
+        const uint64_t and_gates = generator.and_gates();
+
+        result.operation_ms = benchmark::time_ms([&]() { fixed_operation.operation(generator, a, b, out); });
+        result.gates = generator.gates() - gates;
+        result.and_gates = generator.and_gates() - and_gates;
+
+        const gabe::bcgen::Depth depth = generator.depth(out);
+        result.depth = depth.depth;
+        result.and_depth = depth.and_depth;
+
+        generator.stop();
+    });
+
+    result.peak_rss_kb = benchmark::peak_rss_kb();
+    return result;
+}
+
+static Result run_aes() {
+    Result result;
+    result.name = "aes128_ecb_encryption";
+    result.width = 128;
+
+    benchmark::reset_peak_rss();
+
+    result.total_ms = benchmark::time_ms([&]() {
+        BenchGenerator generator("AES128_ECB_Encryption", "circuits/bench");
+        generator.limit_buffer(64 << 20);
+        generator.track_depth(true);
+
+        examples::aes128_ecb_encryption::circuit(&generator);
+
+        result.gates = generator.gates();
+        result.and_gates = generator.and_gates();
+
+        const gabe::bcgen::Depth depth = generator.max_depth();
+        result.depth = depth.depth;
+        result.and_depth = depth.and_depth;
+    });
+
+    result.operation_ms = result.total_ms;
+    result.peak_rss_kb = benchmark::peak_rss_kb();
+    return result;
+}
+
+int main(int argc, char* argv[]) {
+    // Arguments
+    // > --output <path>: JSON results file (default: bcgen_bench.json)
+    // > --max-width <width>: Biggest width to benchmark (default: 2048)
+    // > --filter <text>: Only benchmarks whose name contains the text
+    std::string output_path = "bcgen_bench.json";
+    uint64_t max_width = 2048;
+    std::string filter;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string option = argv[i];
+        if (option == "--output") output_path = argv[i + 1];
+        else if (option == "--max-width") max_width = std::stoull(argv[i + 1]);
+        else if (option == "--filter") filter = argv[i + 1];
+    }
+
+    std::filesystem::create_directories("circuits/bench");
+
+    // Runs all the benchmarks
+    std::vector<Result> results;
+    for (auto & primitive : primitives()) {
+        if (primitive.name.find(filter) == std::string::npos) continue;
+
+        for (uint64_t width = 8; width <= max_width; width *= 2) {
+            results.push_back(run_primitive(primitive, width));
+            fprintf(stderr, "%-20s %6lu bits: %12lu gates %10.1f ms\n", primitive.name.c_str(), width, results.back().gates, results.back().total_ms);
+        }
+    }
+
+    // > The multi-operand operations are compared with the chained operations up to 256 bits
+    for (auto & multi_operand : multi_operands()) {
+        if (multi_operand.name.find(filter) == std::string::npos) continue;
+
+        for (uint64_t width = 8; width <= std::min<uint64_t>(max_width, 256); width *= 2) {
+            results.push_back(run_multi_operand(multi_operand, width));
+            fprintf(stderr, "%-20s %6lu bits: %12lu gates %10lu AND %6lu AND depth\n",
+                multi_operand.name.c_str(), width, results.back().gates, results.back().and_gates, results.back().and_depth
+            );
+        }
+    }
+
+    // > The sorting networks are compared with the comparison of every pair up to 64 bits keys
+    for (auto & sorting : sortings()) {
+        if (sorting.name.find(filter) == std::string::npos) continue;
+
+        for (uint64_t width = 8; width <= std::min<uint64_t>(max_width, 64); width *= 2) {
+            results.push_back(run_sorting(sorting, width));
+            fprintf(stderr, "%-20s %6lu bits: %12lu gates %10lu AND %6lu comparators %4lu comparators depth\n",
+                sorting.name.c_str(), width, results.back().gates, results.back().and_gates, results.back().comparators, results.back().comparators_depth
+            );
+        }
+    }
+
+    // > The permutation network is measured with the same keys as the sorting networks
+    for (uint64_t n_keys : { 8, 32, 128 }) {
+        if (fmt::format("permute_waksman_{}", n_keys).find(filter) == std::string::npos) continue;
+
+        for (uint64_t width = 8; width <= std::min<uint64_t>(max_width, 64); width *= 2) {
+            results.push_back(run_permutation(n_keys, width));
+            fprintf(stderr, "%-20s %6lu bits: %12lu gates %10lu AND %6lu switches %4lu switches depth\n",
+                results.back().name.c_str(), width, results.back().gates, results.back().and_gates, results.back().comparators, results.back().comparators_depth
+            );
+        }
+    }
+
+    // > The array accesses are compared with the comparison of the index with every position up to 64 bits elements
+    for (auto & array_access : array_accesses()) {
+        if (array_access.name.find(filter) == std::string::npos) continue;
+
+        for (uint64_t width = 8; width <= std::min<uint64_t>(max_width, 64); width *= 2) {
+            results.push_back(run_array_access(array_access, width));
+            fprintf(stderr, "%-20s %6lu bits: %12lu gates %10lu AND %6lu AND depth\n",
+                array_access.name.c_str(), width, results.back().gates, results.back().and_gates, results.back().and_depth
+            );
+        }
+    }
+
+    // > The fixed point operations are compared with the hand-rolled integer code in the Q8.8, Q16.16 and Q32.32 formats
+    for (auto & fixed_operation : fixed_operations()) {
+        for (uint64_t width = 16; width <= std::min<uint64_t>(max_width, 64); width *= 2) {
+            if (fmt::format("fixed_{}_q{}_{}", fixed_operation.name, width / 2, width / 2).find(filter) == std::string::npos) continue;
+
+            results.push_back(run_fixed_operation(fixed_operation, width));
+            fprintf(stderr, "%-20s %6lu bits: %12lu gates %10lu AND %6lu AND depth\n",
+                results.back().name.c_str(), width, results.back().gates, results.back().and_gates, results.back().and_depth
+            );
+        }
+    }
+
+    if (std::string("aes128_ecb_encryption").find(filter) != std::string::npos) {
+        results.push_back(run_aes());
+        fprintf(stderr, "%-20s %6lu bits: %12lu gates %10.1f ms\n", "aes128", 128UL, results.back().gates, results.back().total_ms);
+    }
+
+    // Results
+    std::vector<std::string> entries;
+    for (auto & result : results) {
+        entries.push_back(fmt::format(
+            "    {{\"name\": \"{}\", \"width\": {}, \"gates\": {}, \"and_gates\": {}, \"depth\": {}, \"and_depth\": {}, "
+            "\"operation_ms\": {:.3f}, \"total_ms\": {:.3f}, \"peak_rss_kb\": {}}}",
+            result.name, result.width, result.gates, result.and_gates, result.depth, result.and_depth,
+            result.operation_ms, result.total_ms, result.peak_rss_kb
+        ));
+
+        // Only the sorting and permutation benchmarks have comparators
+        if (result.comparators) {
+            entries.back().insert(entries.back().size() - 1, fmt::format(", \"comparators\": {}, \"comparators_depth\": {}", result.comparators, result.comparators_depth));
+        }
+    }
+
+    const std::string json = fmt::format(
+        "{{\n  \"version\": \"{}\",\n  \"benchmarks\": [\n{}\n  ]\n}}\n", gabe::bcgen::get_version(), fmt::join(entries, ",\n")
+    );
+
+    std::ofstream output(output_path, std::ios::out | std::ios::trunc);
+    output.write(json.c_str(), json.size());
+
+    fprintf(stderr, "Results written to %s\n", output_path.c_str());
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+#include <bcgen/CircuitGenerator.hpp>
+#include <bcgen/CircuitTester.hpp>
+#include <bcgen/version.hpp>
+#include <fmt/format.h>
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <fstream>
+#include <algorithm>
+#include <functional>
+#include <filesystem>
+
+#include "Benchmark.hpp"
+#include "Examples.hpp"
+
+namespace format = gabe::bcgen::binary_format;
+
+// Directory of the benchmarked circuits
+static const std::string circuits_directory = "circuits/bench/eval";
+
+// Tester that exposes the size of the opened circuit
+template <typename Tester>
+class BenchTester : public Tester
+{
+public:
+    uint64_t gates() const { return this->_counter_gates; }
+    uint64_t input_wires() const { return std::accumulate(this->_input_parties.begin(), this->_input_parties.end(), uint64_t(0)); }
+};
+
+// Circuit format benchmarked
+// > Every format generates the example circuits, which are then opened with the tester of the format
+struct Format {
+    std::string name;
+    std::string prefix;
+    std::string extension;
+    std::function<void(const examples::Example&)> generate;
+};
+
+// Measurements of a benchmark
+struct Result {
+    std::string circuit;
+    std::string format;
+    uint64_t file_size = 0;
+    uint64_t gates = 0;
+    double parse_ms = 0;
+    double single_gates_per_s = 0;
+    double batch_gates_per_s = 0;
+    uint64_t rss_kb = 0;
+    uint64_t peak_rss_kb = 0;
+};
+
+// Options of the benchmark
+struct Options {
+    std::string output = "bcgen_eval_bench.json";
+    std::string filter;
+    uint64_t repeats = 3;
+    uint64_t min_time_ms = 200;
+    uint64_t threads = 1;
+};
+
+// Runs a function until the minimum time elapses, and returns the amount of runs per second
+template <typename F>
+static double runs_per_s(uint64_t min_time_ms, F&& function) {
+    uint64_t runs = 0;
+    double elapsed_ms = 0;
+    while (elapsed_ms < min_time_ms || runs == 0) {
+        elapsed_ms += benchmark::time_ms(function);
+        runs++;
+    }
+    return runs * 1000.0 / elapsed_ms;
+}
+
+template <typename Tester>
+static Result run_tester(const std::string& circuit, const Options& options) {
+    Result result;
+    std::mt19937_64 random(0xBC6E);
+
+    // Parsing
+    // > The best of the repetitions is kept, and the memory is measured on the last one
+    result.parse_ms = std::numeric_limits<double>::max();
+    std::unique_ptr<BenchTester<Tester>> tester;
+    for (uint64_t i = 0; i < options.repeats; i++) {
+        tester.reset();
+
+        benchmark::reset_peak_rss();
+        const uint64_t rss_before = benchmark::current_rss_kb();
+
+        tester = std::make_unique<BenchTester<Tester>>();
+        tester->verbose(false);
+        tester->threads(options.threads);
+        result.parse_ms = std::min(result.parse_ms, benchmark::time_ms([&]() { tester->open(circuit, circuits_directory); }));
+
+        const uint64_t rss_after = benchmark::current_rss_kb();
+        result.rss_kb = rss_after > rss_before ? rss_after - rss_before : 0;
+        result.peak_rss_kb = benchmark::peak_rss_kb();
+    }
+    result.gates = tester->gates();
+
+    // Single instance evaluation
+    std::vector<uint8_t> inputs(tester->input_wires());
+    for (auto & input : inputs) {
+        input = random() & 0x01;
+    }
+    result.single_gates_per_s = result.gates * runs_per_s(options.min_time_ms, [&]() { tester->evaluate(inputs); });
+
+    // Batched evaluation
+    // > Each run evaluates 64 instances of the circuit
+    std::vector<uint64_t> batch_inputs(tester->input_wires());
+    for (auto & input : batch_inputs) {
+        input = random();
+    }
+    result.batch_gates_per_s = 64 * result.gates * runs_per_s(options.min_time_ms, [&]() { tester->evaluate_batch(batch_inputs); });
+
+    return result;
+}
+
+static std::vector<Format> formats() {
+    using namespace gabe::bcgen;
+
+    return {
+        {
+            "bristol", "bristol_", ".txt",
+            [](const examples::Example& example) { BristolCircuitGenerator generator(example.name, circuits_directory); example.circuit(&generator); }
+        },
+        {
+            "bristol_fashion", "bristol_fashion_", ".txt",
+            [](const examples::Example& example) { BristolFashionCircuitGenerator generator(example.name, circuits_directory); example.circuit(&generator); }
+        },
+        {
+            "libscapi", "libscapi_", ".txt",
+            [](const examples::Example& example) { LibscapiCircuitGenerator generator(example.name, circuits_directory); example.circuit(&generator); }
+        },
+        {
+            "binary_fixed", "binary_fixed_", ".bcg",
+            [](const examples::Example& example) { BinaryCircuitGenerator generator("fixed_" + example.name, circuits_directory, format::Layout::Fixed); example.circuit(&generator); }
+        },
+        {
+            "binary_varint", "binary_", ".bcg",
+            [](const examples::Example& example) { BinaryCircuitGenerator generator(example.name, circuits_directory, format::Layout::Varint); example.circuit(&generator); }
+        },
+    };
+}
+
+static Result run_format(const std::string& format, const std::string& circuit, const Options& options) {
+    using namespace gabe::bcgen;
+
+    if (format == "bristol") return run_tester<BristolCircuitTester>(circuit, options);
+    if (format == "bristol_fashion") return run_tester<BristolFashionCircuitTester>(circuit, options);
+    if (format == "libscapi") return run_tester<LibscapiCircuitTester>(circuit, options);
+    return run_tester<BinaryCircuitTester>(circuit, options);
+}
+
+int main(int argc, char* argv[]) {
+    // Arguments
+    // > --output <path>: JSON results file (default: bcgen_eval_bench.json)
+    // > --filter <text>: Only circuits whose name contains the text
+    // > --repeats <count>: Repetitions of the circuit parsing (default: 3)
+    // > --min-time <ms>: Minimum time of each evaluation measurement (default: 200)
+    // > --threads <count>: Threads used by the testers (default: 1)
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string option = argv[i];
+        if (option == "--output") options.output = argv[i + 1];
+        else if (option == "--filter") options.filter = argv[i + 1];
+        else if (option == "--repeats") options.repeats = std::max<uint64_t>(1, std::stoull(argv[i + 1]));
+        else if (option == "--min-time") options.min_time_ms = std::stoull(argv[i + 1]);
+        else if (option == "--threads") options.threads = std::stoull(argv[i + 1]);
+    }
+
+    std::filesystem::create_directories(circuits_directory);
+
+    std::vector<Result> results;
+    for (auto & example : examples::all()) {
+        if (example.name.find(options.filter) == std::string::npos) continue;
+
+        for (auto & format : formats()) {
+            // Generates the circuit in the format
+            format.generate(example);
+
+            const std::string circuit = format.prefix + example.name;
+            Result result = run_format(format.name, circuit, options);
+            result.circuit = example.name;
+            result.format = format.name;
+            result.file_size = std::filesystem::file_size(std::filesystem::path(circuits_directory) / (circuit + format.extension));
+            results.push_back(result);
+
+            fprintf(stderr, "%-30s %-16s parse %10.2f ms | single %8.1f Mgates/s | batch %8.1f Mgates/s\n",
+                example.name.c_str(), format.name.c_str(), result.parse_ms, result.single_gates_per_s / 1e6, result.batch_gates_per_s / 1e6
+            );
+        }
+    }
+
+    // Results
+    std::vector<std::string> entries;
+    for (auto & result : results) {
+        entries.push_back(fmt::format(
+            "    {{\"circuit\": \"{}\", \"format\": \"{}\", \"file_size\": {}, \"gates\": {}, \"parse_ms\": {:.3f}, "
+            "\"single_gates_per_s\": {:.0f}, \"batch_gates_per_s\": {:.0f}, \"rss_kb\": {}, \"peak_rss_kb\": {}}}",
+            result.circuit, result.format, result.file_size, result.gates, result.parse_ms,
+            result.single_gates_per_s, result.batch_gates_per_s, result.rss_kb, result.peak_rss_kb
+        ));
+    }
+
+    const std::string json = fmt::format(
+        "{{\n  \"version\": \"{}\",\n  \"threads\": {},\n  \"benchmarks\": [\n{}\n  ]\n}}\n",
+        gabe::bcgen::get_version(), options.threads, fmt::join(entries, ",\n")
+    );
+
+    std::ofstream output(options.output, std::ios::out | std::ios::trunc);
+    output.write(json.c_str(), json.size());
+
+    fprintf(stderr, "Results written to %s\n", options.output.c_str());
+
+    return 0;
+}
@@ -1,391 +1,9 @@
-#include <bcgen/CircuitGenerator.hpp>
-#include <cmath>
-#include <fmt/format.h>
+#include "aes128_ecb_decryption_circuit.hpp"
 
-typedef gabe::bcgen::CircuitGenerator cGen;
 typedef gabe::bcgen::BristolCircuitGenerator bGen;
 typedef gabe::bcgen::LibscapiCircuitGenerator lGen;
 
-typedef gabe::bcgen::Wire Wire;
-typedef gabe::bcgen::Variable Var;
-
-// The number of columns comprising a state in AES. This is a constant in AES.
-#define Nb 4
-// The number of 32 bit words in a key.
-#define Nk 4
-// Key length in bytes [128 bit]
-#define KEYLEN 16
-// The number of rounds in AES Cipher.
-#define Nr 10
-
-#define PARTY1_SIZE (KEYLEN * 8)
-#define PARTY2_SIZE (KEYLEN * 8)
-#define OUTPUT_SIZE (KEYLEN * 8)
-
-const uint8_t sbox[256] = {
-    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
-    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
-    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
-    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
-    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
-    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
-    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
-    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
-    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
-    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
-    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
-    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
-    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
-    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
-    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
-    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
-};
-
-const uint8_t rsbox[256] = {
-    0x52, 0x09, 0x6a, 0xd5, 0x30, 0x36, 0xa5, 0x38, 0xbf, 0x40, 0xa3, 0x9e, 0x81, 0xf3, 0xd7, 0xfb,
-    0x7c, 0xe3, 0x39, 0x82, 0x9b, 0x2f, 0xff, 0x87, 0x34, 0x8e, 0x43, 0x44, 0xc4, 0xde, 0xe9, 0xcb,
-    0x54, 0x7b, 0x94, 0x32, 0xa6, 0xc2, 0x23, 0x3d, 0xee, 0x4c, 0x95, 0x0b, 0x42, 0xfa, 0xc3, 0x4e,
-    0x08, 0x2e, 0xa1, 0x66, 0x28, 0xd9, 0x24, 0xb2, 0x76, 0x5b, 0xa2, 0x49, 0x6d, 0x8b, 0xd1, 0x25,
-    0x72, 0xf8, 0xf6, 0x64, 0x86, 0x68, 0x98, 0x16, 0xd4, 0xa4, 0x5c, 0xcc, 0x5d, 0x65, 0xb6, 0x92,
-    0x6c, 0x70, 0x48, 0x50, 0xfd, 0xed, 0xb9, 0xda, 0x5e, 0x15, 0x46, 0x57, 0xa7, 0x8d, 0x9d, 0x84,
-    0x90, 0xd8, 0xab, 0x00, 0x8c, 0xbc, 0xd3, 0x0a, 0xf7, 0xe4, 0x58, 0x05, 0xb8, 0xb3, 0x45, 0x06,
-    0xd0, 0x2c, 0x1e, 0x8f, 0xca, 0x3f, 0x0f, 0x02, 0xc1, 0xaf, 0xbd, 0x03, 0x01, 0x13, 0x8a, 0x6b,
-    0x3a, 0x91, 0x11, 0x41, 0x4f, 0x67, 0xdc, 0xea, 0x97, 0xf2, 0xcf, 0xce, 0xf0, 0xb4, 0xe6, 0x73,
-    0x96, 0xac, 0x74, 0x22, 0xe7, 0xad, 0x35, 0x85, 0xe2, 0xf9, 0x37, 0xe8, 0x1c, 0x75, 0xdf, 0x6e,
-    0x47, 0xf1, 0x1a, 0x71, 0x1d, 0x29, 0xc5, 0x89, 0x6f, 0xb7, 0x62, 0x0e, 0xaa, 0x18, 0xbe, 0x1b,
-    0xfc, 0x56, 0x3e, 0x4b, 0xc6, 0xd2, 0x79, 0x20, 0x9a, 0xdb, 0xc0, 0xfe, 0x78, 0xcd, 0x5a, 0xf4,
-    0x1f, 0xdd, 0xa8, 0x33, 0x88, 0x07, 0xc7, 0x31, 0xb1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xec, 0x5f,
-    0x60, 0x51, 0x7f, 0xa9, 0x19, 0xb5, 0x4a, 0x0d, 0x2d, 0xe5, 0x7a, 0x9f, 0x93, 0xc9, 0x9c, 0xef,
-    0xa0, 0xe0, 0x3b, 0x4d, 0xae, 0x2a, 0xf5, 0xb0, 0xc8, 0xeb, 0xbb, 0x3c, 0x83, 0x53, 0x99, 0x61,
-    0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0c, 0x7d
-};
-
-const uint8_t rcon[11] = { 0x8d, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36 };
-
-Var get_sbox_value(cGen* generator, Var& index) {
-    Var output(8); generator->assign_value(output, 0x00);
-
-    for (uint64_t i = 0; i < 256; i++) {
-        Wire control;
-        Var cur_index(8); generator->assign_value(cur_index, i);
-        Var cur_sbox_value(8); generator->assign_value(cur_sbox_value, sbox[i] );
-
-        generator->equal( index, cur_index, control );
-        generator->multiplexer( output, cur_sbox_value, control, output );
-    }
-
-    return output;
-}
-
-Var get_rsbox_value(cGen* generator, Var& index) {
-    Var output(8); generator->assign_value(output, 0x00);
-
-    for (uint64_t i = 0; i < 256; i++) {
-        Wire control;
-
-        Var cur_index(8); generator->assign_value(cur_index, i);
-        Var cur_sbox_value(8); generator->assign_value(cur_sbox_value, rsbox[i] );
-
-        generator->equal( index, cur_index, control );
-        generator->multiplexer( output, cur_sbox_value, control, output );
-    }
-
-    return output;
-}
-
-void add_round_key(cGen* generator, uint64_t round, std::vector<Var>& round_key, std::vector<std::vector<Var>>& state) {
-    for (int i = 0; i < 4; i++) {
-        for (int j = 0; j < 4; j++) {
-            generator->XOR( state[i][j], round_key[round * Nb * 4 + i * Nb + j], state[i][j] );
-        }
-    }
-}
-
-void inv_sub_bytes(cGen* generator, std::vector<std::vector<Var>>& state) {
-    for(uint8_t i = 0; i < 4; i++) {
-        for(uint8_t j = 0; j < 4; j++) {
-            state[j][i] = get_rsbox_value( generator, state[j][i] );
-        }
-    }
-}
-
-void inv_shift_rows(std::vector<std::vector<Var>>& state)
-{
-    Var temp(8);
-
-    // Rotate first row 1 columns to right  
-    temp        = state[3][1];
-    state[3][1] = state[2][1];
-    state[2][1] = state[1][1];
-    state[1][1] = state[0][1];
-    state[0][1] = temp;
-
-    // Rotate second row 2 columns to right 
-    temp        = state[0][2];
-    state[0][2] = state[2][2];
-    state[2][2] = temp;
-
-    temp        = state[1][2];
-    state[1][2] = state[3][2];
-    state[3][2] = temp;
-
-    // Rotate third row 3 columns to right
-    temp        = state[0][3];
-    state[0][3] = state[1][3];
-    state[1][3] = state[2][3];
-    state[2][3] = state[3][3];
-    state[3][3] = temp;
-}
-
-Var x_time(cGen* generator, Var& value) {
-    Var value1(8); generator->assign_value(value1, 0x00);
-    for (int i = 1; i < 8; i++) { value1[i] = value[i-1]; }
-
-    Var hex_0x1b(8); generator->assign_value(hex_0x1b, 0x1b);
-
-    Var value2(8); generator->assign_value(value2, 0x00);
-    value2[0] = value[7];
-
-    Var mult_16(16);
-    generator->multiply_u( value2, hex_0x1b, mult_16 );
-
-    Var mult_8(8);
-    for (int i = 0; i < 8; i++) { mult_8[i] = mult_16[i]; }
-
-    generator->XOR( value1, mult_8, value1 );
-
-    return value1;
-}
-
-Var multiply(cGen* generator, Var x, Var y) {
-    /*
-    Multiply(x, y)                                \
-        (  ((y & 1) * x) ^                              \
-        ((y>>1 & 1) * xtime(x)) ^                       \
-        ((y>>2 & 1) * xtime(xtime(x))) ^                \
-        ((y>>3 & 1) * xtime(xtime(xtime(x)))) ^         \
-        ((y>>4 & 1) * xtime(xtime(xtime(xtime(x))))))
-    */
-
-    Var y_shift1(8);
-    Var y_shift2(8);
-    Var y_shift3(8);
-    Var y_shift4(8);
-
-    Var mult_16_0(16);
-    Var mult_16_1(16);
-    Var mult_16_2(16);
-    Var mult_16_3(16);
-    Var mult_16_4(16);
-
-    Var mult_8_0(8);
-    Var mult_8_1(8);
-    Var mult_8_2(8);
-    Var mult_8_3(8);
-    Var mult_8_4(8);
-
-    // Shifting
-    generator->shift_left(y, 1, y_shift1);
-    generator->shift_left(y, 2, y_shift2);
-    generator->shift_left(y, 3, y_shift3);
-    generator->shift_left(y, 4, y_shift4);
-
-    // 
-    Var c_0x01(8); generator->assign_value( c_0x01 , 0x01 );
-
-    generator->AND( y, c_0x01, y );
-    generator->AND( y_shift1, c_0x01, y_shift1 );
-    generator->AND( y_shift2, c_0x01, y_shift2 );
-    generator->AND( y_shift3, c_0x01, y_shift3 );
-    generator->AND( y_shift4, c_0x01, y_shift4 );
-
-    //
-
-    Var x_1 = x_time(generator, x);
-    Var x_2 = x_time(generator, x_1);
-    Var x_3 = x_time(generator, x_2);
-    Var x_4 = x_time(generator, x_3);
-
-    //
-
-    generator->multiply_u( y, x, mult_16_0 );
-    generator->multiply_u( y_shift1, x_1, mult_16_1 );
-    generator->multiply_u( y_shift2, x_2, mult_16_2 );
-    generator->multiply_u( y_shift3, x_3, mult_16_3 );
-    generator->multiply_u( y_shift4, x_4, mult_16_4 );
-
-    for (int i = 0; i < 8; i++) {
-        mult_8_0[i] = mult_16_0[i];
-        mult_8_1[i] = mult_16_1[i];
-        mult_8_2[i] = mult_16_2[i];
-        mult_8_3[i] = mult_16_3[i];
-        mult_8_4[i] = mult_16_4[i];
-    }
-
-    // Final phase
-
-    Var output(8);
-
-    generator->XOR(mult_8_0, mult_8_1, output);
-    generator->XOR(output, mult_8_2, output);
-    generator->XOR(output, mult_8_3, output);
-    generator->XOR(output, mult_8_4, output);
-
-    return output;
-}
-
-void inv_mix_columns(cGen* generator, std::vector<std::vector<Var>>& state)
-{
-    // Needed constants
-    Var c1(8); generator->assign_value( c1, 0x0e );
-    Var c2(8); generator->assign_value( c2, 0x0b );
-    Var c3(8); generator->assign_value( c3, 0x0d );
-    Var c4(8); generator->assign_value( c4, 0x09 );
-
-    for (int i = 0; i < 4; i++)
-    { 
-        Var a_0_0 = multiply(generator, state[i][0], c1);
-        Var a_0_1 = multiply(generator, state[i][1], c2);
-        Var a_0_2 = multiply(generator, state[i][2], c3);
-        Var a_0_3 = multiply(generator, state[i][3], c4);
-
-        Var a_1_0 = multiply(generator, state[i][0], c4);
-        Var a_1_1 = multiply(generator, state[i][1], c1);
-        Var a_1_2 = multiply(generator, state[i][2], c2);
-        Var a_1_3 = multiply(generator, state[i][3], c3);
-
-        Var a_2_0 = multiply(generator, state[i][0], c3);
-        Var a_2_1 = multiply(generator, state[i][1], c4);
-        Var a_2_2 = multiply(generator, state[i][2], c1);
-        Var a_2_3 = multiply(generator, state[i][3], c2);
-
-        Var a_3_0 = multiply(generator, state[i][0], c2);
-        Var a_3_1 = multiply(generator, state[i][1], c3);
-        Var a_3_2 = multiply(generator, state[i][2], c4);
-        Var a_3_3 = multiply(generator, state[i][3], c1);
-
-        generator->XOR(a_0_0, a_0_1, state[i][0]);
-        generator->XOR(state[i][0], a_0_2, state[i][0]);
-        generator->XOR(state[i][0], a_0_3, state[i][0]);
-
-        generator->XOR(a_1_0, a_1_1, state[i][1]);
-        generator->XOR(state[i][1], a_1_2, state[i][1]);
-        generator->XOR(state[i][1], a_1_3, state[i][1]);
-
-        generator->XOR(a_2_0, a_2_1, state[i][2]);
-        generator->XOR(state[i][2], a_2_2, state[i][2]);
-        generator->XOR(state[i][2], a_2_3, state[i][2]);
-
-        generator->XOR(a_3_0, a_3_1, state[i][3]);
-        generator->XOR(state[i][3], a_3_2, state[i][3]);
-        generator->XOR(state[i][3], a_3_3, state[i][3]);
-    }
-}
-
-void key_expansion(cGen* generator, std::vector<Var>& key, std::vector<Var>& round_key) {
-    // First round key is the key itself
-    for (int i = 0; i < Nb; i++) {
-        round_key[(i * 4) + 0] = key[(i * 4) + 0];
-        round_key[(i * 4) + 1] = key[(i * 4) + 1];
-        round_key[(i * 4) + 2] = key[(i * 4) + 2];
-        round_key[(i * 4) + 3] = key[(i * 4) + 3];
-    }
-
-    // Used for column/row operations
-    std::vector<Var> temp( Nk, Var(8) );
-
-    // The other round keys are found from the previous keys
-    for (int i = 4; i < (Nb * (Nr + 1)); i++) {
-        for (int j = 0; j < 4; j++) { temp[j] = round_key[ (i - 1) * 4 + j ]; }
-
-        if (i % Nk == 0) {
-            // Rotates word
-            Var k = temp[0];
-            temp[0] = temp[1];
-            temp[1] = temp[2];
-            temp[2] = temp[3];
-            temp[3] = k;
-
-            // Sub word
-            temp[0] = get_sbox_value(generator, temp[0]);
-            temp[1] = get_sbox_value(generator, temp[1]);
-            temp[2] = get_sbox_value(generator, temp[2]);
-            temp[3] = get_sbox_value(generator, temp[3]);
-
-            Var rcon_value(8); generator->assign_value(rcon_value, rcon[i/Nk]);
-
-            generator->XOR( temp[0], rcon_value, temp[0] );
-        }
-        else if (Nk > 6 && i % Nk == 4) {
-            // Sub word
-            temp[0] = get_sbox_value(generator, temp[0]);
-            temp[1] = get_sbox_value(generator, temp[1]);
-            temp[2] = get_sbox_value(generator, temp[2]);
-            temp[3] = get_sbox_value(generator, temp[3]);
-        }
-
-        generator->XOR( round_key[(i - Nk) * 4 + 0] , temp[0], round_key[i * 4 + 0] );
-        generator->XOR( round_key[(i - Nk) * 4 + 1] , temp[1], round_key[i * 4 + 1] );
-        generator->XOR( round_key[(i - Nk) * 4 + 2] , temp[2], round_key[i * 4 + 2] );
-        generator->XOR( round_key[(i - Nk) * 4 + 3] , temp[3], round_key[i * 4 + 3] );
-    }
-}
-
-void decrypt(cGen* generator, std::vector<Var>& round_key, std::vector<std::vector<Var>>& state) {
-    add_round_key(generator, Nr, round_key, state);
-
-    for (uint8_t round = Nr - 1; round >= 1; round--) {
-        inv_shift_rows(state);
-        inv_sub_bytes(generator, state);
-        add_round_key(generator, round, round_key, state);
-        inv_mix_columns(generator, state);
-    }
-
-    inv_shift_rows(state);
-    inv_sub_bytes(generator, state);
-    add_round_key(generator, 0, round_key, state);
-}
-
-void circuit(cGen* generator) {
-    // Parties
-    generator->add_input_party(PARTY1_SIZE);
-    generator->add_input_party(PARTY2_SIZE);
-    generator->add_output_party(OUTPUT_SIZE);
-
-    // Inputs
-    std::vector<Var> key ( KEYLEN, Var(8) );
-    std::vector<std::vector<Var>> plain_cipher ( Nb, std::vector<Var>(Nb, Var(8)) );
-    
-    for (auto & byte : key) {
-        generator->add_input(byte);
-    }
-
-    for (auto & row : plain_cipher) {
-        for (auto & byte : row) {
-            generator->add_input(byte);
-        }
-    }
-
-    // Outputs
-    for (auto & row : plain_cipher) {
-        for (auto & byte : row) {
-            generator->add_output(byte);
-        }
-    }
-
-    // Other variables
-    std::vector<Var> round_key( KEYLEN*(Nr+1), Var(8) );
-
-    // Start the circuit writting
-    generator->start();
-
-    // Function / Algorithm
-    key_expansion(generator, key, round_key);
-    decrypt(generator, round_key, plain_cipher);
-
-    // Stops the circuit writting
-    generator->stop();
-}
+using examples::aes128_ecb_decryption::circuit;
 
 int main(int argc, char* argv[]) {
     bGen bgen( "AES128_ECB_Decryption", "circuits/examples" ); circuit( &bgen );
@@ -0,0 +1,278 @@
+#include "aes128_ecb_encryption_circuit.hpp"
+#include <cmath>
+#include <fmt/format.h>
+
+typedef gabe::bcgen::CircuitGenerator cGen;
+typedef gabe::bcgen::Wire Wire;
+typedef gabe::bcgen::Variable Var;
+
+namespace examples::aes128_ecb_encryption {
+
+// The number of columns comprising a state in AES. This is a constant in AES.
+#define Nb 4
+// The number of 32 bit words in a key.
+#define Nk 4
+// Key length in bytes [128 bit]
+#define KEYLEN 16
+// The number of rounds in AES Cipher.
+#define Nr 10
+
+#define PARTY1_SIZE (KEYLEN * 8)
+#define PARTY2_SIZE (KEYLEN * 8)
+#define OUTPUT_SIZE (KEYLEN * 8)
+
+const uint8_t sbox[256] = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
+};
+
+const uint8_t rcon[255] = {
+    0x8d, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36, 0x6c, 0xd8, 0xab, 0x4d, 0x9a, 
+    0x2f, 0x5e, 0xbc, 0x63, 0xc6, 0x97, 0x35, 0x6a, 0xd4, 0xb3, 0x7d, 0xfa, 0xef, 0xc5, 0x91, 0x39, 
+    0x72, 0xe4, 0xd3, 0xbd, 0x61, 0xc2, 0x9f, 0x25, 0x4a, 0x94, 0x33, 0x66, 0xcc, 0x83, 0x1d, 0x3a, 
+    0x74, 0xe8, 0xcb, 0x8d, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36, 0x6c, 0xd8, 
+    0xab, 0x4d, 0x9a, 0x2f, 0x5e, 0xbc, 0x63, 0xc6, 0x97, 0x35, 0x6a, 0xd4, 0xb3, 0x7d, 0xfa, 0xef, 
+    0xc5, 0x91, 0x39, 0x72, 0xe4, 0xd3, 0xbd, 0x61, 0xc2, 0x9f, 0x25, 0x4a, 0x94, 0x33, 0x66, 0xcc, 
+    0x83, 0x1d, 0x3a, 0x74, 0xe8, 0xcb, 0x8d, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 
+    0x36, 0x6c, 0xd8, 0xab, 0x4d, 0x9a, 0x2f, 0x5e, 0xbc, 0x63, 0xc6, 0x97, 0x35, 0x6a, 0xd4, 0xb3, 
+    0x7d, 0xfa, 0xef, 0xc5, 0x91, 0x39, 0x72, 0xe4, 0xd3, 0xbd, 0x61, 0xc2, 0x9f, 0x25, 0x4a, 0x94, 
+    0x33, 0x66, 0xcc, 0x83, 0x1d, 0x3a, 0x74, 0xe8, 0xcb, 0x8d, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 
+    0x40, 0x80, 0x1b, 0x36, 0x6c, 0xd8, 0xab, 0x4d, 0x9a, 0x2f, 0x5e, 0xbc, 0x63, 0xc6, 0x97, 0x35, 
+    0x6a, 0xd4, 0xb3, 0x7d, 0xfa, 0xef, 0xc5, 0x91, 0x39, 0x72, 0xe4, 0xd3, 0xbd, 0x61, 0xc2, 0x9f, 
+    0x25, 0x4a, 0x94, 0x33, 0x66, 0xcc, 0x83, 0x1d, 0x3a, 0x74, 0xe8, 0xcb, 0x8d, 0x01, 0x02, 0x04, 
+    0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36, 0x6c, 0xd8, 0xab, 0x4d, 0x9a, 0x2f, 0x5e, 0xbc, 0x63, 
+    0xc6, 0x97, 0x35, 0x6a, 0xd4, 0xb3, 0x7d, 0xfa, 0xef, 0xc5, 0x91, 0x39, 0x72, 0xe4, 0xd3, 0xbd, 
+    0x61, 0xc2, 0x9f, 0x25, 0x4a, 0x94, 0x33, 0x66, 0xcc, 0x83, 0x1d, 0x3a, 0x74, 0xe8, 0xcb 
+};
+
+Var get_sbox_value(cGen* generator, Var& index) {
+    // The box is a lookup table of constants, thus only the decoder of the index has AND gates
+    std::vector<Var> box( 256, Var(8) );
+    for (uint64_t i = 0; i < 256; i++) {
+        generator->assign_value(box[i], sbox[i]);
+    }
+
+    Var output(8);
+    generator->array_read(box, index, output);
+
+    return output;
+}
+
+void add_round_key(cGen* generator, uint64_t round, std::vector<Var>& round_key, std::vector<std::vector<Var>>& state) {
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            generator->XOR( state[i][j], round_key[round * Nb * 4 + i * Nb + j], state[i][j] );
+        }
+    }
+}
+
+void sub_bytes(cGen* generator, std::vector<std::vector<Var>>& state) {
+    for(uint8_t i = 0; i < 4; i++) {
+        for(uint8_t j = 0; j < 4; j++) {
+            state[j][i] = get_sbox_value( generator, state[j][i] );
+        }
+    }
+}
+
+void shift_rows(std::vector<std::vector<Var>>& state)
+{
+    Var temp(8);
+
+    // Rotate first row 1 columns to left  
+    temp        = state[0][1];
+    state[0][1] = state[1][1];
+    state[1][1] = state[2][1];
+    state[2][1] = state[3][1];
+    state[3][1] = temp;
+
+    // Rotate second row 2 columns to left  
+    temp        = state[0][2];
+    state[0][2] = state[2][2];
+    state[2][2] = temp;
+
+    temp        = state[1][2];
+    state[1][2] = state[3][2];
+    state[3][2] = temp;
+
+    // Rotate third row 3 columns to left
+    temp        = state[0][3];
+    state[0][3] = state[3][3];
+    state[3][3] = state[2][3];
+    state[2][3] = state[1][3];
+    state[1][3] = temp;
+}
+
+Var x_time(cGen* generator, Var& value) {
+    Var value1(8); generator->assign_value(value1, 0x00);
+    value1.slice(1, 7) = value.slice(0, 7);
+
+    Var hex_0x1b(8); generator->assign_value(hex_0x1b, 0x1b);
+
+    Var value2(8); generator->assign_value(value2, 0x00);
+    value2[0] = value[7];
+
+    Var mult_16(16);
+    generator->multiply_u( value2, hex_0x1b, mult_16 );
+
+    generator->XOR( value1, mult_16.slice(0, 8), value1 );
+
+    return value1;
+}
+
+void mix_columns(cGen* generator, std::vector<std::vector<Var>>& state) {
+    Var tmp(8), tm(8), t(8);
+
+    for(uint8_t i = 0; i < 4; i++) {  
+        t   = state[i][0];
+
+        //tmp = state[i][0] ^ state[i][1] ^ state[i][2] ^ state[i][3] ;
+        generator->XOR( state[i][0], state[i][1], tmp );
+        generator->XOR( tmp, state[i][2], tmp );
+        generator->XOR( tmp, state[i][3], tmp );
+
+        //tm  = state[i][0] ^ state[i][1] ; tm = xtime(tm);  state[i][0] ^= tm ^ tmp ;
+        generator->XOR( state[i][0], state[i][1], tm );
+        tm = x_time(generator, tm);
+        generator->XOR( state[i][0], tm, state[i][0] );
+        generator->XOR( state[i][0], tmp, state[i][0] );
+
+        //tm  = state[i][1] ^ state[i][2] ; tm = xtime(tm);  state[i][1] ^= tm ^ tmp ;
+        generator->XOR( state[i][1], state[i][2], tm );
+        tm = x_time(generator, tm);
+        generator->XOR( state[i][1], tm, state[i][1] );
+        generator->XOR( state[i][1], tmp, state[i][1] );
+
+        //tm  = state[i][2] ^ state[i][3] ; tm = xtime(tm);  state[i][2] ^= tm ^ tmp ;
+        generator->XOR( state[i][2], state[i][3], tm );
+        tm = x_time(generator, tm);
+        generator->XOR( state[i][2], tm, state[i][2] );
+        generator->XOR( state[i][2], tmp, state[i][2] );
+
+        //tm  = state[i][3] ^ t ;           tm = xtime(tm);  state[i][3] ^= tm ^ tmp ;
+        generator->XOR( state[i][3], t, tm );
+        tm = x_time(generator, tm);
+        generator->XOR( state[i][3], tm, state[i][3] );
+        generator->XOR( state[i][3], tmp, state[i][3] );
+    }
+}
+
+void key_expansion(cGen* generator, std::vector<Var>& key, std::vector<Var>& round_key) {
+    // First round key is the key itself
+    for (int i = 0; i < Nb; i++) {
+        round_key[(i * 4) + 0] = key[(i * 4) + 0];
+        round_key[(i * 4) + 1] = key[(i * 4) + 1];
+        round_key[(i * 4) + 2] = key[(i * 4) + 2];
+        round_key[(i * 4) + 3] = key[(i * 4) + 3];
+    }
+
+    // Used for column/row operations
+    std::vector<Var> temp( Nk, Var(8) );
+
+    // The other round keys are found from the previous keys
+    for (int i = 4; i < (Nb * (Nr + 1)); i++) {
+        for (int j = 0; j < 4; j++) { temp[j] = round_key[ (i - 1) * 4 + j ]; }
+
+        if (i % Nk == 0) {
+            // Rotates word
+            Var k = temp[0];
+            temp[0] = temp[1];
+            temp[1] = temp[2];
+            temp[2] = temp[3];
+            temp[3] = k;
+
+            // Sub word
+            temp[0] = get_sbox_value(generator, temp[0]);
+            temp[1] = get_sbox_value(generator, temp[1]);
+            temp[2] = get_sbox_value(generator, temp[2]);
+            temp[3] = get_sbox_value(generator, temp[3]);
+
+            Var rcon_value(8); generator->assign_value(rcon_value, rcon[i/Nk]);
+
+            generator->XOR( temp[0], rcon_value, temp[0] );
+        }
+        else if (Nk > 6 && i % Nk == 4) {
+            // Sub word
+            temp[0] = get_sbox_value(generator, temp[0]);
+            temp[1] = get_sbox_value(generator, temp[1]);
+            temp[2] = get_sbox_value(generator, temp[2]);
+            temp[3] = get_sbox_value(generator, temp[3]);
+        }
+
+        generator->XOR( round_key[(i - Nk) * 4 + 0] , temp[0], round_key[i * 4 + 0] );
+        generator->XOR( round_key[(i - Nk) * 4 + 1] , temp[1], round_key[i * 4 + 1] );
+        generator->XOR( round_key[(i - Nk) * 4 + 2] , temp[2], round_key[i * 4 + 2] );
+        generator->XOR( round_key[(i - Nk) * 4 + 3] , temp[3], round_key[i * 4 + 3] );
+    }
+}
+
+void encrypt(cGen* generator, std::vector<Var>& round_key, std::vector<std::vector<Var>>& state) {
+    add_round_key(generator, 0, round_key, state);
+
+    for (uint8_t round = 1; round < Nr; round++) {
+        sub_bytes(generator, state);
+        shift_rows(state);
+        mix_columns(generator, state);
+        add_round_key(generator, round, round_key, state);
+    }
+
+    sub_bytes(generator, state);
+    shift_rows(state);
+    add_round_key(generator, Nr, round_key, state);
+}
+
+void circuit(cGen* generator) {
+    // Parties
+    generator->add_input_party(PARTY1_SIZE);
+    generator->add_input_party(PARTY2_SIZE);
+    generator->add_output_party(OUTPUT_SIZE);
+
+    // Inputs
+    std::vector<Var> key ( KEYLEN, Var(8) );
+    std::vector<std::vector<Var>> plain_cipher ( Nb, std::vector<Var>(Nb, Var(8)) );
+    
+    for (auto & byte : key) {
+        generator->add_input(byte);
+    }
+
+    for (auto & row : plain_cipher) {
+        for (auto & byte : row) {
+            generator->add_input(byte);
+        }
+    }
+
+    // Outputs
+    for (auto & row : plain_cipher) {
+        for (auto & byte : row) {
+            generator->add_output(byte);
+        }
+    }
+
+    // Other variables
+    std::vector<Var> round_key( KEYLEN*(Nr+1), Var(8) );
+
+    // Start the circuit writting
+    generator->start();
+
+    // Function / Algorithm
+    key_expansion(generator, key, round_key);
+    encrypt(generator, round_key, plain_cipher);
+
+    // Stops the circuit writting
+    generator->stop();
+}
+
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <bcgen/CircuitGenerator.hpp>
+
+// Circuit of the aes128_ecb_encryption example
+// > It is shared by the example program and the benchmarks
+namespace examples::aes128_ecb_encryption {
+    void circuit(gabe::bcgen::CircuitGenerator* generator);
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <bcgen/CircuitGenerator.hpp>
+
+// Circuit of the signed_division64 example
+// > It is shared by the example program and the benchmarks
+namespace examples::signed_division64 {
+    void circuit(gabe::bcgen::CircuitGenerator* generator);
+}
@@ -0,0 +1,39 @@
+#include "signed_multiplication64_128_circuit.hpp"
+
+typedef gabe::bcgen::CircuitGenerator cGen;
+typedef gabe::bcgen::Wire Wire;
+typedef gabe::bcgen::Variable Var;
+
+namespace examples::signed_multiplication64_128 {
+
+#define PARTY1_SIZE 64
+#define PARTY2_SIZE 64
+#define OUTPUT_SIZE 128
+
+void circuit(cGen* generator) {
+    // Parties
+    generator->add_input_party(PARTY1_SIZE);
+    generator->add_input_party(PARTY2_SIZE);
+    generator->add_output_party(OUTPUT_SIZE);
+
+    // Inputs
+    Var in_1(PARTY1_SIZE);
+    Var in_2(PARTY2_SIZE);
+    generator->add_input(in_1);
+    generator->add_input(in_2);
+
+    // Outputs
+    Var out(OUTPUT_SIZE);
+    generator->add_output(out);
+
+    // Start the circuit writting
+    generator->start();
+
+    // Function / Algorithm
+    generator->multiply_s(in_1, in_2, out);
+
+    // Stops the circuit writting
+    generator->stop();
+}
+
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <bcgen/CircuitGenerator.hpp>
+
+// Circuit of the signed_multiplication64_128 example
+// > It is shared by the example program and the benchmarks
+namespace examples::signed_multiplication64_128 {
+    void circuit(gabe::bcgen::CircuitGenerator* generator);
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <bcgen/CircuitGenerator.hpp>
+
+// Circuit of the subtract64 example
+// > It is shared by the example program and the benchmarks
+namespace examples::subtract64 {
+    void circuit(gabe::bcgen::CircuitGenerator* generator);
+}
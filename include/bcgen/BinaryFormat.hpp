@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace gabe {
+    namespace bcgen {
+        /**
+         * @brief Definitions of the BCGen binary circuit format (.bcg).
+         *
+         * -----
+         *
+         * A binary circuit file has three sections, all of them encoded in little-endian:
+         *
+         * ```
+         * +--------------------------------------------------------------------------------+
+         * + Header (48 bytes + 8 bytes per party)                                          +
+         * +   magic "BCG\0" | version (16) | layout (8) | flags (8)                        +
+         * +   gates (64) | wires (64) | gates section size in bytes (64)                   +
+         * +   checksum block size (32) | input parties (32) | output parties (32) | 0 (32) +
+         * +   input parties sizes (64 each) | output parties sizes (64 each)               +
+         * + Gates section                                                                  +
+         * +   One record per gate, encoded with the file layout                            +
+         * + Checksums section (only if the checksums flag is set)                          +
+         * +   One 32 bits FNV-1a checksum per block of the gates section                   +
+         * +--------------------------------------------------------------------------------+
+         * ```
+         *
+         * The gates section always starts at a multiple of 8 bytes, thus a fixed layout file can be memory mapped and its
+         * records accessed directly.
+        **/
+        namespace binary_format {
+            /** @brief Layout of the gates records. **/
+            enum class Layout : uint8_t {
+                /**
+                 * Every gate is a record of 4 32 bits values: input wire A, input wire B, output wire and operation.
+                 * Gates with a single input wire repeat it in both input labels.
+                **/
+                Fixed = 0,
+
+                /**
+                 * Every gate is a sequence of variable length integers (LEB128) of zigzag encoded label differences:
+                 * 1. (output - previous output - 1) shifted left by 2, with the operation in the 2 least significant bits;
+                 * 2. output - input wire A;
+                 * 3. output - input wire B (only for gates with two input wires).
+                **/
+                Varint = 1
+            };
+
+            /** @brief Operation codes of the gates. **/
+            enum Operation : uint8_t {
+                XOR = 0, /**<Exclusive OR between two wires.*/
+                AND = 1, /**<AND between two wires.*/
+                OR  = 2, /**<OR between two wires.*/
+                INV = 3  /**<Negation of a single wire.*/
+            };
+
+            constexpr char magic[4] = { 'B', 'C', 'G', '\0' }; /**<First bytes of every binary circuit file.*/
+            constexpr uint16_t version = 1; /**<Current version of the format.*/
+            constexpr uint8_t flag_checksums = 0x01; /**<Flag set when the file has a checksums section.*/
+            constexpr uint32_t checksum_block_size = 1 << 16; /**<Size of the gates section blocks covered by a checksum.*/
+            constexpr uint64_t header_size = 48; /**<Size of the header without the parties sizes.*/
+
+            /**
+             * @brief Appends an unsigned integer, in little-endian, to a string.
+             * @param output String to append to.
+             * @param value Value to append.
+             * @param size Number of bytes to append.
+            **/
+            inline void append_uint(std::string& output, uint64_t value, uint64_t size) {
+                for (uint64_t i = 0; i < size; i++) {
+                    output.push_back(static_cast<char>(value >> (8 * i)));
+                }
+            }
+
+            /**
+             * @brief Reads an unsigned integer, in little-endian, from a buffer.
+             * @param input Buffer to read from.
+             * @param size Number of bytes to read.
+             * @return Read value.
+            **/
+            inline uint64_t read_uint(const char* input, uint64_t size) {
+                uint64_t value = 0;
+                for (uint64_t i = 0; i < size; i++) {
+                    value |= uint64_t(static_cast<uint8_t>(input[i])) << (8 * i);
+                }
+                return value;
+            }
+
+            /**
+             * @brief Appends a variable length integer (LEB128) to a string.
+             * @param output String to append to.
+             * @param value Value to append.
+            **/
+            inline void append_varint(std::string& output, uint64_t value) {
+                while (value >= 0x80) {
+                    output.push_back(static_cast<char>(value | 0x80));
+                    value >>= 7;
+                }
+                output.push_back(static_cast<char>(value));
+            }
+
+            /**
+             * @brief Reads a variable length integer (LEB128) from a buffer.
+             * @param cursor Buffer position to read from. Updated to the position after the integer.
+             * @param end End of the buffer.
+             * @return Read value.
+            **/
+            inline uint64_t read_varint(const char*& cursor, const char* end) {
+                uint64_t value = 0;
+                for (uint64_t shift = 0; cursor < end && shift < 64; shift += 7) {
+                    const uint8_t byte = static_cast<uint8_t>(*cursor++);
+                    value |= uint64_t(byte & 0x7F) << shift;
+                    if (!(byte & 0x80)) break;
+                }
+                return value;
+            }
+
+            /**
+             * @brief Zigzag encoding of a label difference, so that small negative differences are small integers as well.
+             * @param value Label difference.
+             * @return Encoded value.
+            **/
+            inline uint64_t zigzag_encode(int64_t value) {
+                return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+            }
+
+            /**
+             * @brief Zigzag decoding of a label difference.
+             * @param value Encoded value.
+             * @return Label difference.
+            **/
+            inline int64_t zigzag_decode(uint64_t value) {
+                return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 0x01);
+            }
+
+            /**
+             * @brief Updates a 32 bits FNV-1a checksum with more data.
+             * @param checksum Current checksum value.
+             * @param data Data to add to the checksum.
+             * @param size Size of the data.
+             * @return Updated checksum.
+            **/
+            inline uint32_t checksum_update(uint32_t checksum, const char* data, uint64_t size) {
+                for (uint64_t i = 0; i < size; i++) {
+                    checksum = (checksum ^ static_cast<uint8_t>(data[i])) * 16777619u;
+                }
+                return checksum;
+            }
+
+            constexpr uint32_t checksum_seed = 2166136261u; /**<Initial value of every block checksum.*/
+        }
+    }
+}
@@ -1,40 +1,175 @@
 #pragma once
 
+#include <map>
 #include <numeric>
 #include <cstdint>
 #include <string>
 #include <memory>
 #include <vector>
 #include <fstream>
+#include <iterator>
 #include <filesystem>
 #include <unordered_map>
 
+#include <bcgen/BinaryFormat.hpp>
+#include <bcgen/Label.hpp>
+
 namespace gabe {
     namespace bcgen {
         /** @brief Wire structure. **/
         struct Wire {
-            uint64_t label = 0; /**<Wire label.*/
+            label_t label = 0; /**<Wire label.*/
+        };
+
+        /**
+         * @brief Depth of a wire.
+         * 
+         * -----
+         * 
+         * The depth of a wire is the length of the longest path of gates between the circuit inputs and the wire. The AND depth
+         * (multiplicative depth) only counts the AND gates of the path, which is what defines the number of communication
+         * rounds of most multiparty computation protocols (e.g. GMW), and the bootstrapping schedule of homomorphic schemes.
+         * 
+         * @note Constant wires (zero and one wires) have a depth of 0.
+        **/
+        struct Depth {
+            uint64_t depth = 0; /**<Longest path of gates of the wire.*/
+            uint64_t and_depth = 0; /**<Maximum amount of AND gates in a path of the wire.*/
+        };
+
+        /**
+         * @brief Reuse distance of the wires of a circuit.
+         * 
+         * -----
+         * 
+         * The reuse distance of a wire read is the number of gates between the gate that writes the wire and the gate that reads
+         * it. Evaluators keep the recently written wires in cache, thus shorter distances mean less cache misses. Reads of the
+         * circuit input wires and of the constant wires (zero and one wires) are not accounted.
+        **/
+        struct ReuseDistance {
+            double mean = 0; /**<Mean reuse distance of all the wires reads.*/
+            uint64_t max = 0; /**<Longest reuse distance of a wire read.*/
         };
 
+        /** @brief Reuse distances of a circuit before and after its gates are scheduled. **/
+        struct ScheduleReport {
+            ReuseDistance before; /**<Reuse distance with the gates in the order they were written.*/
+            ReuseDistance after; /**<Reuse distance with the scheduled gates.*/
+        };
+
+        /** @brief Topology of a sorting network (see CircuitGenerator::sort). **/
+        enum class SortingNetwork : uint8_t {
+            /**
+             * Batcher odd-even merge sort: sorted halves are merged by merging their even and odd positions recursively. It has
+             * the least comparators of both topologies (19 for 8 variables).
+            **/
+            OddEvenMerge = 0,
+
+            /**
+             * Bitonic sort: sorted halves in opposite orders (a bitonic sequence) are merged by comparing the variables at the same
+             * position of both halves recursively. It has more comparators (24 for 8 variables), but every stage compares
+             * positions at the same distance.
+            **/
+            Bitonic = 1
+        };
+
+        /** @brief Comparator of a sorting network, which places the smallest of two variables at the lowest position. **/
+        struct Comparator {
+            uint64_t low; /**<Lowest position, which receives the smallest variable.*/
+            uint64_t high; /**<Highest position, which receives the biggest variable.*/
+        };
+
+        /** @brief Rounding of the fraction bits dropped by a fixed point operation (see FixedPoint). **/
+        enum class Rounding : uint8_t {
+            /** Truncation of the dropped bits, which rounds towards minus infinity. It does not have any gates. **/
+            Truncate = 0,
+
+            /** Rounding to the nearest value, with ties rounded up (towards plus infinity). **/
+            Nearest = 1,
+
+            /** Rounding to the nearest value, with ties rounded to the even value (unbiased). **/
+            NearestEven = 2
+        };
+
+        class VariableView;
+
         /**
          * @brief Variable class.
          * 
          * -----
          * 
-         * This class has a vector that contains wires. The less the index in the vector, the least significant the wire is.
+         * This class has a list that contains wires. The less the index in the list, the least significant the wire is.
+         * 
+         * Variables are created constantly by the library operations (temporary values, carries, partial products, ...),
+         * and most of them are small. Thus, the wires of variables with up to inline_size wires are stored inside the object
+         * itself (small buffer optimization), and only bigger variables allocate their wires, in a single allocation.
+         * 
+         * A variable can also be a view of the wires of another variable (see VariableView), in which case it does not own
+         * its wires, and its wires can be spaced by a stride (e.g, a stride of -1 for the bit-reversal of a variable).
          * 
          * @note A variable object cannot be instantiated without specifying a size.
         **/
         class Variable
         {
+        public:
+            /** @brief Iterator through the wires of a variable. **/
+            template <typename T>
+            class Iterator
+            {
+            public:
+                // Iterator traits
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = Wire;
+                using difference_type = std::ptrdiff_t;
+                using pointer = T*;
+                using reference = T&;
+
+            private:
+                T* _wires; /**<First wire of the variable.*/
+                int64_t _stride; /**<Distance between two consecutive wires.*/
+                uint64_t _index; /**<Index of the current wire.*/
+
+            public:
+                Iterator(T* wires, int64_t stride, uint64_t index) : _wires(wires), _stride(stride), _index(index) {}
+
+                reference operator * () const { return _wires[static_cast<int64_t>(_index) * _stride]; }
+                pointer operator -> () const { return &**this; }
+                Iterator& operator ++ () { _index++; return *this; }
+                Iterator operator ++ (int) { Iterator previous = *this; _index++; return previous; }
+                bool operator == (const Iterator& other) const { return _index == other._index; }
+                bool operator != (const Iterator& other) const { return _index != other._index; }
+            };
+
         private:
             // QoL typedefs for iterator component
-            using iterator = std::vector<Wire>::iterator;
-            using const_iterator = std::vector<Wire>::const_iterator;
+            using iterator = Iterator<Wire>;
+            using const_iterator = Iterator<const Wire>;
+
+        public:
+            static constexpr uint64_t inline_size = 64; /**<Maximum size of a variable stored without allocations.*/
 
         protected:
-            std::vector<Wire> _wires; /**<Variable wires.*/
-        
+            uint64_t _size; /**<Variable size (number of wires).*/
+            Wire* _wires; /**<First wire of the variable (either the inline wires, an allocated list or the viewed wires).*/
+            int64_t _stride = 1; /**<Distance between two consecutive wires of the variable.*/
+            bool _view = false; /**<Control variable of variables that do not own their wires.*/
+            union { Wire _inline_wires[inline_size]; }; /**<Wires of the small variables (only the used ones are initialized).*/
+
+        protected:
+            /**
+             * @brief Construct a new Variable object as a view of other wires.
+             * @param wires First viewed wire.
+             * @param size Number of viewed wires.
+             * @param stride Distance between two consecutive viewed wires.
+            **/
+            Variable(Wire* wires, uint64_t size, int64_t stride);
+
+            /**
+             * @brief Copies the wires of another variable, that must have the same size.
+             * @param other Other variable that will be copied.
+            **/
+            void _copy_wires(const Variable& other);
+
         public:
             /** @brief Default construction of a new Varaible object is deleted. **/
             Variable() = delete;
@@ -50,6 +185,23 @@ namespace gabe {
             **/
             Variable(uint64_t number_wires);
 
+            /**
+             * @brief Construct a new Variable object as a copy of another one.
+             * @note The new variable always owns its wires, even if the other variable is a view.
+             * @param other Other variable that will be copied.
+            **/
+            Variable(const Variable& other);
+
+            /**
+             * @brief Construct a new Variable object from another one, taking its wires.
+             * @note The new variable always owns its wires. If the other variable is a view, its wires are copied.
+             * @param other Other variable that will be moved.
+            **/
+            Variable(Variable&& other) noexcept;
+
+            /** @brief Destroy the Variable object. **/
+            ~Variable();
+
         public:
             /**
              * @brief Accesses a wire positioned in an input index.
@@ -61,7 +213,7 @@ namespace gabe {
              * @param index Wire index.
              * @return Accessed wire.
             **/
-            Wire& operator [] (uint64_t index);
+            Wire& operator [] (uint64_t index) { return _wires[static_cast<int64_t>(index) * _stride]; }
 
             /**
              * @brief Accesses a wire positioned in an input index.
@@ -73,46 +225,260 @@ namespace gabe {
              * @param Wire index.
              * @return Accessed wire.
             **/
-            const Wire& operator [] (uint64_t index) const;
+            const Wire& operator [] (uint64_t index) const { return _wires[static_cast<int64_t>(index) * _stride]; }
 
             /**
              * @brief Copies a value into the current one.
+             * 
+             * -----
+             * 
+             * The wires labels of the other variable are copied into the wires of the current one. If the current variable is a
+             * view, the viewed wires are the ones modified.
+             * 
              * @note Limitation: You can only use this with variables with the same size. 
              * @param other Other variable that will be copied.
+             * @return Current variable.
+            **/
+            Variable& operator = (const Variable& other);
+
+            /**
+             * @brief Moves a value into the current one.
+             * 
+             * -----
+             * 
+             * Behaves as the copy of a variable, except that the wires of the other variable are taken instead of copied when
+             * both variables own their wires and the other one has allocated wires.
+             * 
+             * @note Limitation: You can only use this with variables with the same size. 
+             * @param other Other variable that will be moved.
+             * @return Current variable.
             **/
-            void operator = (const Variable& other);
+            Variable& operator = (Variable&& other);
 
             /**
              * @brief Get the size of the variable.
              * @return Size of the variable (number wires).
             **/
-            uint64_t size() const;
+            uint64_t size() const { return _size; }
+
+            /**
+             * @brief Creates a view of a range of wires of the variable.
+             * 
+             * -----
+             * 
+             * The view does not copy the wires, and no gates are needed to create it. Modifying the wires of the view modifies
+             * the wires of the variable. This function raises a runtime exception if the range exceeds the variable size.
+             * 
+             * ```
+             * Variable: 76543210 (wires indexes)
+             * slice(2, 4): 5432
+             * ```
+             * 
+             * @param begin Index of the first wire of the view.
+             * @param size Number of wires of the view.
+             * @return View of the wires.
+            **/
+            VariableView slice(uint64_t begin, uint64_t size);
+
+            /**
+             * @brief Creates a constant view of a range of wires of the variable.
+             * @see slice
+             * @param begin Index of the first wire of the view.
+             * @param size Number of wires of the view.
+             * @return Constant view of the wires.
+            **/
+            const VariableView slice(uint64_t begin, uint64_t size) const;
+
+            /**
+             * @brief Creates a view of the wires of the variable in the reverse order (bit-reversal).
+             * 
+             * -----
+             * 
+             * The view does not copy the wires, and no gates are needed to create it. The first wire of the view is the last wire
+             * of the variable.
+             * 
+             * @return View of the wires.
+            **/
+            VariableView reversed();
+
+            /**
+             * @brief Creates a constant view of the wires of the variable in the reverse order (bit-reversal).
+             * @see reversed
+             * @return Constant view of the wires.
+            **/
+            const VariableView reversed() const;
+
+            /**
+             * @brief Concatenates two variables.
+             * 
+             * -----
+             * 
+             * The wires of the low variable are the least significant wires of the result, followed by the wires of the high
+             * variable. Only the wires labels are copied, thus no gates are needed.
+             * 
+             * @param low Least significant part.
+             * @param high Most significant part.
+             * @return Concatenated variable.
+            **/
+            static Variable concatenate(const Variable& low, const Variable& high);
 
             /**
              * @brief Iteration begin method.
              * @note This iteration is mutable.
              * @return Iterator with initial position.
             **/
-            iterator begin() { return _wires.begin(); }
+            iterator begin() { return iterator(_wires, _stride, 0); }
 
             /**
              * @brief Iteration end method.
              * @return Iterator after final position.
             **/
-            iterator end() { return _wires.end(); }
+            iterator end() { return iterator(_wires, _stride, _size); }
 
             /**
              * @brief Constant iteration begin method.
              * @note This iteration is not mutable.
              * @return Constant iterator with initial position.
             **/
-            const_iterator begin() const { return _wires.begin(); }
+            const_iterator begin() const { return const_iterator(_wires, _stride, 0); }
 
             /**
              * @brief Constant iteration end method.
              * @return Constant iterator after final position.
             **/
-            const_iterator end() const { return _wires.end(); }
+            const_iterator end() const { return const_iterator(_wires, _stride, _size); }
+        };
+
+        /**
+         * @brief Variable view class.
+         * 
+         * -----
+         * 
+         * A variable view is a variable that does not own its wires, but refers to the wires of another variable (e.g, a range
+         * of its wires, or its wires in the reverse order). Since a view is a variable, it can be given to any operation of the
+         * circuit generator, both as an input and as an output, without copying any wire or writing any gate.
+         * 
+         * Views are created by the slice and reversed methods of a variable. Copying a view creates another view of the same
+         * wires, while copying it into a Variable object creates a variable that owns a copy of the wires.
+         * 
+         * @note A view must not outlive the variable it refers to.
+        **/
+        class VariableView : public Variable
+        {
+            // Variables create the views of their wires
+            friend class Variable;
+
+        protected:
+            /**
+             * @brief Construct a new Variable View object.
+             * @param wires First viewed wire.
+             * @param size Number of viewed wires.
+             * @param stride Distance between two consecutive viewed wires.
+            **/
+            VariableView(Wire* wires, uint64_t size, int64_t stride) : Variable(wires, size, stride) {}
+
+        public:
+            /**
+             * @brief Construct a new Variable View object of the same wires of another view.
+             * @param other Other view.
+            **/
+            VariableView(const VariableView& other) : Variable(other._wires, other._size, other._stride) {}
+
+            /**
+             * @brief Copies a value into the viewed wires.
+             * @note Limitation: You can only use this with variables with the same size. 
+             * @param other Other variable that will be copied.
+             * @return Current view.
+            **/
+            VariableView& operator = (const VariableView& other) { Variable::operator=(other); return *this; }
+
+            using Variable::operator=;
+        };
+
+        /**
+         * @brief Fixed point variable class.
+         * 
+         * -----
+         * 
+         * A fixed point variable is a signed variable (2's complement) with a binary point at a fixed position, in the Q format
+         * \f$Q_{I.F}\f$: its \f$F\f$ least significant wires are the fraction bits and its \f$I\f$ most significant wires are
+         * the integer bits, including the sign bit. The value of a variable with the integer \f$X\f$ is \f$X / 2^F\f$.
+         * 
+         * The format is only known by the circuit generator operations for fixed point variables (e.g. multiply_fixed), which
+         * align, round and saturate the values between formats. As a variable, it can also be given to any integer operation.
+         * 
+         * @note The format of a fixed point variable cannot change, only variables with the same format can be assigned.
+        **/
+        class FixedPoint : public Variable
+        {
+        private:
+            uint64_t _fraction_bits; /**<Number of fraction bits.*/
+
+        public:
+            /**
+             * @brief Construct a new Fixed Point object.
+             * 
+             * -----
+             * 
+             * Raises a runtime exception if there are no integer bits, as the sign bit is an integer bit.
+             * 
+             * @param integer_bits Number of integer bits, including the sign bit.
+             * @param fraction_bits Number of fraction bits.
+            **/
+            FixedPoint(uint64_t integer_bits, uint64_t fraction_bits);
+
+            /**
+             * @brief Construct a new Fixed Point object as a copy of another one, with the same format.
+             * @param other Other fixed point variable that will be copied.
+            **/
+            FixedPoint(const FixedPoint& other) = default;
+
+            /**
+             * @brief Copies a value with the same format into the current one.
+             * @note Raises a runtime exception if the formats are different.
+             * @param other Other fixed point variable that will be copied.
+             * @return Current variable.
+            **/
+            FixedPoint& operator = (const FixedPoint& other);
+
+            using Variable::operator=;
+
+            /**
+             * @brief Get the number of integer bits of the variable.
+             * @return Number of integer bits, including the sign bit.
+            **/
+            uint64_t integer_bits() const { return _size - _fraction_bits; }
+
+            /**
+             * @brief Get the number of fraction bits of the variable.
+             * @return Number of fraction bits.
+            **/
+            uint64_t fraction_bits() const { return _fraction_bits; }
+
+            /**
+             * @brief Encodes a real value in the format of the variable (e.g. to assign it with assign_value).
+             * 
+             * -----
+             * 
+             * The value is rounded to the nearest value of the format, and saturated to its range. Raises a runtime exception if
+             * the variable has more than 64 wires.
+             * 
+             * @param value Real value.
+             * @return Integer of the value, in 2's complement with the variable size.
+            **/
+            uint64_t encode(double value) const;
+
+            /**
+             * @brief Decodes an integer in the format of the variable (e.g. given by a circuit evaluation).
+             * 
+             * -----
+             * 
+             * Raises a runtime exception if the variable has more than 64 wires.
+             * 
+             * @param value Integer in 2's complement with the variable size.
+             * @return Real value.
+            **/
+            double decode(uint64_t value) const;
         };
         
         /**
@@ -123,17 +489,51 @@ namespace gabe {
          * This class has the core functionality of a circuit generator. Every class that extends from this will inherite this
          * core methods. The child classes can also overwrite two methods that should be changed for specialized purposes.
          * 
-         * @note Currently, this class is limited to integer operations.
+         * @note Currently, this class is limited to integer and fixed point operations.
          * 
          * @note This class is abstract and designed to not be able to be instantiated. It is meant to be extended from, and its
          * child dedicated to a circuit format.
         **/
         class CircuitGenerator
         {
+            // Profiling scopes access the profiling call path
+            friend class ProfileScope;
+
         protected:
+            /**
+             * @brief Node of the profiling call path tree.
+             * 
+             * -----
+             * 
+             * Every node is a profiling scope inside its parent scope. The node counters only include the gates written while
+             * the node is the innermost scope (self cost). The cost of the children is added when the reports are created.
+            **/
+            struct ProfileNode {
+                std::string name; /**<Scope name.*/
+                uint64_t parent = 0; /**<Index of the parent node.*/
+                std::map<std::string, uint64_t> children; /**<Indexes of the children nodes, by name.*/
+                uint64_t calls = 0; /**<Number of times the scope was entered.*/
+                uint64_t gates = 0; /**<Gates written in the scope.*/
+                uint64_t and_gates = 0; /**<AND gates written in the scope.*/
+                uint64_t wires = 0; /**<Wires created in the scope.*/
+                uint64_t depth = 0; /**<Deepest wire created in the scope.*/
+                uint64_t and_depth = 0; /**<Deepest wire created in the scope, in AND gates.*/
+                std::map<std::string, uint64_t> gates_counters; /**<Gates written in the scope, by gate name.*/
+            };
+
+            /** @brief Gate kept in memory until the labels of the circuit are reassigned. **/
+            struct RecordedGate {
+                label_t in_a = 0; /**<Input wire A label (or constant value of an EQ gate).*/
+                label_t in_b = 0; /**<Input wire B label (same as the input wire A for gates with a single input wire).*/
+                label_t out = 0; /**<Output wire label.*/
+                uint8_t inputs = 0; /**<Number of input wires (0 for an EQ gate).*/
+                const std::string* gate = nullptr; /**<Gate name.*/
+            };
+
             // Circuit name and location
             std::string _circuit_name; /**<Circuit file name.*/
             std::filesystem::path _circuits_directory; /**<Circuit location.*/
+            std::string _circuit_extension = ".txt"; /**<Circuit file extension.*/
 
             // Circuit info
             std::vector<uint64_t> _input_parties; /**<Input parties and their sizes.*/
@@ -157,6 +557,30 @@ namespace gabe {
             Wire _zero_wire; /**<Wire that is always zero in the circuit.*/
             Wire _one_wire; /**<Wire that is always one in the circuit.*/
 
+            // Depth tracking
+            bool _track_depth = false; /**<Control variable to track the depth of every wire.*/
+            std::vector<Depth> _wires_depths; /**<Depth of every wire, indexed by label.*/
+
+            // Profiling
+            bool _profiling = false; /**<Control variable to profile the gates costs by scope.*/
+            std::vector<ProfileNode> _profile_nodes; /**<Profiling call path tree (the first node is the root).*/
+            uint64_t _profile_node = 0x00; /**<Index of the innermost profiling scope.*/
+
+            // Shadow evaluation
+            bool _shadow = false; /**<Control variable to evaluate the circuit in cleartext as the gates are written.*/
+            std::vector<uint64_t> _shadow_values; /**<Values of the 64 evaluation lanes of every wire, indexed by label.*/
+
+            // Labels reuse
+            bool _reuse_labels = false; /**<Control variable to reuse the labels of dead wires once the circuit is complete.*/
+            std::vector<RecordedGate> _recorded_gates; /**<Circuit gates, kept in memory until they are scheduled or relabeled.*/
+
+            // Gates scheduling
+            bool _schedule_gates = false; /**<Control variable to reorder the gates once the circuit is complete.*/
+            ScheduleReport _schedule_report; /**<Reuse distances of the last scheduled circuit.*/
+
+            // Comparators
+            bool _log_depth_comparators = false; /**<Control variable to build the comparators as trees instead of chains.*/
+
         // Internal Core Methods
         private:
             /**
@@ -183,6 +607,8 @@ namespace gabe {
             **/
             void _flush_buffer(std::ofstream& file);
 
+        // Gates Writing
+        protected:
             /**
              * @brief Writes a gate line of the circuit.
              * 
@@ -204,13 +630,13 @@ namespace gabe {
              * -----
              * 
              * This function only constructs the gate (1:1) line that will be written into the circuit file. This line is then
-             * given to the _write_gate function.
+             * given to the _write_gate function. It can be overriden by formats that do not write gates as text lines.
              * 
              * @param in_a Input wire.
              * @param output Output wire.
              * @param gate Gate name.
             **/
-            void _write_1_1_gate(const uint64_t in_a, const uint64_t output, const std::string &gate);
+            virtual void _write_1_1_gate(const uint64_t in_a, const uint64_t output, const std::string &gate);
 
             /**
              * @brief Writes a logic gate that has 2 input wires and 1 output wire.
@@ -218,641 +644,1286 @@ namespace gabe {
              * -----
              * 
              * This function only constructs the gate (2:1) line that will be written into the circuit file. This line is then
-             * given to the _write_gate function.
+             * given to the _write_gate function. It can be overriden by formats that do not write gates as text lines.
              * 
              * @param in_a Input wire A.
              * @param in_b Input wire B.
              * @param output Output wire.
              * @param gate Gate name.
             **/
-            void _write_2_1_gate(const uint64_t in_a, const uint64_t in_b, const uint64_t output, const std::string &gate);
+            virtual void _write_2_1_gate(const uint64_t in_a, const uint64_t in_b, const uint64_t output, const std::string &gate);
 
-        // Assertions | Errors | Exceptions
-        private:
             /**
-             * @brief Checks if a variable has a specific size.
+             * @brief Adds a logic gate that has 1 input wire and 1 output wire to the circuit.
              * 
              * -----
              * 
-             * This check raises a runtime expection if the variable does not meet the required size.
+             * The gate is written right away with the _write_1_1_gate function, unless the labels reuse or the gates scheduling
+             * are enabled. In that case, the gate is kept in memory and only written once the circuit is complete.
              * 
-             * @param variable Variable to check.
-             * @param size Size to evaluate.
+             * @param in_a Input wire.
+             * @param output Output wire.
+             * @param gate Gate name.
             **/
-            void _assert_equal_size(const Variable& variable, uint64_t size);
+            void _add_1_1_gate(const uint64_t in_a, const uint64_t output, const std::string &gate);
 
             /**
-             * @brief Checks if the input variable can be added as input.
+             * @brief Adds a logic gate that has 2 input wires and 1 output wire to the circuit.
              * 
              * -----
              * 
-             * This check raises a runtime expection if the variable size does exceed the total of available input wires.
+             * Same as the _add_1_1_gate function, for gates written with the _write_2_1_gate function.
              * 
-             * @param size Number of wires to evaluate.
+             * @param in_a Input wire A.
+             * @param in_b Input wire B.
+             * @param output Output wire.
+             * @param gate Gate name.
             **/
-            void _assert_add_input(uint64_t size);
+            void _add_2_1_gate(const uint64_t in_a, const uint64_t in_b, const uint64_t output, const std::string &gate);
 
             /**
-             * @brief Checks if the output variable can be added as output.
+             * @brief Reorders the kept gates to shorten the reuse distance of the wires.
              * 
              * -----
              * 
-             * This check raises a runtime expection if the variable size does exceed the total of available output wires.
-             * 
-             * @param size Number of wires to evaluate.
+             * The gates are placed by list scheduling: among the gates whose input wires are already computed, the next gate is
+             * the one that reads the most recently written wire, and ties keep the original order. This places the readers of a
+             * wire right after its writer whenever possible. The gates that copy the output wires stay the last gates of the
+             * circuit. The original order is kept if the scheduled one has a longer mean reuse distance. The reuse distances
+             * before and after are kept in the schedule report.
             **/
-            void _assert_add_output(uint64_t size);
-        
-        // Constructors | Destructor
-        protected:
-            /** @brief Default construction of a new Circuit Generator object is deleted. **/
-            CircuitGenerator() = delete;
+            void _schedule();
 
             /**
-             * @brief Construct a new Circuit Generator object for a specified circuit name and location.
-             * 
-             * -----
-             * 
-             * In the end, the generated circuit file will have the name of the inserted circuit name and located into the
-             * inserted location.
-             * 
-             * @note By default, the directory to the circuits is located at a circuits directory that should be in the same level
-             * from where the executable is being executed.
-             * 
-             * @param circuit_name Name of the circuit.
-             * @param circuits_directory Location of the circuit.
+             * @brief Computes the reuse distance of the wires of the kept gates, in their current order.
+             * @return Reuse distance of the kept gates.
             **/
-            CircuitGenerator(const std::string &circuit_name, const std::string &circuits_directory = "circuits");
-
-            /** @brief Destroy the Circuit Generator object. **/
-            ~CircuitGenerator();
+            ReuseDistance _reuse_distance() const;
 
-        // Abstract Methods
-        protected:
             /**
-             * @brief Writes the header section of the circuit into a file.
+             * @brief Reassigns the labels of the kept gates and writes them.
              * 
              * -----
              * 
-             * By default, this function is empty. It is meant to be overritten by any circuit generator class that extends from
-             * this one.
+             * The gates are replayed in order, and the output wire of each gate takes the next label, so that consecutive gates
+             * write consecutive labels. With the labels reuse enabled, a wire is dead after the last gate that reads it, thus the
+             * output wire takes the label of a dead wire whenever there is one. The input wires keep the first labels and the
+             * circuit output wires get the last labels, as every circuit format requires. With the labels reuse, the number of
+             * wires of the circuit becomes the maximum number of wires alive at the same time.
              * 
-             * @param file File to write.
+             * @note The replayed gates are counted again, thus the gates counters are restarted.
             **/
-            virtual void _write_header(std::ofstream& file);
+            void _reassign_labels();
 
             /**
-             * @brief Writes the circuit section of the circuit into a file.
+             * @brief Tracks the depth and the profiling costs of a written gate.
              * 
              * -----
              * 
-             * By default, this function is performs the write of the circuit section exactly how it should be. However, it is
-             * placed as abstract in case any child class needs to change its behavior.
+             * The output wire depth is one more than the depth of its deepest input wire. The AND depth is only increased by AND
+             * gates. The gate is then added to the costs of the innermost profiling scope. Each step is skipped if the depth
+             * tracking or the profiling are disabled, respectively.
              * 
-             * @param file File to write.
+             * @param in_a Input wire A.
+             * @param in_b Input wire B (same as the input wire A for gates with a single input wire).
+             * @param output Output wire.
+             * @param gate Gate name.
             **/
-            virtual void _write_circuit(std::ofstream& file);
+            void _track_gate(const uint64_t in_a, const uint64_t in_b, const uint64_t output, const std::string &gate);
 
-        // Generator Options
-        public:
             /**
-             * @brief Sets a buffer size limit to the internal buffer.
-             * 
-             * -----
-             * 
-             * By default, the circuit generator caches all the generated data until it is written into a circuit file, which is
-             * the last step. However, this can be a problem in several machines that are more RAM limited. In those cases, this
-             * function can be used to set a buffer limit to write into the circuit file once the buffer reaches a specified size.
-             * The size is in bytes.
-             * 
-             * @param size Size of the buffer.
+             * @brief Enters a profiling scope inside the current one.
+             * @param name Scope name.
             **/
-            void limit_buffer(uint64_t size);
+            void _profile_push(const char* name);
+
+            /** @brief Leaves the current profiling scope. **/
+            void _profile_pop();
 
-        // Circuit Setup
-        public:
             /**
-             * @brief Adds an input party to the circuit.
+             * @brief Gets the shadow evaluation lanes of a wire label.
+             * @note Wires without a value (e.g, unused input wires) are zero in all the lanes.
+             * @param label Wire label.
+             * @return Values of the 64 lanes of the wire.
+            **/
+            uint64_t _shadow_lanes(uint64_t label) const;
+
+            /**
+             * @brief Sets the shadow evaluation lanes of a wire label.
+             * @param label Wire label.
+             * @param lanes Values of the 64 lanes of the wire.
+            **/
+            void _shadow_gate(uint64_t label, uint64_t lanes);
+
+            /**
+             * @brief Creates the label of a new wire.
+             * @note Raises a runtime exception if the label does not fit in the label type (see label_t).
+             * @return Label of the new wire.
+            **/
+            label_t _new_label();
+
+            /**
+             * @brief Gets a wire of a variable as if the variable was extended to any size.
+             * @param variable Variable.
+             * @param index Index of the wire.
+             * @param is_signed True to extend the variable with its sign wire, false to extend it with zero wires.
+             * @return Wire of the variable, or its extension wire if the index is after its most significant wire.
+            **/
+            Wire _extended(const Variable& variable, uint64_t index, bool is_signed) const;
+
+            /**
+             * @brief XOR operation between two wires, without any gate if one of them is the zero wire.
+             * @param in_a Input wire A.
+             * @param in_b Input wire B.
+             * @param out Output wire.
+            **/
+            void _fold_XOR(const Wire in_a, const Wire in_b, Wire& out);
+
+            /**
+             * @brief AND operation between two wires, without any gate if one of them is the zero wire.
+             * @param in_a Input wire A.
+             * @param in_b Input wire B.
+             * @param out Output wire.
+            **/
+            void _fold_AND(const Wire in_a, const Wire in_b, Wire& out);
+
+            /**
+             * @brief OR operation between two wires, without any gate if one of them is the zero wire.
+             * @param in_a Input wire A.
+             * @param in_b Input wire B.
+             * @param out Output wire.
+            **/
+            void _fold_OR(const Wire in_a, const Wire in_b, Wire& out);
+
+            /**
+             * @brief Binary addition between two variables of any size (see sum and sum_s).
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param is_signed True to sign extend the narrowest input variable, false to zero extend it.
+             * @param out Output variable \f$Sum\f$.
+            **/
+            void _sum(const Variable& in_a, const Variable& in_b, bool is_signed, Variable& out);
+
+            /**
+             * @brief Binary subtraction between two variables of any size (see subtract and subtract_s).
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param is_signed True to sign extend the narrowest input variable, false to zero extend it.
+             * @param out Output variable \f$Sub\f$.
+            **/
+            void _subtract(const Variable& in_a, const Variable& in_b, bool is_signed, Variable& out);
+
+            /**
+             * @brief Adds a power of two to a constant, modulo the size of the constant.
+             * @param constant Bits of the constant, from the least significant one.
+             * @param position Exponent of the power of two.
+             * @param negative True to subtract the power of two instead.
+            **/
+            static void _add_power(std::vector<uint8_t>& constant, uint64_t position, bool negative);
+
+            /**
+             * @brief Adds all the wires of a bits heap, resulting in a new variable.
              * 
              * -----
              * 
-             * This function adds a new input party and registers its size into a vector of input parties. The inserted party size
-             * will increase the number of available input variables that can be used to add input variables. This size is also
-             * important in the writing phase.
-             * 
-             * @note This function should only be used before starting the circuit writing (after using the start() method).
-             * Otherwise, this function will not behave as expected.
+             * Each column of the heap has the wires with the weight of its position. The heights of the columns are reduced in
+             * stages of full adders (3:2 compressors) until every column has at most two wires, which are then added by a single
+             * final adder. The carries of the last column are not computed.
              * 
-             * @param size Size of the input party.
+             * @param columns Wires of each column of the heap. The columns are consumed.
+             * @param constant Bits of a constant that is also added (one wires are placed in the heap for its set bits).
+             * @param out Output variable, whose size is the number of columns that are added.
             **/
-            void add_input_party(uint64_t size);
+            void _compress(std::vector<std::vector<Wire>>& columns, const std::vector<uint8_t>& constant, Variable& out);
 
             /**
-             * @brief Adds an output party to the circuit.
+             * @brief Binary addition of many variables of any size (see sum_many and sum_many_s).
+             * @param in Input variables.
+             * @param is_signed True to sign extend the input variables, false to zero extend them.
+             * @param out Output variable \f$Sum\f$.
+            **/
+            void _sum_many(const std::vector<Variable>& in, bool is_signed, Variable& out);
+
+            /**
+             * @brief Inner product between two vectors of variables of any size (see inner_product_u and inner_product_s).
+             * @param in_a Input variables \f$A\f$.
+             * @param in_b Input variables \f$B\f$.
+             * @param is_signed True if the input variables are signed, false otherwise.
+             * @param out Output variable \f$Prod\f$.
+            **/
+            void _inner_product(const std::vector<Variable>& in_a, const std::vector<Variable>& in_b, bool is_signed, Variable& out);
+
+            /**
+             * @brief Prefix OR of the wires of a variable, with a Brent-Kung tree.
              * 
              * -----
              * 
-             * This function adds a new output party and registers its size into a vector of output parties.
-             * 
-             * @note This function should only be used before starting the circuit writing (after using the start() method).
-             * Otherwise, this function will not behave as expected.
+             * The tree computes the OR of the first \f$2^k\f$ wires in a first pass, and fills the remaining prefixes in a
+             * second pass, thus it has about \f$2N\f$ OR gates and a depth of about \f$2.log_2(N)\f$.
              * 
-             * @param size Size of the output party.
+             * @param in_a Input variable.
+             * @param from_msb True for the OR of the wires from the most significant one to each wire, false for the OR of the
+             * wires from the least significant one to each wire.
+             * @param out Output variable, with the same size as the input variable.
             **/
-            void add_output_party(uint64_t size);
+            void _prefix_OR(const Variable& in_a, bool from_msb, Variable& out);
 
             /**
-             * @brief Adds a wire as a circuit input.
+             * @brief Binary encoding of a one-hot variable, resulting in a new unsigned variable.
              * 
              * -----
              * 
-             * This will assign a label to the inputed wire.
-             * This function expects that there is at least one avaliable input wire to be assigned into the input wire. The
-             * amount of circuit input wires is manageable by the add_input_party function.
-             * In case there is not an available wire, this function will raise a runtime exception.
-             * 
-             * @note This function should only be used before starting the circuit writing (before using the start() method).
-             * Otherwise, this function will not behave as expected.
+             * At most one of the wires is one, thus each bit of the encoding is the XOR (instead of the OR) of the wires whose
+             * index has that bit set, and the encoding does not have any AND gates. The encoding is zero if every wire is zero.
              * 
-             * @param wire Input wire in the circuit.
+             * @param one_hot Input variable, where the index of the wire that is one is the encoded value.
+             * @param out Output variable, truncated to its size.
             **/
-            void add_input(Wire& wire);
+            void _encode(const Variable& one_hot, Variable& out);
 
             /**
-             * @brief Adds a variable as a circuit input.
+             * @brief Sorts a vector of unsigned variables, with or without payloads (see sort).
+             * @param keys Input & Output variables.
+             * @param payloads Input & Output payloads of the variables, or nullptr if there are no payloads.
+             * @param ascending True to sort in ascending order, false to sort in descending order.
+             * @param network Topology of the sorting network.
+            **/
+            void _sort(std::vector<Variable>& keys, std::vector<Variable>* payloads, bool ascending, SortingNetwork network);
+
+            /**
+             * @brief Switches of the permutation network of a group of positions (see permutation_network).
+             * @param positions Positions of the group, in increasing order.
+             * @param switches Output switches, to which the switches of the group are appended.
+            **/
+            static void _permutation_network(const std::vector<uint64_t>& positions, std::vector<Comparator>& switches);
+
+            /**
+             * @brief Control bits that route a permutation through the permutation network of its size (see
+             * permutation_control_bits).
              * 
              * -----
              * 
-             * This will assign labels to all the wires inside the inputed variable.
-             * This function expects that there are enough avaliable input wires to be assigned into the input variable. The
-             * amount of circuit input wires is manageable by the add_input_party function.
-             * In case there are not enough input wires, this function will raise a runtime exception.
-             * 
-             * @note This function should only be used before starting the circuit writing (before using the start() method).
-             * Otherwise, this function will not behave as expected.
+             * The elements are split between the upper and the lower subnetworks, such that the two elements of an input switch
+             * and the two elements of an output switch go to different subnetworks. Each constraint links two elements, thus the
+             * elements form chains that alternate between the subnetworks (looping algorithm). The chains that end at the
+             * positions without a switch are routed first, as their subnetworks are fixed.
              * 
-             * @param variable Input variable in the circuit.
+             * @param permutation Permutation, where the element at position i is the input position of output position i.
+             * @param control_bits Output control bits, to which the control bits of the permutation are appended.
             **/
-            void add_input(Variable& variable);
+            static void _route_permutation(const std::vector<uint64_t>& permutation, std::vector<uint8_t>& control_bits);
 
             /**
-             * @brief Adds a wire as a circuit output.
+             * @brief Aligns a signed variable, shifting it left and sign extending it to a size, without gates.
+             * @param in_a Input variable.
+             * @param shift Number of zero wires appended as the least significant wires.
+             * @param size Size of the aligned variable.
+             * @return Aligned variable.
+            **/
+            Variable _align_fixed(const Variable& in_a, uint64_t shift, uint64_t size);
+
+            /**
+             * @brief Converts a signed variable with fraction bits to the format of a fixed point variable (see convert_fixed).
              * 
              * -----
              * 
-             * This will cache the input wire in a class member, which will be used in the very last step of the circuit
-             * writing (stop method).
-             * This function expects that there is at least one avaliable output wire. The amount of circuit output wires is
-             * manageable by the add_output_party function.
-             * In case there is not an available expected output wire, this function will raise a runtime exception.
+             * Without saturation, the input only needs the wires up to the most significant wire of the output, thus it can be
+             * the truncated result of an operation.
              * 
-             * Unlike the add_input function, this one will not assign a label to the inputed wire.
+             * @param in_a Input variable.
+             * @param fraction_bits Number of fraction bits of the input variable.
+             * @param out Output variable.
+             * @param rounding Rounding of the dropped fraction bits.
+             * @param saturate True to saturate values out of the output range, false to wrap them around.
+            **/
+            void _convert_fixed(const Variable& in_a, uint64_t fraction_bits, FixedPoint& out, Rounding rounding, bool saturate);
+
+            /**
+             * @brief Truncates a signed variable to the size of the output variable, with or without saturation.
+             * @param in_a Input variable.
+             * @param out Output variable.
+             * @param saturate True to saturate values out of the output range, false to wrap them around.
+            **/
+            void _saturate_fixed(const Variable& in_a, Variable& out, bool saturate);
+
+            /**
+             * @brief Binary division between two unsigned variables of any size (see divide_u).
              * 
-             * @note This function should only be used before starting the circuit writing (before using the start() method).
-             * Otherwise, this function will not behave as expected.
+             * -----
              * 
-             * @param wire Output wire in the circuit.
+             * The remainder only has the bits of the dividend assigned so far, and at most one more bit than the divisor, thus the
+             * first comparisons and subtractions are narrower than the divisor.
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out_q Output variable \f$Q\f$ (Quotient).
+             * @param out_r Output variable \f$R\f$ (Remainder), or nullptr if the remainder is not needed.
             **/
-            void add_output(Wire& wire);
+            void _divide_u(const Variable& in_a, const Variable& in_b, Variable& out_q, Variable* out_r);
 
             /**
-             * @brief Adds a variable as a circuit output.
+             * @brief Evaluates if two variables of any size are equal or not (see equal).
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param is_signed True to sign extend the narrowest input variable, false to zero extend it.
+             * @param out Output wire \f$Equal\f$.
+            **/
+            void _equal(const Variable& in_a, const Variable& in_b, bool is_signed, Wire& out);
+
+            /**
+             * @brief Evaluates if variable A is smaller than variable B.
              * 
              * -----
              * 
-             * This will cache the input wire in a class member, which will be used in the very last step of the circuit
-             * writing (stop method).
-             * This function expects that there is at least one avaliable output wire. The amount of circuit output wires is
-             * manageable by the add_output_party function.
-             * In case there is not an available expected output wire, this function will raise a runtime exception.
+             * All the comparison operations are built on this function. By default, A is smaller than B if the subtraction
+             * \f$A-B\f$ borrows from its most significant bit. The borrow out of each bit is the majority of \f$\overline{A_i}\f$,
+             * \f$B_i\f$ and the borrow in, which is computed with a single AND gate:
              * 
-             * Unlike the add_input function, this one will not assign a label to the inputed wire.
+             * \f$Borrow_{i+1} = B_{i} \oplus ((A_{i} \oplus Borrow_{i}).(B_{i} \oplus Borrow_{i}))\f$
              * 
-             * @note This function should only be used before starting the circuit writing (before using the start() method).
-             * Otherwise, this function will not behave as expected.
+             * With the log depth comparators enabled, the bits are compared in pairs of adjacent groups instead, which costs about
+             * three AND gates per bit for a logarithmic AND depth.
              * 
-             * @param variable Output variable in the circuit.
+             * A signed comparison is the unsigned comparison of both variables with their sign bits flipped, which only changes
+             * the XORed bit of the most significant bit from \f$B_{n}\f$ to \f$A_{n}\f$, thus it costs no extra gate.
+             * 
+             * The narrowest variable is extended to the size of the widest one (with its sign wire if the variables are signed, or
+             * with zero wires otherwise), and the gates with a zero wire are not created.
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param is_signed True if the variables are signed, false otherwise.
+             * @param out Output wire \f$Smaller\f$.
             **/
-            void add_output(Variable& variable);
+            void _smaller(const Variable& in_a, const Variable& in_b, bool is_signed, Wire& out);
 
+        // Assertions | Errors | Exceptions
+        private:
             /**
-             * @brief Starts the writing/construction of the circuit.
+             * @brief Checks if a variable has a specific size.
              * 
              * -----
              * 
-             * This function makes sure that all the inputs of the circuit were correctly setup, i.e that there are inputs and
-             * that all the defined input wires were all assigned to input variables.
-             * If something is wrong with the initial setup, this function raises a runtime exception.
-             * 
-             * Once the validation checks pass, this function ends up by creating the zero and one wires, wich are constant wires
-             * that assume the value 0 and 1 in the circuit, respectively.
+             * This check raises a runtime expection if the variable does not meet the required size.
              * 
-             * @note The add_input and add_input_party methods should not be used once this function is called.
+             * @param variable Variable to check.
+             * @param size Size to evaluate.
             **/
-            void start();
+            void _assert_equal_size(const Variable& variable, uint64_t size);
 
             /**
-             * @brief Stops the writing/construction of the circuit.
+             * @brief Checks if the input variable can be added as input.
              * 
              * -----
              * 
-             * Once called, this function terminates the circuit construction and completes the writing into the circuit file,
-             * including defining correctly its header part, which is dependent of the total gates in the circuit.
-             * To conclude, it also prints into the console the total amount of gates and wires of the created circuit.
+             * This check raises a runtime expection if the variable size does exceed the total of available input wires.
+             * 
+             * @param size Number of wires to evaluate.
             **/
-            void stop();
+            void _assert_add_input(uint64_t size);
 
-        // Variables manipulation
-        public:
             /**
-             * @brief Assigns a value to a inputed wire.
+             * @brief Checks if the output variable can be added as output.
              * 
              * -----
              * 
-             * A wire can have a value either 0 or 1. Whenever it is needed to have a wire with one of these constants, this
-             * function should be used.
-             * Once called, the wire label is filled as the "zero_wire" or as the "one_wire", depending if the desired value is 0 
-             * or 1, respectively.
-             * 
-             * This function supports a 8 bit value as input, however, only the least signiticant bit is taken into account. For
-             * example, if the user inputs a value of 254 (11111110), the wire is assumed to have the value of 0.
-             * 
-             * @note This function should only be used after starting the circuit writing (after using the start() method).
-             * Otherwise, this function will not behave as expected.
+             * This check raises a runtime expection if the variable size does exceed the total of available output wires.
              * 
-             * @param wire Wire reference to assign a value to.
-             * @param value Value that the wire will have.
+             * @param size Number of wires to evaluate.
             **/
-            void assign_value(Wire& wire, uint8_t value);
+            void _assert_add_output(uint64_t size);
 
             /**
-             * @brief Assigns a value to a inputed variable.
+             * @brief Checks if the shadow evaluation is enabled.
              * 
              * -----
              * 
-             * A variable can have any value the user wants, as long as it have enough wires to assign values to.
-             * Whenever it is needed to have a variable with a constant value, this function should be used.
-             * Once called, each variable wire will be filled as the "zero_wire" or as the "one_wire", depending if the value bit
-             * is 0 or 1, respectively.
+             * This check raises a runtime expection if the shadow evaluation is disabled.
+            **/
+            void _assert_shadow() const;
+
+            /**
+             * @brief Checks if one more wire fits in the circuit.
              * 
-             * This function supports a 64 bit value as input, but the variable does not have to have 64 bits. Only the least
-             * signiticant bits is taken into account.
-             *
-             * @note This function should only be used after starting the circuit writing (after using the start() method).
-             * Otherwise, this function will not behave as expected.
+             * -----
              * 
-             * @param variable Variable reference to assign a value to.
-             * @param value Value that the variable will have.
+             * This check raises a runtime expection if the label of the next wire does not fit in the label type, which happens
+             * when the circuit would exceed 2^32 - 1 wires and the library was not built with the BCGEN_64BIT_LABELS option.
             **/
-            void assign_value(Variable& variable, uint64_t value);
+            void _assert_new_label() const;
+        
+        // Constructors | Destructor
+        protected:
+            /** @brief Default construction of a new Circuit Generator object is deleted. **/
+            CircuitGenerator() = delete;
 
             /**
-             * @brief Shift variable wires to the left. Output overrides the input variable.
+             * @brief Construct a new Circuit Generator object for a specified circuit name and location.
              * 
              * -----
              * 
-             * This function shifts the variable wires towards the left. This means that each wire is increasing its significance
-             * by X, being X the amount of bits to shift.
-             * The next wires that appear on the right are automatically assigned to have a wire value of 0 (zero_wire of the
-             * circuit).
+             * In the end, the generated circuit file will have the name of the inserted circuit name and located into the
+             * inserted location.
              * 
-             * The following example shows the expected behavior of the function:
+             * @note By default, the directory to the circuits is located at a circuits directory that should be in the same level
+             * from where the executable is being executed.
              * 
-             * ```
-             * Input variable value: 13
-             * Shifting amount: 3
+             * @param circuit_name Name of the circuit.
+             * @param circuits_directory Location of the circuit.
+            **/
+            CircuitGenerator(const std::string &circuit_name, const std::string &circuits_directory = "circuits");
+
+            /** @brief Destroy the Circuit Generator object. **/
+            ~CircuitGenerator();
+
+        // Abstract Methods
+        protected:
+            /**
+             * @brief Writes the header section of the circuit into a file.
              * 
-             *          Shifting
-             * 00001101 -------> 01101000
-             * ```
+             * -----
              * 
-             * @param variable Input & Output variable.
-             * @param amount Amount of bits to shift.
+             * By default, this function is empty. It is meant to be overritten by any circuit generator class that extends from
+             * this one.
+             * 
+             * @param file File to write.
             **/
-            void shift_left(Variable& variable, uint64_t amount);
+            virtual void _write_header(std::ofstream& file);
 
             /**
-             * @brief Shift variable wires to the left. Output does not override initial variable.
+             * @brief Writes the circuit section of the circuit into a file.
              * 
              * -----
              * 
-             * This function shifts the variable wires towards the left. This means that each wire is increasing its significance
-             * by X, being X the amount of bits to shift.
-             * The next wires that appear on the right are automatically assigned to have a wire value of 0 (zero_wire of the
-             * circuit).
+             * By default, this function is performs the write of the circuit section exactly how it should be. However, it is
+             * placed as abstract in case any child class needs to change its behavior.
              * 
-             * The following example shows the expected behavior of the function:
+             * @param file File to write.
+            **/
+            virtual void _write_circuit(std::ofstream& file);
+
+        // Generator Options
+        public:
+            /**
+             * @brief Sets a buffer size limit to the internal buffer.
              * 
-             * ```
-             * Input variable value: 13
-             * Shifting amount: 3
+             * -----
              * 
-             *          Shifting
-             * 00001101 -------> 01101000
-             * ```
+             * By default, the circuit generator caches all the generated data until it is written into a circuit file, which is
+             * the last step. However, this can be a problem in several machines that are more RAM limited. In those cases, this
+             * function can be used to set a buffer limit to write into the circuit file once the buffer reaches a specified size.
+             * The size is in bytes.
              * 
-             * @param variable Input & Output variable.
-             * @param amount Amount of bits to shift.
-             * @param output Shifted output.
+             * @param size Size of the buffer.
             **/
-            void shift_left(const Variable& variable, uint64_t amount, Variable& output);
+            void limit_buffer(uint64_t size);
 
             /**
-             * @brief Shift variable wires to the right. Output overrides the input variable.
+             * @brief Enables or disables the reuse of the labels of dead wires.
              * 
              * -----
              * 
-             * This function shifts the variable wires towards the right. This means that each wire is decreasing its significance
-             * by X, being X the amount of bits to shift.
-             * The next wires that appear on the left are automatically assigned to have a wire value of 0 (zero_wire of the
-             * circuit).
+             * By default, every wire of the circuit has its own label, thus an evaluator needs memory for every wire of the
+             * circuit. With the labels reuse enabled, the labels of the wires that are no longer read are given to new wires, and
+             * the number of wires of the circuit file is the maximum number of wires alive at the same time. This allows huge
+             * circuits to be evaluated in bounded memory.
              * 
-             * The following example shows the expected behavior of the function:
+             * The gates are kept in memory until the circuit is complete, since the last use of a wire is only known then. The
+             * labels of the circuit variables are not changed, thus the depth and the shadow evaluation methods keep working.
              * 
-             * ```
-             * Input variable value: 55
-             * Shifting amount: 3
+             * @note A wire can be written more than once in a circuit with reused labels, thus its gates must be evaluated in
+             * the file order. Bristol Fashion circuits do not batch their AND gates in this mode.
              * 
-             *          Shifting
-             * 00110111 -------> 00000110
-             * ```
+             * @note This function should only be used before starting the circuit writing (before using the start() method).
              * 
-             * @param variable Input & Output variable.
-             * @param amount Amount of bits to shift.
+             * @param enable True to reuse the labels of dead wires, false otherwise.
             **/
-            void shift_right(Variable& variable, uint64_t amount);
+            void reuse_labels(bool enable);
 
             /**
-             * @brief Shift variable wires to the right. Output does not override initial variable.
+             * @brief Enables or disables the scheduling of the circuit gates.
              * 
              * -----
              * 
-             * This function shifts the variable wires towards the right. This means that each wire is decreasing its significance
-             * by X, being X the amount of bits to shift.
-             * The next wires that appear on the left are automatically assigned to have a wire value of 0 (zero_wire of the
-             * circuit).
-             * 
-             * The following example shows the expected behavior of the function:
+             * By default, the gates are written in the order they are created, which follows the order of the code that creates
+             * them. Consecutive gates often read wires created far apart in the circuit, which causes cache misses in the
+             * evaluators. With the gates scheduling enabled, the gates are kept in memory until the circuit is complete, and are
+             * then reordered (the readers of a wire are placed right after its writer) and relabeled so that every wire is read
+             * close to where it is written. The input wires stay the first wires and the output wires the last ones.
              * 
-             * ```
-             * Input variable value: 55
-             * Shifting amount: 3
+             * The reuse distances before and after the scheduling are reported once the circuit is complete, and can be queried
+             * with the schedule_report method.
              * 
-             *          Shifting
-             * 00110111 -------> 00000110
-             * ```
+             * @note This function should only be used before starting the circuit writing (before using the start() method).
              * 
-             * @param variable Input & Output variable.
-             * @param amount Amount of bits to shift.
-             * @param output Shifted output.
+             * @param enable True to schedule the circuit gates, false otherwise.
             **/
-            void shift_right(const Variable& variable, uint64_t amount, Variable& output);
+            void schedule_gates(bool enable);
 
             /**
-             * @brief Rotates variable wires to the left. Output overrides the input variable.
+             * @brief Gets the reuse distances of the circuit before and after its gates were scheduled.
+             * @note The report is only available once a circuit with the gates scheduling enabled is complete.
+             * @return Schedule report.
+            **/
+            const ScheduleReport& schedule_report() const;
+
+            /**
+             * @brief Enables or disables the log depth comparators.
              * 
              * -----
              * 
-             * This function rotates the variable wires towards the left. This is similar to the shift left method except that the
-             * most left wires will be placed back on the right of the variable. This means that, for each rotated bit, every wire
-             * is increasing its significance except the most significant one, which is rotated back to the right, being the least
-             * significat wire now.
-             * 
-             * The following example shows the expected behavior of the function:
-             * 
-             * ```
-             * Input variable value: 205
-             * Rotation amount: 3
+             * By default, the comparison operations (greater, smaller, their "or equal" variants and the comparators) are built
+             * on a borrow chain that costs one AND gate per bit, and the equality on a chain of OR gates. Both chains have an AND
+             * depth as big as the variables size. With the log depth comparators enabled, both are built as balanced trees
+             * instead, which have a logarithmic AND depth but cost about three times more AND gates for the comparisons.
              * 
-             *          Shifting
-             * 11001101 -------> 01101110
-             * ```
+             * @note This function only affects the operations created after its use.
              * 
-             * @param variable Input & Output variable.
-             * @param amount Amount of bits to rotate.
+             * @param enable True to build log depth comparators, false otherwise.
             **/
-            void rotate_left(Variable& variable, uint64_t amount);
+            void log_depth_comparators(bool enable);
 
             /**
-             * @brief Rotates variable wires to the left. Output does not override initial variable.
+             * @brief Enables or disables the depth tracking of the circuit wires.
              * 
              * -----
              * 
-             * This function rotates the variable wires towards the left. This is similar to the shift left method except that the
-             * most left wires will be placed back on the right of the variable. This means that, for each rotated bit, every wire
-             * is increasing its significance except the most significant one, which is rotated back to the right, being the least
-             * significat wire now.
-             * 
-             * The following example shows the expected behavior of the function:
-             * 
-             * ```
-             * Input variable value: 205
-             * Rotation amount: 3
+             * By default, the circuit generator only counts the gates of the circuit. With the depth tracking enabled, the depth
+             * and the AND depth of every wire are also computed as the gates are written, which can be queried with the depth
+             * method. The circuit depth is also reported once the circuit is complete.
              * 
-             *          Shifting
-             * 11001101 -------> 01101110
-             * ```
+             * @note This function should only be used before starting the circuit writing (before using the start() method).
              * 
-             * @param variable Input & Output variable.
-             * @param amount Amount of bits to rotate.
-             * @param output Rotated output.
+             * @param enable True to track the wires depths, false otherwise.
             **/
-            void rotate_left(const Variable& variable, uint64_t amount, Variable& output);
+            void track_depth(bool enable);
 
             /**
-             * @brief Rotates variable wires to the right. Output overrides the input variable.
+             * @brief Gets the depth of a wire.
              * 
              * -----
              * 
-             * This function rotates the variable wires towards the right. This is similar to the shift right method except that
-             * the most right wires will be placed back on the left of the variable. This means that, for each rotated bit, every
-             * wire is decreasing its significance except the least significant one, which is rotated back to the left, being the
-             * most significat wire now.
+             * This function raises a runtime exception if the depth tracking is disabled.
              * 
-             * The following example shows the expected behavior of the function:
+             * @param wire Wire to get the depth of.
+             * @return Depth and AND depth of the wire.
+            **/
+            Depth depth(const Wire& wire) const;
+
+            /**
+             * @brief Gets the depth of a variable.
              * 
-             * ```
-             * Input variable value: 205
-             * Rotation amount: 3
+             * -----
              * 
-             *          Shifting
-             * 11001101 -------> 10111001
-             * ```
+             * The depth of a variable is the depth of its deepest wire, and its AND depth is the AND depth of the wire with the
+             * most AND gates. This function raises a runtime exception if the depth tracking is disabled.
              * 
-             * @param variable Input & Output variable.
-             * @param amount Amount of bits to rotate.
+             * @param variable Variable to get the depth of.
+             * @return Depth and AND depth of the variable.
             **/
-            void rotate_right(Variable& variable, uint64_t amount);
+            Depth depth(const Variable& variable) const;
 
             /**
-             * @brief Rotates variable wires to the right. Output does not override initial variable.
+             * @brief Enables or disables the profiling of the gates costs.
              * 
              * -----
              * 
-             * This function rotates the variable wires towards the right. This is similar to the shift right method except that
-             * the most right wires will be placed back on the left of the variable. This means that, for each rotated bit, every
-             * wire is decreasing its significance except the least significant one, which is rotated back to the left, being the
-             * most significat wire now.
-             * 
-             * The following example shows the expected behavior of the function:
-             * 
-             * ```
-             * Input variable value: 205
-             * Rotation amount: 3
+             * With the profiling enabled, every gate is attributed to the call path of profiling scopes in which it was written.
+             * All the library operations (sum, multiply_u, greater_s, ...) open a scope with their name, and user code can open
+             * its own scopes with the ProfileScope class. The gates, AND gates, wires, depth and AND depth of every call path can be
+             * reported with the profile_folded and profile_json methods, and both reports are written next to the circuit file
+             * once the circuit is complete.
              * 
-             *          Shifting
-             * 11001101 -------> 10111001
-             * ```
+             * @note Enabling the profiling also enables the depth tracking.
+             * @note This function should only be used before starting the circuit writing (before using the start() method).
              * 
-             * @param variable Input & Output variable.
-             * @param amount Amount of bits to rotate.
-             * @param output Rotated output.
+             * @param enable True to profile the gates costs, false otherwise.
             **/
-            void rotate_right(const Variable& variable, uint64_t amount, Variable& output);
+            void profile(bool enable);
 
             /**
-             * @brief Flips variable wires. Output overrides the input variable.
+             * @brief Creates the folded stacks report of the profiling.
              * 
              * -----
              * 
-             * This function flips the variable wires. The flipping behavior can be compared to a mirror, i.e., the most left
-             * wires will be placed as the most right wires and vice-versa.
-             * 
-             * The following example shows the expected behavior of the function:
+             * Every line of the report is a call path of scopes, separated by semicolons and ending with a gate name, followed by
+             * the amount of gates of that type written in that call path. This is the input format of flame graph tools.
              * 
              * ```
-             * Input variable value: 13
-             * Rotation amount: 3
-             * 
-             *          Shifting
-             * 00001101 -------> 10110000
+             * circuit;multiply_u;sum;AND 42
              * ```
              * 
-             * @param variable Input & Output variable.
+             * @return Folded stacks report.
             **/
-            void flip(Variable& variable);
+            std::string profile_folded() const;
 
             /**
-             * @brief Flips variable wires. Output does not override initial variable.
+             * @brief Creates the JSON summary of the profiling.
              * 
              * -----
              * 
-             * This function flips the variable wires. The flipping behavior can be compared to a mirror, i.e., the most left
-             * wires will be placed as the most right wires and vice-versa.
+             * The summary is a tree of scopes. Each scope has its number of calls, its total (scope and children) gates, AND
+             * gates, wires, depth and AND depth, the gates written directly in the scope ("self") and its children scopes.
              * 
-             * The following example shows the expected behavior of the function:
+             * @return JSON summary.
+            **/
+            std::string profile_json() const;
+
+            /**
+             * @brief Enables or disables the shadow evaluation of the circuit.
              * 
-             * ```
-             * Input variable value: 13
-             * Rotation amount: 3
+             * -----
              * 
-             *          Shifting
-             * 00001101 -------> 10110000
-             * ```
+             * With the shadow evaluation enabled, every gate is also evaluated in cleartext as it is written. Each wire carries
+             * 64 independent evaluation lanes (bit-sliced, as the evaluate_batch method of the circuit tester), which are given to
+             * the input wires with the add_input methods and can be read from any wire or variable with the value and lanes
+             * methods, at any point of the circuit writing. This allows to check the correctness of a circuit without writing,
+             * parsing and running the circuit file.
              * 
-             * @param variable Input & Output variable.
-             * @param output Flipped output.
+             * @note This function should only be used before adding the circuit inputs (before using the add_input methods).
+             * 
+             * @param enable True to evaluate the circuit as it is written, false otherwise.
             **/
-            void flip(const Variable& variable, Variable& output);
+            void shadow(bool enable);
 
             /**
-             * @brief Performs the 2's complement to a variable. Output overrides the input variable.
+             * @brief Gets the shadow value of a wire in one evaluation lane.
              * 
              * -----
              * 
-             * This function performs the 2's complement to the input variable. This operation is used to changed the sign of the
-             * variable, i.e, change -X to X and vice-versa. To perform this operation, all the wires of the variable have to be
-             * negated (1's complement), and then add the varaible 1 to that result.
+             * This function raises a runtime exception if the shadow evaluation is disabled.
              * 
-             * The following example shows the expected behavior of the function:
+             * @param wire Wire to get the value of.
+             * @param lane Evaluation lane (0 to 63).
+             * @return Value of the wire.
+            **/
+            bool value(const Wire& wire, uint64_t lane = 0) const;
+
+            /**
+             * @brief Gets the shadow value of a variable in one evaluation lane.
              * 
-             * ```
-             * Input variable value: 13
-             * Output variable value: -13
+             * -----
              * 
-             *          2's comp
-             * 00001101 -------> 11110011
-             * ```
+             * The i-th wire of the variable is the i-th bit of the returned value. This function raises a runtime exception if the
+             * shadow evaluation is disabled, or if the variable has more than 64 wires (use the lanes method instead).
              * 
-             * @param variable Input & Output variable.
+             * @param variable Variable to get the value of.
+             * @param lane Evaluation lane (0 to 63).
+             * @return Value of the variable.
             **/
-            void twos_complement(Variable& variable);
+            uint64_t value(const Variable& variable, uint64_t lane = 0) const;
 
             /**
-             * @brief Performs the 2's complement to a variable. Output does not override initial variable.
+             * @brief Gets the shadow values of a wire in all the evaluation lanes.
              * 
              * -----
              * 
-             * This function performs the 2's complement to the input variable. This operation is used to changed the sign of the
-             * variable, i.e, change -X to X and vice-versa. To perform this operation, all the wires of the variable have to be
-             * negated (1's complement), and then add the varaible 1 to that result.
+             * The bit k of the returned value is the wire value in the k-th lane. This function raises a runtime exception if the
+             * shadow evaluation is disabled.
              * 
-             * The following example shows the expected behavior of the function:
+             * @param wire Wire to get the values of.
+             * @return Values of the wire in the 64 lanes.
+            **/
+            uint64_t lanes(const Wire& wire) const;
+
+            /**
+             * @brief Gets the shadow values of a variable in all the evaluation lanes.
              * 
-             * ```
-             * Input variable value: 13
-             * Output variable value: -13
+             * -----
              * 
-             *          2's comp
-             * 00001101 -------> 11110011
-             * ```
+             * The returned list has one entry per wire of the variable, with the same layout of the lanes method for a wire. This
+             * function raises a runtime exception if the shadow evaluation is disabled.
              * 
-             * @param variable Input & Output variable.
-             * @param output 2's complement output.
+             * @param variable Variable to get the values of.
+             * @return Values of the variable wires in the 64 lanes.
             **/
-            void twos_complement(const Variable& variable, Variable& output);
+            std::vector<uint64_t> lanes(const Variable& variable) const;
 
-        // Basic operations
+        // Circuit Setup
         public:
             /**
-             * @brief XOR operation between two wires (bits).
+             * @brief Adds an input party to the circuit.
              * 
              * -----
              * 
-             * An XOR gate is represented by following truth table:
+             * This function adds a new input party and registers its size into a vector of input parties. The inserted party size
+             * will increase the number of available input variables that can be used to add input variables. This size is also
+             * important in the writing phase.
              * 
-             * | \f$A\f$ | \f$B\f$ | \f$XOR\f$ |
-             * | :-----: | :-----: | :-------: |
-             * | 0       | 0       | 0         |
-             * | 0       | 0       | 1         |
-             * | 0       | 1       | 1         |
-             * | 0       | 1       | 0         |
+             * @note This function should only be used before starting the circuit writing (after using the start() method).
+             * Otherwise, this function will not behave as expected.
              * 
-             * @param in_a Input wire \f$A\f$.
-             * @param in_b Input wire \f$B\f$.
-             * @param out Output wire.
+             * @param size Size of the input party.
             **/
-            void XOR(const Wire in_a, const Wire in_b, Wire& out);
-            
+            void add_input_party(uint64_t size);
+
             /**
-             * @brief XOR operation between two variables.
+             * @brief Adds an output party to the circuit.
              * 
              * -----
              * 
-             * An XOR gate is represented by following truth table:
+             * This function adds a new output party and registers its size into a vector of output parties.
              * 
-             * | \f$A\f$ | \f$B\f$ | \f$XOR\f$ |
-             * | :-----: | :-----: | :-------: |
-             * | 0       | 0       | 0         |
-             * | 0       | 0       | 1         |
-             * | 0       | 1       | 1         |
-             * | 0       | 1       | 0         |
+             * @note This function should only be used before starting the circuit writing (after using the start() method).
+             * Otherwise, this function will not behave as expected.
              * 
-             * @param in_a Input variable \f$A\f$.
-             * @param in_b Input variable \f$B\f$.
-             * @param out Output variable.
+             * @param size Size of the output party.
             **/
-            void XOR(const Variable& in_a, const Variable& in_b, Variable& out);
+            void add_output_party(uint64_t size);
 
             /**
-             * @brief AND operation between two wires (bits).
+             * @brief Adds a wire as a circuit input.
              * 
              * -----
              * 
-             * An AND gate is represented by following truth table:
-             * 
-             * | \f$A\f$ | \f$B\f$ | \f$AND\f$ |
-             * | :-----: | :-----: | :-------: |
+             * This will assign a label to the inputed wire.
+             * This function expects that there is at least one avaliable input wire to be assigned into the input wire. The
+             * amount of circuit input wires is manageable by the add_input_party function.
+             * In case there is not an available wire, this function will raise a runtime exception.
+             * 
+             * @note This function should only be used before starting the circuit writing (before using the start() method).
+             * Otherwise, this function will not behave as expected.
+             * 
+             * @param wire Input wire in the circuit.
+            **/
+            void add_input(Wire& wire);
+
+            /**
+             * @brief Adds a variable as a circuit input.
+             * 
+             * -----
+             * 
+             * This will assign labels to all the wires inside the inputed variable.
+             * This function expects that there are enough avaliable input wires to be assigned into the input variable. The
+             * amount of circuit input wires is manageable by the add_input_party function.
+             * In case there are not enough input wires, this function will raise a runtime exception.
+             * 
+             * @note This function should only be used before starting the circuit writing (before using the start() method).
+             * Otherwise, this function will not behave as expected.
+             * 
+             * @param variable Input variable in the circuit.
+            **/
+            void add_input(Variable& variable);
+
+            /**
+             * @brief Adds a wire as a circuit input, with a value for the shadow evaluation.
+             * 
+             * -----
+             * 
+             * This function behaves as the add_input method, and gives the same value to the wire in all the evaluation lanes.
+             * This function raises a runtime exception if the shadow evaluation is disabled.
+             * 
+             * @param wire Input wire in the circuit.
+             * @param value Value of the wire.
+            **/
+            void add_input(Wire& wire, bool value);
+
+            /**
+             * @brief Adds a variable as a circuit input, with a value for the shadow evaluation.
+             * 
+             * -----
+             * 
+             * This function behaves as the add_input method, and gives the same value to the variable in all the evaluation
+             * lanes. The i-th bit of the value is given to the i-th wire of the variable, and wires above the 64th are zero.
+             * This function raises a runtime exception if the shadow evaluation is disabled.
+             * 
+             * @param variable Input variable in the circuit.
+             * @param value Value of the variable.
+            **/
+            void add_input(Variable& variable, uint64_t value);
+
+            /**
+             * @brief Adds a variable as a circuit input, with different values in each shadow evaluation lane.
+             * 
+             * -----
+             * 
+             * This function behaves as the add_input method. The lanes list has one entry per wire of the variable, where the bit
+             * k of an entry is the wire value in the k-th evaluation lane. This function raises a runtime exception if the shadow
+             * evaluation is disabled, or if the lanes list does not have the variable size.
+             * 
+             * @param variable Input variable in the circuit.
+             * @param lanes Values of the variable wires in the 64 lanes.
+            **/
+            void add_input_lanes(Variable& variable, const std::vector<uint64_t>& lanes);
+
+            /**
+             * @brief Adds a wire as a circuit output.
+             * 
+             * -----
+             * 
+             * This will cache the input wire in a class member, which will be used in the very last step of the circuit
+             * writing (stop method).
+             * This function expects that there is at least one avaliable output wire. The amount of circuit output wires is
+             * manageable by the add_output_party function.
+             * In case there is not an available expected output wire, this function will raise a runtime exception.
+             * 
+             * Unlike the add_input function, this one will not assign a label to the inputed wire.
+             * 
+             * @note This function should only be used before starting the circuit writing (before using the start() method).
+             * Otherwise, this function will not behave as expected.
+             * 
+             * @param wire Output wire in the circuit.
+            **/
+            void add_output(Wire& wire);
+
+            /**
+             * @brief Adds a variable as a circuit output.
+             * 
+             * -----
+             * 
+             * This will cache the input wire in a class member, which will be used in the very last step of the circuit
+             * writing (stop method).
+             * This function expects that there is at least one avaliable output wire. The amount of circuit output wires is
+             * manageable by the add_output_party function.
+             * In case there is not an available expected output wire, this function will raise a runtime exception.
+             * 
+             * Unlike the add_input function, this one will not assign a label to the inputed wire.
+             * 
+             * @note This function should only be used before starting the circuit writing (before using the start() method).
+             * Otherwise, this function will not behave as expected.
+             * 
+             * @param variable Output variable in the circuit.
+            **/
+            void add_output(Variable& variable);
+
+            /**
+             * @brief Starts the writing/construction of the circuit.
+             * 
+             * -----
+             * 
+             * This function makes sure that all the inputs of the circuit were correctly setup, i.e that there are inputs and
+             * that all the defined input wires were all assigned to input variables.
+             * If something is wrong with the initial setup, this function raises a runtime exception.
+             * 
+             * Once the validation checks pass, this function ends up by creating the zero and one wires, wich are constant wires
+             * that assume the value 0 and 1 in the circuit, respectively.
+             * 
+             * @note The add_input and add_input_party methods should not be used once this function is called.
+            **/
+            void start();
+
+            /**
+             * @brief Stops the writing/construction of the circuit.
+             * 
+             * -----
+             * 
+             * Once called, this function terminates the circuit construction and completes the writing into the circuit file,
+             * including defining correctly its header part, which is dependent of the total gates in the circuit.
+             * To conclude, it also prints into the console the total amount of gates and wires of the created circuit.
+            **/
+            void stop();
+
+        // Variables manipulation
+        public:
+            /**
+             * @brief Assigns a value to a inputed wire.
+             * 
+             * -----
+             * 
+             * A wire can have a value either 0 or 1. Whenever it is needed to have a wire with one of these constants, this
+             * function should be used.
+             * Once called, the wire label is filled as the "zero_wire" or as the "one_wire", depending if the desired value is 0 
+             * or 1, respectively.
+             * 
+             * This function supports a 8 bit value as input, however, only the least signiticant bit is taken into account. For
+             * example, if the user inputs a value of 254 (11111110), the wire is assumed to have the value of 0.
+             * 
+             * @note This function should only be used after starting the circuit writing (after using the start() method).
+             * Otherwise, this function will not behave as expected.
+             * 
+             * @param wire Wire reference to assign a value to.
+             * @param value Value that the wire will have.
+            **/
+            void assign_value(Wire& wire, uint8_t value);
+
+            /**
+             * @brief Assigns a value to a inputed variable.
+             * 
+             * -----
+             * 
+             * A variable can have any value the user wants, as long as it have enough wires to assign values to.
+             * Whenever it is needed to have a variable with a constant value, this function should be used.
+             * Once called, each variable wire will be filled as the "zero_wire" or as the "one_wire", depending if the value bit
+             * is 0 or 1, respectively.
+             * 
+             * This function supports a 64 bit value as input, but the variable does not have to have 64 bits. Only the least
+             * signiticant bits is taken into account.
+             *
+             * @note This function should only be used after starting the circuit writing (after using the start() method).
+             * Otherwise, this function will not behave as expected.
+             * 
+             * @param variable Variable reference to assign a value to.
+             * @param value Value that the variable will have.
+            **/
+            void assign_value(Variable& variable, uint64_t value);
+
+            /**
+             * @brief Shift variable wires to the left. Output overrides the input variable.
+             * 
+             * -----
+             * 
+             * This function shifts the variable wires towards the left. This means that each wire is increasing its significance
+             * by X, being X the amount of bits to shift.
+             * The next wires that appear on the right are automatically assigned to have a wire value of 0 (zero_wire of the
+             * circuit).
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 13
+             * Shifting amount: 3
+             * 
+             *          Shifting
+             * 00001101 -------> 01101000
+             * ```
+             * 
+             * @param variable Input & Output variable.
+             * @param amount Amount of bits to shift.
+            **/
+            void shift_left(Variable& variable, uint64_t amount);
+
+            /**
+             * @brief Shift variable wires to the left. Output does not override initial variable.
+             * 
+             * -----
+             * 
+             * This function shifts the variable wires towards the left. This means that each wire is increasing its significance
+             * by X, being X the amount of bits to shift.
+             * The next wires that appear on the right are automatically assigned to have a wire value of 0 (zero_wire of the
+             * circuit).
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 13
+             * Shifting amount: 3
+             * 
+             *          Shifting
+             * 00001101 -------> 01101000
+             * ```
+             * 
+             * @param variable Input & Output variable.
+             * @param amount Amount of bits to shift.
+             * @param output Shifted output.
+            **/
+            void shift_left(const Variable& variable, uint64_t amount, Variable& output);
+
+            /**
+             * @brief Shift variable wires to the right. Output overrides the input variable.
+             * 
+             * -----
+             * 
+             * This function shifts the variable wires towards the right. This means that each wire is decreasing its significance
+             * by X, being X the amount of bits to shift.
+             * The next wires that appear on the left are automatically assigned to have a wire value of 0 (zero_wire of the
+             * circuit).
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 55
+             * Shifting amount: 3
+             * 
+             *          Shifting
+             * 00110111 -------> 00000110
+             * ```
+             * 
+             * @param variable Input & Output variable.
+             * @param amount Amount of bits to shift.
+            **/
+            void shift_right(Variable& variable, uint64_t amount);
+
+            /**
+             * @brief Shift variable wires to the right. Output does not override initial variable.
+             * 
+             * -----
+             * 
+             * This function shifts the variable wires towards the right. This means that each wire is decreasing its significance
+             * by X, being X the amount of bits to shift.
+             * The next wires that appear on the left are automatically assigned to have a wire value of 0 (zero_wire of the
+             * circuit).
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 55
+             * Shifting amount: 3
+             * 
+             *          Shifting
+             * 00110111 -------> 00000110
+             * ```
+             * 
+             * @param variable Input & Output variable.
+             * @param amount Amount of bits to shift.
+             * @param output Shifted output.
+            **/
+            void shift_right(const Variable& variable, uint64_t amount, Variable& output);
+
+            /**
+             * @brief Rotates variable wires to the left. Output overrides the input variable.
+             * 
+             * -----
+             * 
+             * This function rotates the variable wires towards the left. This is similar to the shift left method except that the
+             * most left wires will be placed back on the right of the variable. This means that, for each rotated bit, every wire
+             * is increasing its significance except the most significant one, which is rotated back to the right, being the least
+             * significat wire now.
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 205
+             * Rotation amount: 3
+             * 
+             *          Shifting
+             * 11001101 -------> 01101110
+             * ```
+             * 
+             * @param variable Input & Output variable.
+             * @param amount Amount of bits to rotate.
+            **/
+            void rotate_left(Variable& variable, uint64_t amount);
+
+            /**
+             * @brief Rotates variable wires to the left. Output does not override initial variable.
+             * 
+             * -----
+             * 
+             * This function rotates the variable wires towards the left. This is similar to the shift left method except that the
+             * most left wires will be placed back on the right of the variable. This means that, for each rotated bit, every wire
+             * is increasing its significance except the most significant one, which is rotated back to the right, being the least
+             * significat wire now.
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 205
+             * Rotation amount: 3
+             * 
+             *          Shifting
+             * 11001101 -------> 01101110
+             * ```
+             * 
+             * @param variable Input & Output variable.
+             * @param amount Amount of bits to rotate.
+             * @param output Rotated output.
+            **/
+            void rotate_left(const Variable& variable, uint64_t amount, Variable& output);
+
+            /**
+             * @brief Rotates variable wires to the right. Output overrides the input variable.
+             * 
+             * -----
+             * 
+             * This function rotates the variable wires towards the right. This is similar to the shift right method except that
+             * the most right wires will be placed back on the left of the variable. This means that, for each rotated bit, every
+             * wire is decreasing its significance except the least significant one, which is rotated back to the left, being the
+             * most significat wire now.
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 205
+             * Rotation amount: 3
+             * 
+             *          Shifting
+             * 11001101 -------> 10111001
+             * ```
+             * 
+             * @param variable Input & Output variable.
+             * @param amount Amount of bits to rotate.
+            **/
+            void rotate_right(Variable& variable, uint64_t amount);
+
+            /**
+             * @brief Rotates variable wires to the right. Output does not override initial variable.
+             * 
+             * -----
+             * 
+             * This function rotates the variable wires towards the right. This is similar to the shift right method except that
+             * the most right wires will be placed back on the left of the variable. This means that, for each rotated bit, every
+             * wire is decreasing its significance except the least significant one, which is rotated back to the left, being the
+             * most significat wire now.
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 205
+             * Rotation amount: 3
+             * 
+             *          Shifting
+             * 11001101 -------> 10111001
+             * ```
+             * 
+             * @param variable Input & Output variable.
+             * @param amount Amount of bits to rotate.
+             * @param output Rotated output.
+            **/
+            void rotate_right(const Variable& variable, uint64_t amount, Variable& output);
+
+            /**
+             * @brief Flips variable wires. Output overrides the input variable.
+             * 
+             * -----
+             * 
+             * This function flips the variable wires. The flipping behavior can be compared to a mirror, i.e., the most left
+             * wires will be placed as the most right wires and vice-versa.
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 13
+             * Rotation amount: 3
+             * 
+             *          Shifting
+             * 00001101 -------> 10110000
+             * ```
+             * 
+             * @param variable Input & Output variable.
+            **/
+            void flip(Variable& variable);
+
+            /**
+             * @brief Flips variable wires. Output does not override initial variable.
+             * 
+             * -----
+             * 
+             * This function flips the variable wires. The flipping behavior can be compared to a mirror, i.e., the most left
+             * wires will be placed as the most right wires and vice-versa.
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 13
+             * Rotation amount: 3
+             * 
+             *          Shifting
+             * 00001101 -------> 10110000
+             * ```
+             * 
+             * @param variable Input & Output variable.
+             * @param output Flipped output.
+            **/
+            void flip(const Variable& variable, Variable& output);
+
+            /**
+             * @brief Performs the 2's complement to a variable. Output overrides the input variable.
+             * 
+             * -----
+             * 
+             * This function performs the 2's complement to the input variable. This operation is used to changed the sign of the
+             * variable, i.e, change -X to X and vice-versa. To perform this operation, all the wires of the variable have to be
+             * negated (1's complement), and then add the varaible 1 to that result.
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 13
+             * Output variable value: -13
+             * 
+             *          2's comp
+             * 00001101 -------> 11110011
+             * ```
+             * 
+             * @param variable Input & Output variable.
+            **/
+            void twos_complement(Variable& variable);
+
+            /**
+             * @brief Performs the 2's complement to a variable. Output does not override initial variable.
+             * 
+             * -----
+             * 
+             * This function performs the 2's complement to the input variable. This operation is used to changed the sign of the
+             * variable, i.e, change -X to X and vice-versa. To perform this operation, all the wires of the variable have to be
+             * negated (1's complement), and then add the varaible 1 to that result.
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 13
+             * Output variable value: -13
+             * 
+             *          2's comp
+             * 00001101 -------> 11110011
+             * ```
+             * 
+             * @param variable Input & Output variable.
+             * @param output 2's complement output.
+            **/
+            void twos_complement(const Variable& variable, Variable& output);
+
+        // Basic operations
+        public:
+            /**
+             * @brief XOR operation between two wires (bits).
+             * 
+             * -----
+             * 
+             * An XOR gate is represented by following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$XOR\f$ |
+             * | :-----: | :-----: | :-------: |
+             * | 0       | 0       | 0         |
+             * | 0       | 0       | 1         |
+             * | 0       | 1       | 1         |
+             * | 0       | 1       | 0         |
+             * 
+             * @param in_a Input wire \f$A\f$.
+             * @param in_b Input wire \f$B\f$.
+             * @param out Output wire.
+            **/
+            void XOR(const Wire in_a, const Wire in_b, Wire& out);
+            
+            /**
+             * @brief XOR operation between two variables.
+             * 
+             * -----
+             * 
+             * An XOR gate is represented by following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$XOR\f$ |
+             * | :-----: | :-----: | :-------: |
+             * | 0       | 0       | 0         |
+             * | 0       | 0       | 1         |
+             * | 0       | 1       | 1         |
+             * | 0       | 1       | 0         |
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out Output variable.
+            **/
+            void XOR(const Variable& in_a, const Variable& in_b, Variable& out);
+
+            /**
+             * @brief AND operation between two wires (bits).
+             * 
+             * -----
+             * 
+             * An AND gate is represented by following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$AND\f$ |
+             * | :-----: | :-----: | :-------: |
+             * | 0       | 0       | 0         |
+             * | 0       | 0       | 0         |
+             * | 0       | 1       | 0         |
+             * | 0       | 1       | 1         |
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out Output variable.
+            **/
+            void AND(const Wire in_a, const Wire in_b, Wire& out);
+
+            /**
+             * @brief AND operation between two variables.
+             * 
+             * -----
+             * 
+             * An AND gate is represented by following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$AND\f$ |
+             * | :-----: | :-----: | :-------: |
              * | 0       | 0       | 0         |
              * | 0       | 0       | 0         |
              * | 0       | 1       | 0         |
@@ -860,428 +1931,943 @@ namespace gabe {
              * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
-             * @param out Output variable.
+             * @param out Output variable.
+            **/
+            void AND(const Variable& in_a, const Variable& in_b, Variable& out);
+            
+            /**
+             * @brief OR operation between two wires (bits).
+             * 
+             * -----
+             * 
+             * An OR gate is represented by following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$OR\f$ |
+             * | :-----: | :-----: | :------: |
+             * | 0       | 0       | 0        |
+             * | 0       | 0       | 1        |
+             * | 0       | 1       | 1        |
+             * | 0       | 1       | 1        |
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out Output variable.
+            **/
+            void OR(const Wire in_a, const Wire in_b, Wire& out);
+
+            /**
+             * @brief OR operation between two variables.
+             * 
+             * -----
+             * 
+             * An OR gate is represented by following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$OR\f$ |
+             * | :-----: | :-----: | :------: |
+             * | 0       | 0       | 0        |
+             * | 0       | 0       | 1        |
+             * | 0       | 1       | 1        |
+             * | 0       | 1       | 1        |
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out Output variable.
+            **/
+            void OR(const Variable& in_a, const Variable& in_b, Variable& out);
+
+            /**
+             * @brief INV operation between two wires (bits).
+             * 
+             * -----
+             * 
+             * An INV gate is represented by following truth table:
+             * 
+             * | \f$A\f$ | \f$INV\f$ |
+             * | :-----: | :-------: |
+             * | 0       | 1         |
+             * | 1       | 0         |
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param out Output variable.
+            **/
+            void INV(const Wire in_a, Wire& out);
+
+            /**
+             * @brief INV operation between two variables.
+             * 
+             * -----
+             * 
+             * An INV gate is represented by following truth table:
+             * 
+             * | \f$A\f$ | \f$INV\f$ |
+             * | :-----: | :-------: |
+             * | 0       | 1         |
+             * | 1       | 0         |
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param out Output variable.
+            **/
+            void INV(const Variable& in_a, Variable& out);
+
+            /**
+             * @brief XNOR operation between two wires (bits).
+             * 
+             * -----
+             * 
+             * An XNOR operation is represented by following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$XNOR\f$ |
+             * | :-----: | :-----: | :--------: |
+             * | 0       | 0       | 1          |
+             * | 0       | 0       | 0          |
+             * | 0       | 1       | 0          |
+             * | 0       | 1       | 1          |
+             * 
+             * However, the XNOR is not a basic logic gate. It is, in fact, an operation that makes use of two basic logic gate,
+             * i.e an XOR gate followed by an INV gate.
+             * This method exists just to agile the need to use these two operations in a single method call.
+             * 
+             * @param in_a Input wire \f$A\f$.
+             * @param in_b Input wire \f$B\f$.
+             * @param out Output wire.
+            **/
+            void XNOR(const Wire in_a, const Wire in_b, Wire& out);
+            
+            /**
+             * @brief XNOR operation between two variables.
+             * 
+             * -----
+             * 
+             * An XNOR operation is represented by following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$XNOR\f$ |
+             * | :-----: | :-----: | :--------: |
+             * | 0       | 0       | 1          |
+             * | 0       | 0       | 0          |
+             * | 0       | 1       | 0          |
+             * | 0       | 1       | 1          |
+             *
+             * However, the XNOR is not a basic logic gate. It is, in fact, an operation that makes use of two basic logic gate,
+             * i.e an XOR gate followed by an INV gate.
+             * This method exists just to agile the need to use these two operations in a single method call.
+             *
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out Output variable.
+            **/
+            void XNOR(const Variable& in_a, const Variable& in_b, Variable& out);
+
+            /**
+             * @brief NAND operation between two wires (bits).
+             * 
+             * -----
+             * 
+             * An NAND operation is represented by following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$XNOR\f$ |
+             * | :-----: | :-----: | :--------: |
+             * | 0       | 0       | 1          |
+             * | 0       | 0       | 1          |
+             * | 0       | 1       | 1          |
+             * | 0       | 1       | 0          |
+             * 
+             * However, the NAND is not a basic logic gate. It is, in fact, an operation that makes use of two basic logic gate,
+             * i.e an AND gate followed by an INV gate.
+             * This method exists just to agile the need to use these two operations in a single method call.
+             * 
+             * @param in_a Input wire \f$A\f$.
+             * @param in_b Input wire \f$B\f$.
+             * @param out Output wire.
+            **/
+            void NAND(const Wire in_a, const Wire in_b, Wire& out);
+            
+            /**
+             * @brief NAND operation between two wires (bits).
+             * 
+             * -----
+             * 
+             * An NAND operation is represented by following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$XNOR\f$ |
+             * | :-----: | :-----: | :--------: |
+             * | 0       | 0       | 1          |
+             * | 0       | 0       | 1          |
+             * | 0       | 1       | 1          |
+             * | 0       | 1       | 0          |
+             * 
+             * However, the NAND is not a basic logic gate. It is, in fact, an operation that makes use of two basic logic gate,
+             * i.e an AND gate followed by an INV gate.
+             * This method exists just to agile the need to use these two operations in a single method call.
+             * 
+             * @param in_a Input wire \f$A\f$.
+             * @param in_b Input wire \f$B\f$.
+             * @param out Output wire.
+            **/
+            void NAND(const Variable& in_a, const Variable& in_b, Variable& out);
+
+            /**
+             * @brief NOR operation between two wires (bits).
+             * 
+             * -----
+             * 
+             * An NOR operation is represented by following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$XNOR\f$ |
+             * | :-----: | :-----: | :--------: |
+             * | 0       | 0       | 1          |
+             * | 0       | 0       | 0          |
+             * | 0       | 1       | 0          |
+             * | 0       | 1       | 0          |
+             * 
+             * However, the NOR is not a basic logic gate. It is, in fact, an operation that makes use of two basic logic gate,
+             * i.e an OR gate followed by an INV gate.
+             * This method exists just to agile the need to use these two operations in a single method call.
+             * 
+             * @param in_a Input wire \f$A\f$.
+             * @param in_b Input wire \f$B\f$.
+             * @param out Output wire.
+            **/
+            void NOR(const Wire in_a, const Wire in_b, Wire& out);
+            
+            /**
+             * @brief NOR operation between two wires (bits).
+             * 
+             * -----
+             * 
+             * An NOR operation is represented by following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$XNOR\f$ |
+             * | :-----: | :-----: | :--------: |
+             * | 0       | 0       | 1          |
+             * | 0       | 0       | 0          |
+             * | 0       | 1       | 0          |
+             * | 0       | 1       | 0          |
+             * 
+             * However, the NOR is not a basic logic gate. It is, in fact, an operation that makes use of two basic logic gate,
+             * i.e an OR gate followed by an INV gate.
+             * This method exists just to agile the need to use these two operations in a single method call.
+             * 
+             * @param in_a Input wire \f$A\f$.
+             * @param in_b Input wire \f$B\f$.
+             * @param out Output wire.
+            **/
+            void NOR(const Variable& in_a, const Variable& in_b, Variable& out);
+
+        // Arithmetic operations
+        public:
+            /**
+             * @brief Binary addition between two variables, resulting in a new variable.
+             * 
+             * -----
+             * 
+             * @details Addition is one of the most basic operations performed and it is referred as a binary adder in logic
+             * circuits. There are two adder types: half adder, and full adder. This function is developed to target a binary
+             * addition that uses a full adder. A full adder is a combinational logic circuit that adds two binary input bits
+             * (\f$A\f$ and \f$B\f$), and a carry bit (\f$C_{in}\f$), resulting in a sum bit (\f$Sum\f$) and another carry bit
+             * (\f$C_{out}\f$). \f$C_{in}\f$ and \f$C_{out}\f$ are just the carry bits from the previous and to the next
+             * operation, respectively.
+             * 
+             * A logical adder is variable sign independent, which means it works the same way for signed and unsigned variables.
+             * 
+             * A full adder can be represented has the following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$C_{in}\f$ | \f$Sum\f$ | \f$C_{out}\f$ |
+             * | :-----: | :-----: | :----------: | :-------: | :-----------: |
+             * | 0       | 0       | 0            | 0         | 0             |
+             * | 0       | 0       | 1            | 1         | 0             |
+             * | 0       | 1       | 0            | 1         | 0             |
+             * | 0       | 1       | 1            | 0         | 1             |
+             * | 1       | 0       | 0            | 1         | 0             |
+             * | 1       | 0       | 1            | 0         | 1             |
+             * | 1       | 1       | 0            | 0         | 1             |
+             * | 1       | 1       | 1            | 1         | 1             |
+             * 
+             * The truth table translates a logical expression for both \f$Sum\f$ and \f$C_{out}\f$ outputs. These expressions can
+             * be further simplified, as follows:
+             * 
+             * \begin{align*}
+             *      Sum &= \overline{A}.\overline{B}.C_{in} + \overline{A}.B.\overline{C_{in}} + A.\overline{B}.\overline{C_{in}} + A.B.C_{in}\\\
+             *          &= C_{in}.(\overline{A}.\overline{B} + A.B) + \overline{C_{in}}.(\overline{A}.B + A.\overline{B})\\\
+             *          &= C_{in}.(\overline{A \oplus B}) + \overline{C_{in}}.(A \oplus B)\\\
+             *          &= C_{in} \oplus (A \oplus B)
+             * \end{align*}
+             *
+             * \begin{align*}
+             *      C_{out} &= \overline{A}.B.C_{in} + A.\overline{B}.C_{in} + A.B.\overline{C_{in}} + A.B.C_{in}\\\
+             *              &= C_{in}.(\overline{A}.B + A.\overline{B}) + A.B\\\
+             *              &= C_{in}.(A \oplus B) + A.B
+             * \end{align*}
+             * 
+             * The input variables can have any size. Only the bits of the output variable are computed: narrower input variables
+             * are zero extended to its size, wider ones are truncated, and the gates of the extension wires that are zero
+             * are not created.
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out Output variable \f$Sum\f$.
+            **/
+            void sum(const Variable& in_a, const Variable& in_b, Variable& out);
+
+            /**
+             * @brief Binary addition between two signed variables, resulting in a new variable.
+             * 
+             * -----
+             * 
+             * @details Addition is one of the most basic operations performed and it is referred as a binary adder in logic
+             * circuits. There are two adder types: half adder, and full adder. This function is developed to target a binary
+             * addition that uses a full adder. A full adder is a combinational logic circuit that adds two binary input bits
+             * (\f$A\f$ and \f$B\f$), and a carry bit (\f$C_{in}\f$), resulting in a sum bit (\f$Sum\f$) and another carry bit
+             * (\f$C_{out}\f$). \f$C_{in}\f$ and \f$C_{out}\f$ are just the carry bits from the previous and to the next
+             * operation, respectively.
+             * 
+             * A logical adder is variable sign independent, which means it works the same way for signed and unsigned variables.
+             * 
+             * A full adder can be represented has the following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$C_{in}\f$ | \f$Sum\f$ | \f$C_{out}\f$ |
+             * | :-----: | :-----: | :----------: | :-------: | :-----------: |
+             * | 0       | 0       | 0            | 0         | 0             |
+             * | 0       | 0       | 1            | 1         | 0             |
+             * | 0       | 1       | 0            | 1         | 0             |
+             * | 0       | 1       | 1            | 0         | 1             |
+             * | 1       | 0       | 0            | 1         | 0             |
+             * | 1       | 0       | 1            | 0         | 1             |
+             * | 1       | 1       | 0            | 0         | 1             |
+             * | 1       | 1       | 1            | 1         | 1             |
+             * 
+             * The truth table translates a logical expression for both \f$Sum\f$ and \f$C_{out}\f$ outputs. These expressions can
+             * be further simplified, as follows:
+             * 
+             * \begin{align*}
+             *      Sum &= \overline{A}.\overline{B}.C_{in} + \overline{A}.B.\overline{C_{in}} + A.\overline{B}.\overline{C_{in}} + A.B.C_{in}\\\
+             *          &= C_{in}.(\overline{A}.\overline{B} + A.B) + \overline{C_{in}}.(\overline{A}.B + A.\overline{B})\\\
+             *          &= C_{in}.(\overline{A \oplus B}) + \overline{C_{in}}.(A \oplus B)\\\
+             *          &= C_{in} \oplus (A \oplus B)
+             * \end{align*}
+             *
+             * \begin{align*}
+             *      C_{out} &= \overline{A}.B.C_{in} + A.\overline{B}.C_{in} + A.B.\overline{C_{in}} + A.B.C_{in}\\\
+             *              &= C_{in}.(\overline{A}.B + A.\overline{B}) + A.B\\\
+             *              &= C_{in}.(A \oplus B) + A.B
+             * \end{align*}
+             * 
+             * The input variables can have any size. Only the bits of the output variable are computed: narrower input variables
+             * are sign extended to its size, wider ones are truncated, and the gates of the extension wires that are zero
+             * are not created.
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out Output variable \f$Sum\f$.
+            **/
+            void sum_s(const Variable& in_a, const Variable& in_b, Variable& out);
+
+            /**
+             * @brief Binary subtraction between two variables, resulting in a new variable.
+             * 
+             * -----
+             * 
+             * @details Subtraction is one of the most basic operations performed and it is referred as a binary subtractor in
+             * logic circuits. There are two subtractor types: half subtractor, and full subtractor. This function is developed to
+             * target a binary subtraction that uses a full subtractor. A full subtractor is a combinational logic circuit that
+             * makes the difference between two binary input bits (\f$A\f$, minuend, and \f$B\f$, subtrahend), taken into account
+             * the borrow bit (\f$B_{in}\f$), resulting in a sub bit (\f$Sub\f$) and another borrow bit (\f$B_{out}\f$).
+             * \f$B_{in}\f$ and \f$B_{out}\f$ are just the borrow bits from the previous and to the next operation, respectively.
+             * 
+             * A logical subtractor is variable sign independent, which means it works the same way for signed and unsigned
+             * variables.
+             * 
+             * A full subtractor can be represented has the following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$B_{in}\f$ | \f$Sub\f$ | \f$B_{out}\f$ |
+             * | :-----: | :-----: | :----------: | :-------: | :-----------: |
+             * | 0       | 0       | 0            | 0         | 0             |
+             * | 0       | 0       | 1            | 1         | 1             |
+             * | 0       | 1       | 0            | 1         | 1             |
+             * | 0       | 1       | 1            | 0         | 1             |
+             * | 1       | 0       | 0            | 1         | 0             |
+             * | 1       | 0       | 1            | 0         | 0             |
+             * | 1       | 1       | 0            | 0         | 0             |
+             * | 1       | 1       | 1            | 1         | 1             |
+             * 
+             * The truth table translates a logical expression for both \f$Sub\f$ and \f$B_{out}\f$ outputs. These expressions can
+             * be further simplified, as follows:
+             * 
+             * \begin{align*}
+             *      Sub &= \overline{A}.\overline{B}.B_{in} + \overline{A}.B.\overline{B_{in}} + A.\overline{B}.\overline{B_{in}} + A.B.B_{in}\\\
+             *          &= B_{in}.(\overline{A}.\overline{B} + A.B) + \overline{B_{in}}.(\overline{A}.B + A.\overline{B})\\\
+             *          &= B_{in}.(\overline{A \oplus B}) + \overline{B_{in}}.(A \oplus B)\\\
+             *          &= B_{in} \oplus (A \oplus B)
+             * \end{align*}
+             *
+             * \begin{align*}
+             *      B_{out} &= \overline{A}.\overline{B}.B_{in} + \overline{A}.B.\overline{B_{in}} + \overline{A}.B.B_{in} + A.B.B_{in}\\\
+             *              &= \overline{A}.(\overline{B}.B_{in} + B.\overline{B_{in}}) + B.B_{in}\\\
+             *              &= \overline{A}.(B \oplus B_{in}) + B.B_{in}
+             * \end{align*}
+             * 
+             * The input variables can have any size. Only the bits of the output variable are computed: narrower input variables
+             * are zero extended to its size, wider ones are truncated, and the gates of the extension wires that are zero
+             * are not created.
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out Output variable \f$Sub\f$.
             **/
-            void AND(const Wire in_a, const Wire in_b, Wire& out);
+            void subtract(const Variable& in_a, const Variable& in_b, Variable& out);
 
             /**
-             * @brief AND operation between two variables.
+             * @brief Binary subtraction between two signed variables, resulting in a new variable.
              * 
              * -----
              * 
-             * An AND gate is represented by following truth table:
+             * @details Subtraction is one of the most basic operations performed and it is referred as a binary subtractor in
+             * logic circuits. There are two subtractor types: half subtractor, and full subtractor. This function is developed to
+             * target a binary subtraction that uses a full subtractor. A full subtractor is a combinational logic circuit that
+             * makes the difference between two binary input bits (\f$A\f$, minuend, and \f$B\f$, subtrahend), taken into account
+             * the borrow bit (\f$B_{in}\f$), resulting in a sub bit (\f$Sub\f$) and another borrow bit (\f$B_{out}\f$).
+             * \f$B_{in}\f$ and \f$B_{out}\f$ are just the borrow bits from the previous and to the next operation, respectively.
              * 
-             * | \f$A\f$ | \f$B\f$ | \f$AND\f$ |
-             * | :-----: | :-----: | :-------: |
-             * | 0       | 0       | 0         |
-             * | 0       | 0       | 0         |
-             * | 0       | 1       | 0         |
-             * | 0       | 1       | 1         |
+             * A logical subtractor is variable sign independent, which means it works the same way for signed and unsigned
+             * variables.
+             * 
+             * A full subtractor can be represented has the following truth table:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$B_{in}\f$ | \f$Sub\f$ | \f$B_{out}\f$ |
+             * | :-----: | :-----: | :----------: | :-------: | :-----------: |
+             * | 0       | 0       | 0            | 0         | 0             |
+             * | 0       | 0       | 1            | 1         | 1             |
+             * | 0       | 1       | 0            | 1         | 1             |
+             * | 0       | 1       | 1            | 0         | 1             |
+             * | 1       | 0       | 0            | 1         | 0             |
+             * | 1       | 0       | 1            | 0         | 0             |
+             * | 1       | 1       | 0            | 0         | 0             |
+             * | 1       | 1       | 1            | 1         | 1             |
+             * 
+             * The truth table translates a logical expression for both \f$Sub\f$ and \f$B_{out}\f$ outputs. These expressions can
+             * be further simplified, as follows:
+             * 
+             * \begin{align*}
+             *      Sub &= \overline{A}.\overline{B}.B_{in} + \overline{A}.B.\overline{B_{in}} + A.\overline{B}.\overline{B_{in}} + A.B.B_{in}\\\
+             *          &= B_{in}.(\overline{A}.\overline{B} + A.B) + \overline{B_{in}}.(\overline{A}.B + A.\overline{B})\\\
+             *          &= B_{in}.(\overline{A \oplus B}) + \overline{B_{in}}.(A \oplus B)\\\
+             *          &= B_{in} \oplus (A \oplus B)
+             * \end{align*}
+             *
+             * \begin{align*}
+             *      B_{out} &= \overline{A}.\overline{B}.B_{in} + \overline{A}.B.\overline{B_{in}} + \overline{A}.B.B_{in} + A.B.B_{in}\\\
+             *              &= \overline{A}.(\overline{B}.B_{in} + B.\overline{B_{in}}) + B.B_{in}\\\
+             *              &= \overline{A}.(B \oplus B_{in}) + B.B_{in}
+             * \end{align*}
+             * 
+             * The input variables can have any size. Only the bits of the output variable are computed: narrower input variables
+             * are sign extended to its size, wider ones are truncated, and the gates of the extension wires that are zero
+             * are not created.
              * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
-             * @param out Output variable.
+             * @param out Output variable \f$Sub\f$.
             **/
-            void AND(const Variable& in_a, const Variable& in_b, Variable& out);
+            void subtract_s(const Variable& in_a, const Variable& in_b, Variable& out);
+
+            /**
+             * @brief Adds one to a variable. Output overrides the input variable.
+             * 
+             * -----
+             * 
+             * @details The constant one is never added with a full adder: the carry into each bit is the AND of all the lower
+             * bits, thus the increment is a chain of half adders, as follows:
+             * 
+             * \begin{align*}
+             *      Inc_i &= A_i \oplus C_i\\\
+             *      C_{i+1} &= A_i.C_i
+             * \end{align*}
+             * 
+             * With \f$C_0 = 1\f$, the least significant bit is inverted and \f$C_1 = A_0\f$, thus an increment of \f$N\f$ bits
+             * only has \f$N - 2\f$ AND gates.
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 13
+             * Output variable value: 14
+             * 
+             *          Increment
+             * 00001101 --------> 00001110
+             * ```
+             * 
+             * @param variable Input & Output variable.
+            **/
+            void increment(Variable& variable);
+
+            /**
+             * @brief Adds one to a variable. Output does not override initial variable.
+             * 
+             * -----
+             * 
+             * @details See the in place version of this function for the construction of the half adders chain.
+             * 
+             * The input variable can have any size. Only the bits of the output variable are computed: a narrower input variable
+             * is zero extended to its size, and a wider one is truncated.
+             * 
+             * @param variable Input variable.
+             * @param output Incremented output.
+            **/
+            void increment(const Variable& variable, Variable& output);
+
+            /**
+             * @brief Subtracts one from a variable. Output overrides the input variable.
+             * 
+             * -----
+             * 
+             * @details The borrow into each bit is one while all the lower bits are zero, which is the negation of the OR of all
+             * the lower bits (\f$O_i\f$), as follows:
+             * 
+             * \begin{align*}
+             *      Dec_i &= \overline{A_i \oplus O_i}\\\
+             *      O_{i+1} &= A_i + O_i
+             * \end{align*}
+             * 
+             * With \f$O_0 = 0\f$, a decrement of \f$N\f$ bits only has \f$N - 2\f$ OR gates.
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 13
+             * Output variable value: 12
+             * 
+             *          Decrement
+             * 00001101 --------> 00001100
+             * ```
+             * 
+             * @param variable Input & Output variable.
+            **/
+            void decrement(Variable& variable);
+
+            /**
+             * @brief Subtracts one from a variable. Output does not override initial variable.
+             * 
+             * -----
+             * 
+             * @details See the in place version of this function for the construction of the borrows chain.
+             * 
+             * The input variable can have any size. Only the bits of the output variable are computed: a narrower input variable
+             * is zero extended to its size, and a wider one is truncated.
+             * 
+             * @param variable Input variable.
+             * @param output Decremented output.
+            **/
+            void decrement(const Variable& variable, Variable& output);
+
+            /**
+             * @brief Changes the sign of a signed variable. Output overrides the input variable.
+             * 
+             * -----
+             * 
+             * @details The negation of a variable is the increment of its 1's complement. The bits up to the least significant
+             * one of the variable are kept, and the bits after it are inverted, thus each bit is inverted when the OR of the
+             * lower bits (\f$O_i\f$) is one, as follows:
+             * 
+             * \begin{align*}
+             *      Neg_i &= A_i \oplus O_i\\\
+             *      O_{i+1} &= A_i + O_i
+             * \end{align*}
+             * 
+             * A negation of \f$N\f$ bits only has \f$N - 2\f$ OR gates, instead of the adder of the 1's complement and one.
+             * 
+             * The following example shows the expected behavior of the function:
+             * 
+             * ```
+             * Input variable value: 13
+             * Output variable value: -13
+             * 
+             *          Negation
+             * 00001101 -------> 11110011
+             * ```
+             * 
+             * @param variable Input & Output variable.
+            **/
+            void negate(Variable& variable);
+
+            /**
+             * @brief Changes the sign of a signed variable. Output does not override initial variable.
+             * 
+             * -----
+             * 
+             * @details See the in place version of this function for the construction of the negation.
+             * 
+             * The input variable can have any size. Only the bits of the output variable are computed: a narrower input variable
+             * is sign extended to its size, and a wider one is truncated.
+             * 
+             * @param variable Input variable.
+             * @param output Negated output.
+            **/
+            void negate(const Variable& variable, Variable& output);
+
+            /**
+             * @brief Changes the sign of a signed variable if a control wire is one.
+             * 
+             * -----
+             * 
+             * @details This function is the same as a multiplexer between a variable and its negation, but each bit of the
+             * variable is only inverted when both the control wire and the OR of the lower bits (\f$O_i\f$) are one, as follows:
+             * 
+             * \begin{align*}
+             *      Out_i &= A_i \oplus (C.O_i)\\\
+             *      O_{i+1} &= A_i + O_i
+             * \end{align*}
+             * 
+             * A conditional negation of \f$N\f$ bits has \f$N - 1\f$ AND gates and \f$N - 2\f$ OR gates, which is commonly
+             * used to compute the absolute value of a variable (with its sign wire as the control wire).
+             * 
+             * The input variable can have any size. Only the bits of the output variable are computed: a narrower input variable
+             * is sign extended to its size, and a wider one is truncated.
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param in_c Control wire \f$C\f$.
+             * @param out Output variable, \f$-A\f$ if \f$C\f$ is one, \f$A\f$ otherwise.
+            **/
+            void negate(const Variable& in_a, const Wire& in_c, Variable& out);
             
             /**
-             * @brief OR operation between two wires (bits).
+             * @brief Binary multiplication between two unsigned variables, resulting in a new unsigned variable.
              * 
              * -----
              * 
-             * An OR gate is represented by following truth table:
+             * @details Binary multiplication, also known as array multiplier, is a digital combinational circuit used for
+             * multiplying two binary numbers.
+             * The circuit creation for a binary multiplication is dependent on the sign of the input variables. As such, this
+             * function is directed to the multiplication between two unsigned variables, thus the "u" in the function name.
+             * An unsigned binary multiplication operation can be described by several addition operations by emplying an array
+             * fill of full adders and half adders.
              * 
-             * | \f$A\f$ | \f$B\f$ | \f$OR\f$ |
-             * | :-----: | :-----: | :------: |
-             * | 0       | 0       | 0        |
-             * | 0       | 0       | 1        |
-             * | 0       | 1       | 1        |
-             * | 0       | 1       | 1        |
+             * For better understanding, take a look at the following example: 
+             * 
+             * ```
+             *       0111 (7)   <-- Input variable A
+             *     x 0111 (7)   <-- Input variable B
+             *  ------------- 
+             *       0111       <-- AND (A0, B)
+             *    + 0111        <-- AND (A1, B)
+             *   + 0111         <-- AND (A2, B)
+             *  + 0000          <-- AND (A3, B)
+             *  ------------- 
+             *   00110001 (49)  <-- Multiplication result
+             * ```
+             * 
+             * The input variables can have any size. Only the bits of the output variable are computed, thus a narrower output
+             * (e.g, the same size as the inputs) truncates the product and skips the gates of the discarded bits.
              * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
-             * @param out Output variable.
+             * @param out Output variable \f$Mult\f$.
             **/
-            void OR(const Wire in_a, const Wire in_b, Wire& out);
+            void multiply_u(const Variable& in_a, const Variable& in_b, Variable& out);
 
             /**
-             * @brief OR operation between two variables.
+             * @brief Binary multiplication between two signed variables, resulting in a new signed variable.
              * 
              * -----
              * 
-             * An OR gate is represented by following truth table:
+             * @details Binary multiplication, also known as array multiplier, is a digital combinational circuit used for
+             * multiplying two binary numbers.
+             * The circuit creation for a binary multiplication is dependent on the sign of the input variables. As such, this
+             * function is directed to the multiplication between two signed variables, thus the "s" in the function name.
+             * A signed binary multiplication operation can be described by several addition operations by emplying an array fill
+             * of full adders and half adders, followed by a single subtraction operation.
+             *
+             * For better understanding, take a look at the following example: 
              * 
-             * | \f$A\f$ | \f$B\f$ | \f$OR\f$ |
-             * | :-----: | :-----: | :------: |
-             * | 0       | 0       | 0        |
-             * | 0       | 0       | 1        |
-             * | 0       | 1       | 1        |
-             * | 0       | 1       | 1        |
+             * ```
+             *      0111 (7)   <-- Input variable A
+             *    x 1001 (-7)  <-- Input variable B
+             * ------------- 
+             *   0000111       <-- AND (A0, B)
+             * + 000000        <-- AND (A1, B)
+             * + 00000         <-- AND (A2, B)
+             * - 0111          <-- AND (A3, B)
+             * ------------- 
+             *  11001111 (-49) <-- Multiplication result
+             * ```
+             * 
+             * Alternatively, the binary multiplication of signed variables can also be described by a series of only addition
+             * operations, if a tweak is made.
+             * 
+             * ```
+             *       0111 (7)   <-- Input variable A
+             *     x 1001 (-7)  <-- Input variable B
+             * --------------- 
+             *       1111       <-- AND (A0, B) (most significant bit is inverted)
+             *    + 1000        <-- AND (A1, B) (most significant bit is inverted)
+             *   + 1000         <-- AND (A2, B) (most significant bit is inverted)
+             *  + 0000          <-- AND (A3, B) (all bits inverted except the most significant bit)
+             * + 1001          
+             * --------------- 
+             *   11001111 (-49) <-- Multiplication result
+             * ```
+             * 
+             * The input variables can have any size, in which case the correction constant is \f$2^{n-1}+2^{m-1}+2^{n+m-1}\f$
+             * (\f$n\f$ and \f$m\f$ being the sizes of the inputs). Only the bits of the output variable are computed, thus a
+             * narrower output truncates the product, and a wider one is sign extended without gates.
              * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
-             * @param out Output variable.
+             * @param out Output variable \f$Mult\f$.
             **/
-            void OR(const Variable& in_a, const Variable& in_b, Variable& out);
+            void multiply_s(const Variable& in_a, const Variable& in_b, Variable& out);
 
             /**
-             * @brief INV operation between two wires (bits).
+             * @brief Binary addition of many unsigned variables, resulting in a new variable.
              * 
              * -----
              * 
-             * An INV gate is represented by following truth table:
-             * 
-             * | \f$A\f$ | \f$INV\f$ |
-             * | :-----: | :-------: |
-             * | 0       | 1         |
-             * | 1       | 0         |
-             * 
-             * @param in_a Input variable \f$A\f$.
-             * @param out Output variable.
-            **/
-            void INV(const Wire in_a, Wire& out);
-
-            /**
-             * @brief INV operation between two variables.
-             * 
-             * -----
+             * @details Chaining the sum function to add \f$K\f$ variables of \f$N\f$ bits has \f$K - 1\f$ carry propagations,
+             * with a depth of about \f$(K - 1).N\f$ gates. This function places all the bits of the inputs in a bits heap, where
+             * each column has the bits of the same weight, and reduces it with stages of full adders used as 3:2 compressors (3
+             * bits of a column become a sum bit in that column and a carry bit in the next one) until each column has at most two
+             * bits. A single final adder then propagates the carries of the two remaining rows.
              * 
-             * An INV gate is represented by following truth table:
+             * Each compressor has a single AND gate, and each stage reduces the heights of the columns by a third, thus the
+             * compressors only add about \f$log_{3/2}(K)\f$ AND gates to the depth of the final adder. A 4:2 compressor is the
+             * same as two chained 3:2 compressors, thus two stages of the tree.
              * 
-             * | \f$A\f$ | \f$INV\f$ |
-             * | :-----: | :-------: |
-             * | 0       | 1         |
-             * | 1       | 0         |
+             * The input variables can have any size. Only the bits of the output variable are computed: narrower input variables
+             * are zero extended to its size, wider ones are truncated, and the zero wires are not placed in the heap.
              * 
-             * @param in_a Input variable \f$A\f$.
-             * @param out Output variable.
+             * @param in Input variables.
+             * @param out Output variable \f$Sum\f$.
             **/
-            void INV(const Variable& in_a, Variable& out);
+            void sum_many(const std::vector<Variable>& in, Variable& out);
 
             /**
-             * @brief XNOR operation between two wires (bits).
+             * @brief Binary addition of many signed variables, resulting in a new variable.
              * 
              * -----
              * 
-             * An XNOR operation is represented by following truth table:
-             * 
-             * | \f$A\f$ | \f$B\f$ | \f$XNOR\f$ |
-             * | :-----: | :-----: | :--------: |
-             * | 0       | 0       | 1          |
-             * | 0       | 0       | 0          |
-             * | 0       | 1       | 0          |
-             * | 0       | 1       | 1          |
-             * 
-             * However, the XNOR is not a basic logic gate. It is, in fact, an operation that makes use of two basic logic gate,
-             * i.e an XOR gate followed by an INV gate.
-             * This method exists just to agile the need to use these two operations in a single method call.
+             * @details See sum_many for the construction of the compressor tree. The sign wire \f$S\f$ of a variable of \f$N\f$
+             * bits has the weight \f$-2^{N-1}\f$, which is placed in the heap as its negation and a constant, instead of copies
+             * of the sign wire in all the columns after it:
              * 
-             * @param in_a Input wire \f$A\f$.
-             * @param in_b Input wire \f$B\f$.
-             * @param out Output wire.
-            **/
-            void XNOR(const Wire in_a, const Wire in_b, Wire& out);
-            
-            /**
-             * @brief XNOR operation between two variables.
+             * \begin{align*}
+             *      -S.2^{N-1} = \overline{S}.2^{N-1} - 2^{N-1}
+             * \end{align*}
              * 
-             * -----
+             * The constants of all the input variables are added to a single constant, whose set bits are placed in the heap.
              * 
-             * An XNOR operation is represented by following truth table:
+             * The input variables can have any size. Only the bits of the output variable are computed: narrower input variables
+             * are sign extended to its size, and wider ones are truncated.
              * 
-             * | \f$A\f$ | \f$B\f$ | \f$XNOR\f$ |
-             * | :-----: | :-----: | :--------: |
-             * | 0       | 0       | 1          |
-             * | 0       | 0       | 0          |
-             * | 0       | 1       | 0          |
-             * | 0       | 1       | 1          |
-             *
-             * However, the XNOR is not a basic logic gate. It is, in fact, an operation that makes use of two basic logic gate,
-             * i.e an XOR gate followed by an INV gate.
-             * This method exists just to agile the need to use these two operations in a single method call.
-             *
-             * @param in_a Input variable \f$A\f$.
-             * @param in_b Input variable \f$B\f$.
-             * @param out Output variable.
+             * @param in Input variables.
+             * @param out Output variable \f$Sum\f$.
             **/
-            void XNOR(const Variable& in_a, const Variable& in_b, Variable& out);
+            void sum_many_s(const std::vector<Variable>& in, Variable& out);
 
             /**
-             * @brief NAND operation between two wires (bits).
+             * @brief Inner product between two vectors of unsigned variables, resulting in a new unsigned variable.
              * 
              * -----
              * 
-             * An NAND operation is represented by following truth table:
+             * @details The inner product is the sum of the products of the variables with the same index in both vectors:
              * 
-             * | \f$A\f$ | \f$B\f$ | \f$XNOR\f$ |
-             * | :-----: | :-----: | :--------: |
-             * | 0       | 0       | 1          |
-             * | 0       | 0       | 1          |
-             * | 0       | 1       | 1          |
-             * | 0       | 1       | 0          |
+             * \begin{align*}
+             *      Prod = \sum_{k} A_k.B_k
+             * \end{align*}
              * 
-             * However, the NAND is not a basic logic gate. It is, in fact, an operation that makes use of two basic logic gate,
-             * i.e an AND gate followed by an INV gate.
-             * This method exists just to agile the need to use these two operations in a single method call.
+             * Instead of a multiplication and an addition per pair of variables, the partial product bits of all the
+             * multiplications are placed in a single bits heap, which is reduced by the compressor tree of sum_many with a single
+             * final adder.
              * 
-             * @param in_a Input wire \f$A\f$.
-             * @param in_b Input wire \f$B\f$.
-             * @param out Output wire.
+             * The input variables can have any size. Only the bits of the output variable are computed, thus the partial product
+             * bits of the discarded bits are not created.
+             * 
+             * @note Raises a runtime exception if the vectors have different number of variables.
+             * @param in_a Input variables \f$A\f$.
+             * @param in_b Input variables \f$B\f$.
+             * @param out Output variable \f$Prod\f$.
             **/
-            void NAND(const Wire in_a, const Wire in_b, Wire& out);
-            
+            void inner_product_u(const std::vector<Variable>& in_a, const std::vector<Variable>& in_b, Variable& out);
+
             /**
-             * @brief NAND operation between two wires (bits).
+             * @brief Inner product between two vectors of signed variables, resulting in a new signed variable.
              * 
              * -----
              * 
-             * An NAND operation is represented by following truth table:
+             * @details See inner_product_u for the construction of the bits heap. The partial product bits of each pair are the
+             * ones of multiply_s, where the bits with exactly one sign wire are inverted, and its correction constant is computed
+             * modulo the size of the output, which also sign extends the products:
              * 
-             * | \f$A\f$ | \f$B\f$ | \f$XNOR\f$ |
-             * | :-----: | :-----: | :--------: |
-             * | 0       | 0       | 1          |
-             * | 0       | 0       | 1          |
-             * | 0       | 1       | 1          |
-             * | 0       | 1       | 0          |
+             * \begin{align*}
+             *      C = 2^{n-1}+2^{m-1}-2^{n+m-1}
+             * \end{align*}
              * 
-             * However, the NAND is not a basic logic gate. It is, in fact, an operation that makes use of two basic logic gate,
-             * i.e an AND gate followed by an INV gate.
-             * This method exists just to agile the need to use these two operations in a single method call.
+             * The input variables can have any size. Only the bits of the output variable are computed, thus the partial product
+             * bits of the discarded bits are not created.
              * 
-             * @param in_a Input wire \f$A\f$.
-             * @param in_b Input wire \f$B\f$.
-             * @param out Output wire.
+             * @note Raises a runtime exception if the vectors have different number of variables.
+             * @param in_a Input variables \f$A\f$.
+             * @param in_b Input variables \f$B\f$.
+             * @param out Output variable \f$Prod\f$.
             **/
-            void NAND(const Variable& in_a, const Variable& in_b, Variable& out);
+            void inner_product_s(const std::vector<Variable>& in_a, const std::vector<Variable>& in_b, Variable& out);
 
             /**
-             * @brief NOR operation between two wires (bits).
+             * @brief Counts the number of wires of a variable that are one (population count), resulting in a new unsigned
+             * variable.
              * 
              * -----
              * 
-             * An NOR operation is represented by following truth table:
-             * 
-             * | \f$A\f$ | \f$B\f$ | \f$XNOR\f$ |
-             * | :-----: | :-----: | :--------: |
-             * | 0       | 0       | 1          |
-             * | 0       | 0       | 0          |
-             * | 0       | 1       | 0          |
-             * | 0       | 1       | 0          |
-             * 
-             * However, the NOR is not a basic logic gate. It is, in fact, an operation that makes use of two basic logic gate,
-             * i.e an OR gate followed by an INV gate.
-             * This method exists just to agile the need to use these two operations in a single method call.
+             * @details Every wire of the input variable has the weight 1, thus all of them are placed in the first column of a
+             * bits heap (see sum_many). The full adders of each stage compress 3 wires of a column into a sum wire of the same
+             * weight and a carry wire of the next weight, thus the heap becomes a tree of full adders whose outputs grow by one
+             * bit per level, and no gates are spent on padding wires. A single final adder adds the two remaining rows.
              * 
-             * @param in_a Input wire \f$A\f$.
-             * @param in_b Input wire \f$B\f$.
-             * @param out Output wire.
-            **/
-            void NOR(const Wire in_a, const Wire in_b, Wire& out);
-            
-            /**
-             * @brief NOR operation between two wires (bits).
+             * The count of \f$N\f$ wires has about \f$N\f$ AND gates, and an AND depth of about \f$log_{3/2}(N)\f$ plus the
+             * size of the count.
              * 
-             * -----
+             * The following example shows the expected behavior of the function:
              * 
-             * An NOR operation is represented by following truth table:
+             * ```
+             * Input variable value: 13
              * 
-             * | \f$A\f$ | \f$B\f$ | \f$XNOR\f$ |
-             * | :-----: | :-----: | :--------: |
-             * | 0       | 0       | 1          |
-             * | 0       | 0       | 0          |
-             * | 0       | 1       | 0          |
-             * | 0       | 1       | 0          |
+             *          Popcount
+             * 00001101 -------> 0011
+             * ```
              * 
-             * However, the NOR is not a basic logic gate. It is, in fact, an operation that makes use of two basic logic gate,
-             * i.e an OR gate followed by an INV gate.
-             * This method exists just to agile the need to use these two operations in a single method call.
+             * Only the bits of the output variable are computed, thus an output with less than \f$log_2(N+1)\f$ bits truncates
+             * the count, and the most significant wires of a wider one are zero wires.
              * 
-             * @param in_a Input wire \f$A\f$.
-             * @param in_b Input wire \f$B\f$.
-             * @param out Output wire.
+             * @param in_a Input variable \f$A\f$.
+             * @param out Output variable, the number of wires of \f$A\f$ that are one.
             **/
-            void NOR(const Variable& in_a, const Variable& in_b, Variable& out);
+            void popcount(const Variable& in_a, Variable& out);
 
-        // Arithmetic operations
-        public:
             /**
-             * @brief Binary addition between two variables, resulting in a new variable.
+             * @brief Counts the number of wires that differ between two variables (Hamming distance), resulting in a new unsigned
+             * variable.
              * 
              * -----
              * 
-             * @details Addition is one of the most basic operations performed and it is referred as a binary adder in logic
-             * circuits. There are two adder types: half adder, and full adder. This function is developed to target a binary
-             * addition that uses a full adder. A full adder is a combinational logic circuit that adds two binary input bits
-             * (\f$A\f$ and \f$B\f$), and a carry bit (\f$C_{in}\f$), resulting in a sum bit (\f$Sum\f$) and another carry bit
-             * (\f$C_{out}\f$). \f$C_{in}\f$ and \f$C_{out}\f$ are just the carry bits from the previous and to the next
-             * operation, respectively.
-             * 
-             * A logical adder is variable sign independent, which means it works the same way for signed and unsigned variables.
-             * 
-             * A full adder can be represented has the following truth table:
-             * 
-             * | \f$A\f$ | \f$B\f$ | \f$C_{in}\f$ | \f$Sum\f$ | \f$C_{out}\f$ |
-             * | :-----: | :-----: | :----------: | :-------: | :-----------: |
-             * | 0       | 0       | 0            | 0         | 0             |
-             * | 0       | 0       | 1            | 1         | 0             |
-             * | 0       | 1       | 0            | 1         | 0             |
-             * | 0       | 1       | 1            | 0         | 1             |
-             * | 1       | 0       | 0            | 1         | 0             |
-             * | 1       | 0       | 1            | 0         | 1             |
-             * | 1       | 1       | 0            | 0         | 1             |
-             * | 1       | 1       | 1            | 1         | 1             |
-             * 
-             * The truth table translates a logical expression for both \f$Sum\f$ and \f$C_{out}\f$ outputs. These expressions can
-             * be further simplified, as follows:
+             * @details The Hamming distance is the population count of the XOR between the two variables (see popcount).
              * 
-             * \begin{align*}
-             *      Sum &= \overline{A}.\overline{B}.C_{in} + \overline{A}.B.\overline{C_{in}} + A.\overline{B}.\overline{C_{in}} + A.B.C_{in}\\\
-             *          &= C_{in}.(\overline{A}.\overline{B} + A.B) + \overline{C_{in}}.(\overline{A}.B + A.\overline{B})\\\
-             *          &= C_{in}.(\overline{A \oplus B}) + \overline{C_{in}}.(A \oplus B)\\\
-             *          &= C_{in} \oplus (A \oplus B)
-             * \end{align*}
-             *
-             * \begin{align*}
-             *      C_{out} &= \overline{A}.B.C_{in} + A.\overline{B}.C_{in} + A.B.\overline{C_{in}} + A.B.C_{in}\\\
-             *              &= C_{in}.(\overline{A}.B + A.\overline{B}) + A.B\\\
-             *              &= C_{in}.(A \oplus B) + A.B
-             * \end{align*}
+             * The input variables can have any size, the narrowest one being zero extended, thus the wires of the widest one after
+             * the size of the narrowest one are counted without the XOR gates.
              * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
-             * @param out Output variable \f$Sum\f$.
+             * @param out Output variable, the number of wires of \f$A\f$ and \f$B\f$ that differ.
             **/
-            void sum(const Variable& in_a, const Variable& in_b, Variable& out);
+            void hamming_distance(const Variable& in_a, const Variable& in_b, Variable& out);
 
             /**
-             * @brief Binary subtraction between two variables, resulting in a new variable.
+             * @brief One-hot encoding of the most significant wire of a variable that is one (priority encoder), resulting in a
+             * new variable.
              * 
              * -----
              * 
-             * @details Subtraction is one of the most basic operations performed and it is referred as a binary subtractor in
-             * logic circuits. There are two subtractor types: half subtractor, and full subtractor. This function is developed to
-             * target a binary subtraction that uses a full subtractor. A full subtractor is a combinational logic circuit that
-             * makes the difference between two binary input bits (\f$A\f$, minuend, and \f$B\f$, subtrahend), taken into account
-             * the borrow bit (\f$B_{in}\f$), resulting in a sub bit (\f$Sub\f$) and another borrow bit (\f$B_{out}\f$).
-             * \f$B_{in}\f$ and \f$B_{out}\f$ are just the borrow bits from the previous and to the next operation, respectively.
+             * @details The OR of the wires from the most significant one down to each wire (\f$O_i\f$) is computed by a
+             * log depth prefix OR tree (Brent-Kung), with about \f$2N\f$ OR gates. The output wire of a position is one only if
+             * the prefix changes in it, which is an XOR since \f$O_{i+1}\f$ implies \f$O_i\f$:
              * 
-             * A logical subtractor is variable sign independent, which means it works the same way for signed and unsigned
-             * variables.
+             * \begin{align*}
+             *      Out_i = O_i \oplus O_{i+1}
+             * \end{align*}
              * 
-             * A full subtractor can be represented has the following truth table:
+             * The following example shows the expected behavior of the function:
              * 
-             * | \f$A\f$ | \f$B\f$ | \f$B_{in}\f$ | \f$Sub\f$ | \f$B_{out}\f$ |
-             * | :-----: | :-----: | :----------: | :-------: | :-----------: |
-             * | 0       | 0       | 0            | 0         | 0             |
-             * | 0       | 0       | 1            | 1         | 1             |
-             * | 0       | 1       | 0            | 1         | 1             |
-             * | 0       | 1       | 1            | 0         | 1             |
-             * | 1       | 0       | 0            | 1         | 0             |
-             * | 1       | 0       | 1            | 0         | 0             |
-             * | 1       | 1       | 0            | 0         | 0             |
-             * | 1       | 1       | 1            | 1         | 1             |
+             * ```
+             * Input variable value: 13
              * 
-             * The truth table translates a logical expression for both \f$Sub\f$ and \f$B_{out}\f$ outputs. These expressions can
-             * be further simplified, as follows:
+             *          Priority
+             * 00001101 -------> 00001000
+             * ```
              * 
-             * \begin{align*}
-             *      Sub &= \overline{A}.\overline{B}.B_{in} + \overline{A}.B.\overline{B_{in}} + A.\overline{B}.\overline{B_{in}} + A.B.B_{in}\\\
-             *          &= B_{in}.(\overline{A}.\overline{B} + A.B) + \overline{B_{in}}.(\overline{A}.B + A.\overline{B})\\\
-             *          &= B_{in}.(\overline{A \oplus B}) + \overline{B_{in}}.(A \oplus B)\\\
-             *          &= B_{in} \oplus (A \oplus B)
-             * \end{align*}
-             *
-             * \begin{align*}
-             *      B_{out} &= \overline{A}.\overline{B}.B_{in} + \overline{A}.B.\overline{B_{in}} + \overline{A}.B.B_{in} + A.B.B_{in}\\\
-             *              &= \overline{A}.(\overline{B}.B_{in} + B.\overline{B_{in}}) + B.B_{in}\\\
-             *              &= \overline{A}.(B \oplus B_{in}) + B.B_{in}
-             * \end{align*}
+             * With OR gates enabled, the priority encoding of 32, 64 and 128 bits variables has 57, 120 and 247 OR gates and no
+             * AND gates, with a depth of 9, 11 and 13. Without OR gates, each OR is emulated with an AND gate between INV gates,
+             * which makes the tree deeper. The output is zero if the input variable is zero.
              * 
              * @param in_a Input variable \f$A\f$.
-             * @param in_b Input variable \f$B\f$.
-             * @param out Output variable \f$Sub\f$.
+             * @param out Output variable, with the same size as the input variable.
             **/
-            void subtract(const Variable& in_a, const Variable& in_b, Variable& out);
-            
+            void priority_encoder(const Variable& in_a, Variable& out);
+
             /**
-             * @brief Binary multiplication between two unsigned variables, resulting in a new unsigned variable.
+             * @brief Counts the number of leading zero wires of a variable, resulting in a new unsigned variable.
              * 
              * -----
              * 
-             * @details Binary multiplication, also known as array multiplier, is a digital combinational circuit used for
-             * multiplying two binary numbers.
-             * The circuit creation for a binary multiplication is dependent on the sign of the input variables. As such, this
-             * function is directed to the multiplication between two unsigned variables, thus the "u" in the function name.
-             * An unsigned binary multiplication operation can be described by several addition operations by emplying an array
-             * fill of full adders and half adders.
+             * @details The position of the most significant wire that is one is given by the priority encoder (see
+             * priority_encoder). The one-hot wire of a position is the one-hot wire of the count, thus its binary encoding is only
+             * made of XOR gates (at most one wire is one). A variable that is zero has as many leading zeros as its size, which is
+             * given by the negation of the OR of all its wires.
              * 
-             * For better understanding, take a look at the following example: 
+             * The following example shows the expected behavior of the function:
              * 
              * ```
-             *       0111 (7)   <-- Input variable A
-             *     x 0111 (7)   <-- Input variable B
-             *  ------------- 
-             *       0111       <-- AND (A0, B)
-             *    + 0111        <-- AND (A1, B)
-             *   + 0111         <-- AND (A2, B)
-             *  + 0000          <-- AND (A3, B)
-             *  ------------- 
-             *   00110001 (49)  <-- Multiplication result
+             * Input variable value: 13
+             * 
+             *          CLZ
+             * 00001101 --> 0100
              * ```
              * 
+             * The count of 32, 64 and 128 bits variables has the gates of the priority encoder: with OR gates enabled, 57, 120 and
+             * 247 OR gates, with a depth of 13, 16 and 19 (the XOR trees of the encoding are balanced). Only the bits of the output variable are
+             * computed, thus an output with less than \f$log_2(N+1)\f$ bits truncates the count, and the most significant wires
+             * of a wider one are zero wires.
+             * 
              * @param in_a Input variable \f$A\f$.
-             * @param in_b Input variable \f$B\f$.
-             * @param out Output variable \f$Mult\f$.
+             * @param out Output variable, the number of leading zeros of \f$A\f$.
             **/
-            void multiply_u(const Variable& in_a, const Variable& in_b, Variable& out);
+            void clz(const Variable& in_a, Variable& out);
 
             /**
-             * @brief Binary multiplication between two signed variables, resulting in a new signed variable.
+             * @brief Counts the number of trailing zero wires of a variable, resulting in a new unsigned variable.
              * 
              * -----
              * 
-             * @details Binary multiplication, also known as array multiplier, is a digital combinational circuit used for
-             * multiplying two binary numbers.
-             * The circuit creation for a binary multiplication is dependent on the sign of the input variables. As such, this
-             * function is directed to the multiplication between two signed variables, thus the "s" in the function name.
-             * A signed binary multiplication operation can be described by several addition operations by emplying an array fill
-             * of full adders and half adders, followed by a single subtraction operation.
-             *
-             * For better understanding, take a look at the following example: 
+             * @details This function is the same as clz, but with the prefix OR tree from the least significant wire. A variable
+             * that is zero has as many trailing zeros as its size.
+             * 
+             * The following example shows the expected behavior of the function:
              * 
              * ```
-             *      0111 (7)   <-- Input variable A
-             *    x 1001 (-7)  <-- Input variable B
-             * ------------- 
-             *   0000111       <-- AND (A0, B)
-             * + 000000        <-- AND (A1, B)
-             * + 00000         <-- AND (A2, B)
-             * - 0111          <-- AND (A3, B)
-             * ------------- 
-             *  11001111 (-49) <-- Multiplication result
+             * Input variable value: 12
+             * 
+             *          CTZ
+             * 00001100 --> 0010
              * ```
              * 
-             * Alternatively, the binary multiplication of signed variables can also be described by a series of only addition
-             * operations, if a tweak is made.
+             * With OR gates enabled, the count of 32, 64 and 128 bits variables has 57, 120 and 247 OR gates. Only the bits of the output variable are
+             * computed, thus an output with less than \f$log_2(N+1)\f$ bits truncates the count, and the most significant wires
+             * of a wider one are zero wires.
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param out Output variable, the number of trailing zeros of \f$A\f$.
+            **/
+            void ctz(const Variable& in_a, Variable& out);
+
+            /**
+             * @brief Integer base 2 logarithm of an unsigned variable (floor), resulting in a new unsigned variable.
+             * 
+             * -----
+             * 
+             * @details The logarithm is the position of the most significant wire that is one, thus it is the binary encoding of
+             * the priority encoder (see priority_encoder), which is only made of XOR gates.
+             * 
+             * The following example shows the expected behavior of the function:
              * 
              * ```
-             *       0111 (7)   <-- Input variable A
-             *     x 1001 (-7)  <-- Input variable B
-             * --------------- 
-             *       1111       <-- AND (A0, B) (most significant bit is inverted)
-             *    + 1000        <-- AND (A1, B) (most significant bit is inverted)
-             *   + 1000         <-- AND (A2, B) (most significant bit is inverted)
-             *  + 0000          <-- AND (A3, B) (all bits inverted except the most significant bit)
-             * + 1001          
-             * --------------- 
-             *   11001111 (-49) <-- Multiplication result
+             * Input variable value: 13
+             * 
+             *          ILOG2
+             * 00001101 ----> 0011
              * ```
              * 
+             * With OR gates enabled, the logarithm of 32, 64 and 128 bits variables has 57, 120 and 247 OR gates. The logarithm of zero is not defined,
+             * and the output is zero in that case.
+             * 
              * @param in_a Input variable \f$A\f$.
-             * @param in_b Input variable \f$B\f$.
-             * @param out Output variable \f$Mult\f$.
+             * @param out Output variable, \f$\lfloor log_2(A) \rfloor\f$.
             **/
-            void multiply_s(const Variable& in_a, const Variable& in_b, Variable& out);
+            void ilog2(const Variable& in_a, Variable& out);
 
             /**
              * @brief Binary division between two unsigned variables, resulting in a two new unsigned variables (quotient and
@@ -1324,6 +2910,10 @@ namespace gabe {
              * Remainder | Quotient
              * ```
              * 
+             * The input variables can have any size. The quotient has the size of the dividend and the remainder the size of the
+             * divisor, and both are zero extended or truncated to the size of the output variables. The remainder of each step
+             * only has the dividend bits assigned so far, thus the first compare and subtract operations are narrower.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out_q Output variable \f$Q\f$ (Quotient).
@@ -1372,6 +2962,10 @@ namespace gabe {
              * Remainder | Quotient
              * ```
              * 
+             * The input variables can have any size. The quotient has the size of the dividend and the remainder the size of the
+             * divisor, and both are zero extended or truncated to the size of the output variables. The remainder of each step
+             * only has the dividend bits assigned so far, thus the first compare and subtract operations are narrower.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out_q Output variable \f$Q\f$ (Quotient).
@@ -1419,6 +3013,10 @@ namespace gabe {
              * Remainder | Quotient
              * ```
              * 
+             * The input variables can have any size. The quotient has the size of the dividend and the remainder the size of the
+             * divisor, and both are zero extended or truncated to the size of the output variables. The remainder of each step
+             * only has the dividend bits assigned so far, thus the first compare and subtract operations are narrower.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out_r Output variable \f$R\f$ (Remainder).
@@ -1456,6 +3054,8 @@ namespace gabe {
              * Since the output comes from the unsigned binary operation, it also has to be manipulated in case its result is
              * suppose to be negative. This only happens when the operation is between two signed variables with different signs.
              * 
+             * The input variables can have any size. The quotient is negated with the size of its output variable.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out_q Output variable \f$Q\f$ (Quotient).
@@ -1493,6 +3093,8 @@ namespace gabe {
              * Since the output comes from the unsigned binary operation, it also has to be manipulated in case its result is
              * suppose to be negative. This only happens when the operation is between two signed variables with different signs.
              * 
+             * The input variables can have any size. The quotient is negated with the size of its output variable.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out_q Output variable \f$Q\f$ (Quotient).
@@ -1525,6 +3127,8 @@ namespace gabe {
              * Since this function only targets to get the remainder result, the very last step of manipulating the quotient
              * variable is not needed.
              * 
+             * The input variables can have any size. The quotient is negated with the size of its output variable.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out_r Output variable \f$R\f$ (Remainder).
@@ -1565,6 +3169,27 @@ namespace gabe {
             **/
             void multiplexer(const Variable& in_a, const Variable& in_b, const Wire& in_c, Variable& out);
 
+            /**
+             * @brief Swaps two variables depending on the value of a control bit \f$C\f$.
+             * 
+             * -----
+             * 
+             * A conditional swap is two multiplexers with swapped inputs, but both outputs can share the same difference between
+             * the inputs, which only needs a single AND gate per bit:
+             * 
+             * \begin{align*}
+             *      D &= C.(A \oplus B)\\\
+             *      A' &= A \oplus D\\\
+             *      B' &= B \oplus D
+             * \end{align*}
+             * 
+             * @note Raises a runtime exception if the variables have different sizes.
+             * @param in_a Input & Output variable \f$A\f$.
+             * @param in_b Input & Output variable \f$B\f$.
+             * @param in_c Input control bit \f$C\f$ (the variables are swapped if it is one).
+            **/
+            void conditional_swap(Variable& in_a, Variable& in_b, const Wire& in_c);
+
             /**
              * @brief Evaluates if two variables are equal or not.
              * 
@@ -1581,6 +3206,8 @@ namespace gabe {
              * 
              * As can be seen, it represents an XNOR gate.
              * 
+             * The input variables can have any size, the narrowest one being zero extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output wire \f$Equal\f$.
@@ -1603,6 +3230,8 @@ namespace gabe {
              * 
              * As can be seen, it represents an XNOR gate.
              * 
+             * The input variables can have any size, the narrowest one being zero extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output variable \f$Equal\f$.
@@ -1644,6 +3273,11 @@ namespace gabe {
              * 
              * Where \f$n\f$ is the number of bits.
              * 
+             * In the circuit, A is greater than B if B is smaller than A, which is computed with the borrow chain of \f$B-A\f$ and
+             * costs a single AND gate per bit (see log_depth_comparators for the tree variant).
+             * 
+             * The input variables can have any size, the narrowest one being zero extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output wire \f$Greater\f$.
@@ -1685,6 +3319,11 @@ namespace gabe {
              * 
              * Where \f$n\f$ is the number of bits.
              * 
+             * In the circuit, A is greater than B if B is smaller than A, which is computed with the borrow chain of \f$B-A\f$ and
+             * costs a single AND gate per bit (see log_depth_comparators for the tree variant).
+             * 
+             * The input variables can have any size, the narrowest one being zero extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output variable \f$Greater\f$.
@@ -1729,6 +3368,13 @@ namespace gabe {
              * If we take a look at a greater unsigned operation, the signed operation has exactly the same expression, expect the
              * comparison between the most significant bits, which represent the sign.
              * 
+             * In the circuit, A is greater than B if B is smaller than A, which is computed with the borrow chain of \f$B-A\f$ and
+             * costs a single AND gate per bit (see log_depth_comparators for the tree variant).
+             * 
+             * In the circuit, the comparison is the unsigned one with both sign bits flipped, which costs no extra gate.
+             * 
+             * The input variables can have any size, the narrowest one being sign extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output wire \f$Greater\f$.
@@ -1773,6 +3419,13 @@ namespace gabe {
              * If we take a look at a greater unsigned operation, the signed operation has exactly the same expression, expect the
              * comparison between the most significant bits, which represent the sign.
              * 
+             * In the circuit, A is greater than B if B is smaller than A, which is computed with the borrow chain of \f$B-A\f$ and
+             * costs a single AND gate per bit (see log_depth_comparators for the tree variant).
+             * 
+             * In the circuit, the comparison is the unsigned one with both sign bits flipped, which costs no extra gate.
+             * 
+             * The input variables can have any size, the narrowest one being sign extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output variable \f$Greater\f$.
@@ -1814,6 +3467,11 @@ namespace gabe {
              * 
              * Where \f$n\f$ is the number of bits.
              * 
+             * In the circuit, A is smaller than B if the subtraction \f$A-B\f$ borrows from its most significant bit, which is
+             * computed with a borrow chain that costs a single AND gate per bit (see log_depth_comparators for the tree variant).
+             * 
+             * The input variables can have any size, the narrowest one being zero extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output wire \f$Smaller\f$.
@@ -1855,6 +3513,11 @@ namespace gabe {
              * 
              * Where \f$n\f$ is the number of bits.
              * 
+             * In the circuit, A is smaller than B if the subtraction \f$A-B\f$ borrows from its most significant bit, which is
+             * computed with a borrow chain that costs a single AND gate per bit (see log_depth_comparators for the tree variant).
+             * 
+             * The input variables can have any size, the narrowest one being zero extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output variable \f$Smaller\f$.
@@ -1899,6 +3562,13 @@ namespace gabe {
              * If we take a look at a smaller unsigned operation, the signed operation has exactly the same expression, expect the
              * comparison between the most significant bits, which represent the sign.
              * 
+             * In the circuit, A is smaller than B if the subtraction \f$A-B\f$ borrows from its most significant bit, which is
+             * computed with a borrow chain that costs a single AND gate per bit (see log_depth_comparators for the tree variant).
+             * 
+             * In the circuit, the comparison is the unsigned one with both sign bits flipped, which costs no extra gate.
+             * 
+             * The input variables can have any size, the narrowest one being sign extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output wire \f$Smaller\f$.
@@ -1943,6 +3613,13 @@ namespace gabe {
              * If we take a look at a smaller unsigned operation, the signed operation has exactly the same expression, expect the
              * comparison between the most significant bits, which represent the sign.
              * 
+             * In the circuit, A is smaller than B if the subtraction \f$A-B\f$ borrows from its most significant bit, which is
+             * computed with a borrow chain that costs a single AND gate per bit (see log_depth_comparators for the tree variant).
+             * 
+             * In the circuit, the comparison is the unsigned one with both sign bits flipped, which costs no extra gate.
+             * 
+             * The input variables can have any size, the narrowest one being sign extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output variable \f$Smaller\f$.
@@ -1969,6 +3646,8 @@ namespace gabe {
              * We can see that this truth table is a "smaller" unsigned operation truth table negated. As so, we can conclude that
              * we can achieve the greater or equal operation by negating the smaller operation result.
              * 
+             * The input variables can have any size, the narrowest one being zero extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output wire \f$Greater\:or\:equal\f$.
@@ -1995,6 +3674,8 @@ namespace gabe {
              * We can see that this truth table is a "smaller" unsigned operation truth table negated. As so, we can conclude that
              * we can achieve the greater or equal operation by negating the smaller operation result.
              * 
+             * The input variables can have any size, the narrowest one being zero extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output variable \f$Greater\:or\:equal\f$.
@@ -2021,6 +3702,8 @@ namespace gabe {
              * We can see that this truth table is a "smaller" signed operation truth table negated. As so, we can conclude that
              * we can achieve the greater or equal operation by negating the smaller operation result.
              * 
+             * The input variables can have any size, the narrowest one being sign extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output wire \f$Greater\:or\:equal\f$.
@@ -2047,6 +3730,8 @@ namespace gabe {
              * We can see that this truth table is a "smaller" signed operation truth table negated. As so, we can conclude that
              * we can achieve the greater or equal operation by negating the smaller operation result.
              * 
+             * The input variables can have any size, the narrowest one being sign extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output variable \f$Greater\:or\:equal\f$.
@@ -2073,6 +3758,8 @@ namespace gabe {
              * We can see that this truth table is a "greater" unsigned operation truth table negated. As so, we can conclude that
              * we can achieve the smaller or equal operation by negating the greater operation result.
              * 
+             * The input variables can have any size, the narrowest one being zero extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output wire \f$Smaller\:or\:equal\f$.
@@ -2099,6 +3786,8 @@ namespace gabe {
              * We can see that this truth table is a "greater" unsigned operation truth table negated. As so, we can conclude that
              * we can achieve the smaller or equal operation by negating the greater operation result.
              * 
+             * The input variables can have any size, the narrowest one being zero extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output variable \f$Smaller\:or\:equal\f$.
@@ -2125,6 +3814,8 @@ namespace gabe {
              * We can see that this truth table is a "greater" signed operation truth table negated. As so, we can conclude that
              * we can achieve the smaller or equal operation by negating the greater operation result.
              * 
+             * The input variables can have any size, the narrowest one being sign extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output wire \f$Smaller\:or\:equal\f$.
@@ -2151,6 +3842,8 @@ namespace gabe {
              * We can see that this truth table is a "greater" signed operation truth table negated. As so, we can conclude that
              * we can achieve the smaller or equal operation by negating the greater operation result.
              * 
+             * The input variables can have any size, the narrowest one being sign extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out Output variable \f$Smaller\:or\:equal\f$.
@@ -2181,6 +3874,14 @@ namespace gabe {
              * Thus, the comparator expression is all the three expressions from equal, greater, and smaller unsigned operations
              * (check operations documentation).
              * 
+             * In the circuit, the smaller output is a borrow chain and the equal output is a separate chain of OR gates (the equal
+             * operation), as the borrows are zero both when A is equal and when it is greater, thus they can not give the equal
+             * output. Only the greater output is shared: it is the NOR of the two others, which is their XNOR because both can not
+             * be true at the same time. The comparator of \f$N\f$ bits costs \f$2N - 1\f$ non-free gates, \f$N\f$ for the borrow
+             * chain and \f$N - 1\f$ for the equal chain.
+             * 
+             * The input variables can have any size, the narrowest one being zero extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out_e Output wire \f$Equal\f$.
@@ -2213,75 +3914,402 @@ namespace gabe {
              * Thus, the comparator expression is all the three expressions from equal, greater, and smaller unsigned operations
              * (check operations documentation).
              * 
+             * The outputs are the same as the ones of the comparator with wire outputs, with the same cost, and the other wires of
+             * the output variables are zero wires.
+             * 
+             * The input variables can have any size, the narrowest one being zero extended.
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out_e Output variable \f$Equal\f$.
+             * @param out_g Output variable \f$Greater\f$.
+             * @param out_s Output variable \f$Smaller\f$.
+            **/
+            void comparator_u(const Variable& in_a, const Variable& in_b, Variable& out_e, Variable& out_g, Variable &out_s);
+
+            /**
+             * @brief Compares two signed binary numbers.
+             * 
+             * -----
+             * 
+             * A magnitude digital comparator is a combinational circuit that compares two digital or binary numbers in order to
+             * find out whether one binary number is equal, less than, or greater than the other binary number.
+             * 
+             * The circuit creation for a comparator operation is dependent on the sign of the input variables. As such, this
+             * function is directed to an operation between two signed variables, thus the "s" in the function name.
+             * 
+             * A signed comparator truth table is the fusion of the equal, greater, and smaller truth tables for signed variables:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$=\f$ | \f$>\f$ | \f$<\f$ |
+             * | :-----: | :-----: | :-----: | :-----: | :-----: |
+             * | 0       | 0       | 1       | 0       | 0       |
+             * | 0       | 1       | 0       | 1       | 0       |
+             * | 1       | 0       | 0       | 0       | 1       |
+             * | 1       | 1       | 1       | 0       | 0       |
+             * 
+             * Thus, the comparator expression is all the three expressions from equal, greater, and smaller signed operations
+             * (check operations documentation).
+             * 
+             * In the circuit, the smaller output is a borrow chain and the equal output is a separate chain of OR gates (the equal
+             * operation), as the borrows are zero both when A is equal and when it is greater, thus they can not give the equal
+             * output. Only the greater output is shared: it is the NOR of the two others, which is their XNOR because both can not
+             * be true at the same time. The comparator of \f$N\f$ bits costs \f$2N - 1\f$ non-free gates, \f$N\f$ for the borrow
+             * chain and \f$N - 1\f$ for the equal chain.
+             * 
+             * The input variables can have any size, the narrowest one being sign extended.
+             * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
              * @param out_e Output variable \f$Equal\f$.
              * @param out_g Output variable \f$Greater\f$.
              * @param out_s Output variable \f$Smaller\f$.
             **/
-            void comparator_u(const Variable& in_a, const Variable& in_b, Variable& out_e, Variable& out_g, Variable &out_s);
+            void comparator_s(const Variable& in_a, const Variable& in_b, Wire& out_e, Wire& out_g, Wire &out_s);
+
+            /**
+             * @brief Compares two signed binary numbers.
+             * 
+             * -----
+             * 
+             * A magnitude digital comparator is a combinational circuit that compares two digital or binary numbers in order to
+             * find out whether one binary number is equal, less than, or greater than the other binary number.
+             * 
+             * The circuit creation for a comparator operation is dependent on the sign of the input variables. As such, this
+             * function is directed to an operation between two signed variables, thus the "s" in the function name.
+             * 
+             * A signed comparator truth table is the fusion of the equal, greater, and smaller truth tables for signed variables:
+             * 
+             * | \f$A\f$ | \f$B\f$ | \f$=\f$ | \f$>\f$ | \f$<\f$ |
+             * | :-----: | :-----: | :-----: | :-----: | :-----: |
+             * | 0       | 0       | 1       | 0       | 0       |
+             * | 0       | 1       | 0       | 1       | 0       |
+             * | 1       | 0       | 0       | 0       | 1       |
+             * | 1       | 1       | 1       | 0       | 0       |
+             * 
+             * Thus, the comparator expression is all the three expressions from equal, greater, and smaller signed operations
+             * (check operations documentation).
+             * 
+             * The outputs are the same as the ones of the comparator with wire outputs, with the same cost, and the other wires of
+             * the output variables are zero wires.
+             * 
+             * The input variables can have any size, the narrowest one being sign extended.
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out_e Output wire \f$Equal\f$.
+             * @param out_g Output wire \f$Greater\f$.
+             * @param out_s Output wire \f$Smaller\f$.
+            **/
+            void comparator_s(const Variable& in_a, const Variable& in_b, Variable& out_e, Variable& out_g, Variable &out_s);
+
+        // Sorting operations
+        public:
+            /**
+             * @brief Comparators of a sorting network for any number of variables.
+             * 
+             * -----
+             * 
+             * The comparators are given in the order they must be applied. The networks for sizes that are not powers of 2 are
+             * the networks of the next power of 2 without the comparators of the missing positions, which is the same as sorting
+             * the variables with the biggest possible values after them. The bitonic network is built with all its comparators in
+             * the same direction (the first merge of each stage compares mirrored positions).
+             * 
+             * The depth of a network is the number of stages of comparators that can be applied in parallel, which is
+             * \f$log_2(N).(log_2(N)+1)/2\f$ for both topologies.
+             * 
+             * @param size Number of variables to sort.
+             * @param network Topology of the network.
+             * @return Comparators of the network.
+            **/
+            static std::vector<Comparator> sorting_network(uint64_t size, SortingNetwork network);
+
+            /**
+             * @brief Sorts a vector of unsigned variables. Output overrides the input variables.
+             * 
+             * -----
+             * 
+             * @details The variables are sorted by a sorting network (see sorting_network), whose comparators do not depend on
+             * the values of the variables, as required by a circuit. Each comparator compares two variables with greater_u (a
+             * single borrow chain) and conditionally swaps them (see conditional_swap), thus it has \f$2.N\f$ AND gates for
+             * variables of \f$N\f$ bits. Sorting \f$K\f$ variables has \f$O(K.log^2(K))\f$ comparators, instead of the
+             * \f$O(K^2)\f$ comparators of sorting them with a comparison of every pair.
+             * 
+             * @note Raises a runtime exception if the variables have different sizes.
+             * @param keys Input & Output variables.
+             * @param ascending True to sort in ascending order, false to sort in descending order.
+             * @param network Topology of the sorting network.
+            **/
+            void sort(std::vector<Variable>& keys, bool ascending = true, SortingNetwork network = SortingNetwork::OddEvenMerge);
+
+            /**
+             * @brief Sorts a vector of unsigned variables, and carries a payload variable along with each of them. Output
+             * overrides the input variables.
+             * 
+             * -----
+             * 
+             * @details See the sort function without payloads. The payloads of two compared variables are swapped with the same
+             * control bit as the variables, thus each comparator has \f$M\f$ more AND gates for payloads of \f$M\f$ bits.
+             * 
+             * @note Raises a runtime exception if the variables or the payloads have different sizes, or if there is not a payload
+             * for each variable.
+             * @param keys Input & Output variables.
+             * @param payloads Input & Output payloads of the variables.
+             * @param ascending True to sort in ascending order, false to sort in descending order.
+             * @param network Topology of the sorting network.
+            **/
+            void sort(std::vector<Variable>& keys, std::vector<Variable>& payloads, bool ascending = true, SortingNetwork network = SortingNetwork::OddEvenMerge);
+
+        // Permutation operations
+        public:
+            /**
+             * @brief Switches of the permutation network (AS-Waksman network) for any number of variables.
+             * 
+             * -----
+             * 
+             * The network of \f$N\f$ positions has a column of input switches on the pairs of positions \f$(2i, 2i+1)\f$, two
+             * subnetworks for the even and the odd positions (with the last position in the odd one if \f$N\f$ is odd), and a
+             * column of output switches on the same pairs, without the last one. It can route any permutation, and has
+             * \f$\sum_{i=1}^{N} \lceil log_2(i) \rceil\f$ switches, which is \f$N.log_2(N)-N+1\f$ switches if \f$N\f$ is a
+             * power of 2.
+             * 
+             * The switches are given in the order of their control bits (see permutation_control_bits), which is an order they
+             * can be applied in.
+             * 
+             * @param size Number of variables to permute.
+             * @return Switches of the network.
+            **/
+            static std::vector<Comparator> permutation_network(uint64_t size);
+
+            /**
+             * @brief Control bits of the permutation network that route a permutation (see permutation_network).
+             * 
+             * -----
+             * 
+             * This function does not create any gates, it computes the control bits given to the circuit by the party that knows
+             * the permutation.
+             * 
+             * @note Raises a runtime exception if the input is not a permutation.
+             * @param permutation Permutation, where the element at position i is the input position of the variable that ends at
+             * position i.
+             * @return Control bits of the network switches, where a bit set swaps the variables of its switch.
+            **/
+            static std::vector<uint8_t> permutation_control_bits(const std::vector<uint64_t>& permutation);
+
+            /**
+             * @brief Permutes a vector of variables with secret control bits. Output overrides the input variables.
+             * 
+             * -----
+             * 
+             * @details Each switch of the permutation network (see permutation_network) conditionally swaps its variables with
+             * its control bit (see conditional_swap), thus it has \f$N\f$ AND gates for variables of \f$N\f$ bits, and the
+             * permutation is hidden by the control bits.
+             * 
+             * @note Raises a runtime exception if the variables have different sizes, or if there is not a control bit for each
+             * switch of the network.
+             * @param variables Input & Output variables.
+             * @param control_bits Input control bits (see permutation_control_bits).
+            **/
+            void permute(std::vector<Variable>& variables, const Variable& control_bits);
+
+        // Array operations
+        public:
+            /**
+             * @brief Binary decoder of an unsigned variable, resulting in a one-hot variable.
+             * 
+             * -----
+             * 
+             * @details The wire \f$i\f$ of the output is one if the input is \f$i\f$, thus at most one of the wires is one.
+             * The decoder is a tree, where each level splits every wire of the previous level with the next bit of the input
+             * (\f$w.b\f$ and \f$w \oplus w.b\f$), thus it has \f$2^k-2\f$ AND gates for an output of \f$2^k\f$ wires,
+             * instead of the \f$k.2^k\f$ AND gates of comparing the input with every value, and an AND depth of \f$k-1\f$.
+             * Input bits beyond the output size are ORed together and gate the root of the tree.
+             * 
+             * @param in_a Input variable (index).
+             * @param out Output variable, whose size is the number of decoded values.
+            **/
+            void decoder(const Variable& in_a, Variable& out);
+
+            /**
+             * @brief Reads the element of an array at a secret index (linear scan).
+             * 
+             * -----
+             * 
+             * @details The index is decoded once (see decoder), and the output is the XOR of every element ANDed with its decoded
+             * wire, as only one of them can be one. It has one AND gate per bit of the array, plus the decoder, and none for the
+             * bits of the array that are constants (e.g. a lookup table). The output is zero if the index is out of the array.
+             * 
+             * @note Raises a runtime exception if the elements of the array and the output have different sizes.
+             * @param array Input array.
+             * @param index Input unsigned variable (index).
+             * @param out Output variable.
+            **/
+            void array_read(const std::vector<Variable>& array, const Variable& index, Variable& out);
+
+            /**
+             * @brief Writes a value to the element of an array at a secret index (linear scan). Output overrides the array.
+             * 
+             * -----
+             * 
+             * @details The index is decoded once (see decoder), and every element is replaced by
+             * \f$E \oplus d.(E \oplus V)\f$, where \f$d\f$ is its decoded wire, thus it has one AND gate per bit of the
+             * array, plus the decoder. The array is unchanged if the index is out of the array.
+             * 
+             * @note Raises a runtime exception if the elements of the array and the value have different sizes.
+             * @param array Input & Output array.
+             * @param index Input unsigned variable (index).
+             * @param value Input variable written.
+            **/
+            void array_write(std::vector<Variable>& array, const Variable& index, const Variable& value);
+
+        // Fixed point operations
+        public:
+            /**
+             * @brief Converts a fixed point variable to the format of the output variable.
+             * 
+             * -----
+             * 
+             * @details Extra fraction bits are appended as zeros, and the dropped fraction bits are rounded (an increment of the
+             * kept bits for the nearest roundings). Without saturation, the integer bits are sign extended or truncated
+             * (wrapping around), without gates. With saturation, a value out of the output range is replaced by its minimum or
+             * maximum value, which costs an OR gate per truncated integer bit and an AND gate per output bit.
+             * 
+             * @param in_a Input variable.
+             * @param out Output variable.
+             * @param rounding Rounding of the dropped fraction bits.
+             * @param saturate True to saturate values out of the output range, false to wrap them around.
+            **/
+            void convert_fixed(const FixedPoint& in_a, FixedPoint& out, Rounding rounding = Rounding::Truncate, bool saturate = false);
+
+            /**
+             * @brief Addition between two fixed point variables, resulting in a fixed point variable of any format.
+             * 
+             * -----
+             * 
+             * @details The inputs are aligned to the finest of their formats without gates, added with sum_s, and converted to
+             * the output format (see convert_fixed). Without saturation, only the sum bits of the output are computed.
+             * 
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out Output variable \f$Sum\f$.
+             * @param rounding Rounding of the dropped fraction bits.
+             * @param saturate True to saturate values out of the output range, false to wrap them around.
+            **/
+            void sum_fixed(const FixedPoint& in_a, const FixedPoint& in_b, FixedPoint& out, Rounding rounding = Rounding::Truncate, bool saturate = false);
 
             /**
-             * @brief Compares two signed binary numbers.
+             * @brief Subtraction between two fixed point variables, resulting in a fixed point variable of any format.
              * 
              * -----
              * 
-             * A magnitude digital comparator is a combinational circuit that compares two digital or binary numbers in order to
-             * find out whether one binary number is equal, less than, or greater than the other binary number.
-             * 
-             * The circuit creation for a comparator operation is dependent on the sign of the input variables. As such, this
-             * function is directed to an operation between two signed variables, thus the "s" in the function name.
-             * 
-             * A signed comparator truth table is the fusion of the equal, greater, and smaller truth tables for signed variables:
-             * 
-             * | \f$A\f$ | \f$B\f$ | \f$=\f$ | \f$>\f$ | \f$<\f$ |
-             * | :-----: | :-----: | :-----: | :-----: | :-----: |
-             * | 0       | 0       | 1       | 0       | 0       |
-             * | 0       | 1       | 0       | 1       | 0       |
-             * | 1       | 0       | 0       | 0       | 1       |
-             * | 1       | 1       | 1       | 0       | 0       |
-             * 
-             * Thus, the comparator expression is all the three expressions from equal, greater, and smaller signed operations
-             * (check operations documentation).
+             * @details See sum_fixed, with subtract_s instead of sum_s.
              * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
-             * @param out_e Output variable \f$Equal\f$.
-             * @param out_g Output variable \f$Greater\f$.
-             * @param out_s Output variable \f$Smaller\f$.
+             * @param out Output variable \f$Sub\f$.
+             * @param rounding Rounding of the dropped fraction bits.
+             * @param saturate True to saturate values out of the output range, false to wrap them around.
             **/
-            void comparator_s(const Variable& in_a, const Variable& in_b, Wire& out_e, Wire& out_g, Wire &out_s);
+            void subtract_fixed(const FixedPoint& in_a, const FixedPoint& in_b, FixedPoint& out, Rounding rounding = Rounding::Truncate, bool saturate = false);
 
             /**
-             * @brief Compares two signed binary numbers.
+             * @brief Multiplication between two fixed point variables, resulting in a fixed point variable of any format.
              * 
              * -----
              * 
-             * A magnitude digital comparator is a combinational circuit that compares two digital or binary numbers in order to
-             * find out whether one binary number is equal, less than, or greater than the other binary number.
-             * 
-             * The circuit creation for a comparator operation is dependent on the sign of the input variables. As such, this
-             * function is directed to an operation between two signed variables, thus the "s" in the function name.
+             * @details The product of \f$Q_{I_a.F_a}\f$ and \f$Q_{I_b.F_b}\f$ variables has \f$F_a+F_b\f$ fraction bits, and
+             * is converted to the output format (see convert_fixed). Without saturation, multiply_s only computes the product bits
+             * up to the most significant bit of the output, thus a \f$Q_{16.16}\f$ product of \f$Q_{16.16}\f$ variables does
+             * not compute the 16 most significant bits of the full product. With saturation, the full product is computed.
              * 
-             * A signed comparator truth table is the fusion of the equal, greater, and smaller truth tables for signed variables:
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out Output variable \f$Mult\f$.
+             * @param rounding Rounding of the dropped fraction bits.
+             * @param saturate True to saturate values out of the output range, false to wrap them around.
+            **/
+            void multiply_fixed(const FixedPoint& in_a, const FixedPoint& in_b, FixedPoint& out, Rounding rounding = Rounding::Truncate, bool saturate = false);
+
+            /**
+             * @brief Division between two fixed point variables, resulting in a fixed point variable of any format.
              * 
-             * | \f$A\f$ | \f$B\f$ | \f$=\f$ | \f$>\f$ | \f$<\f$ |
-             * | :-----: | :-----: | :-----: | :-----: | :-----: |
-             * | 0       | 0       | 1       | 0       | 0       |
-             * | 0       | 1       | 0       | 1       | 0       |
-             * | 1       | 0       | 0       | 0       | 1       |
-             * | 1       | 1       | 1       | 0       | 0       |
+             * -----
              * 
-             * Thus, the comparator expression is all the three expressions from equal, greater, and smaller signed operations
-             * (check operations documentation).
+             * @details The dividend (or the divisor) is shifted left so that the quotient of divide_s_quotient has the fraction
+             * bits of the output, thus the quotient is rounded towards zero. The quotient of a division by zero is not defined.
              * 
              * @param in_a Input variable \f$A\f$.
              * @param in_b Input variable \f$B\f$.
-             * @param out_e Output wire \f$Equal\f$.
-             * @param out_g Output wire \f$Greater\f$.
-             * @param out_s Output wire \f$Smaller\f$.
+             * @param out Output variable \f$Q\f$ (Quotient).
+             * @param saturate True to saturate values out of the output range, false to wrap them around.
             **/
-            void comparator_s(const Variable& in_a, const Variable& in_b, Variable& out_e, Variable& out_g, Variable &out_s);
+            void divide_fixed(const FixedPoint& in_a, const FixedPoint& in_b, FixedPoint& out, bool saturate = false);
+
+            /**
+             * @brief Evaluates if two fixed point variables are equal.
+             * @details The inputs are aligned to the finest of their formats without gates (see equal).
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out Output wire \f$Equal\f$.
+            **/
+            void equal_fixed(const FixedPoint& in_a, const FixedPoint& in_b, Wire& out);
+
+            /**
+             * @brief Evaluates if fixed point variable A is greater than fixed point variable B.
+             * @details The inputs are aligned to the finest of their formats without gates (see greater_s).
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out Output wire \f$Greater\f$.
+            **/
+            void greater_fixed(const FixedPoint& in_a, const FixedPoint& in_b, Wire& out);
+
+            /**
+             * @brief Evaluates if fixed point variable A is smaller than fixed point variable B.
+             * @details The inputs are aligned to the finest of their formats without gates (see smaller_s).
+             * @param in_a Input variable \f$A\f$.
+             * @param in_b Input variable \f$B\f$.
+             * @param out Output wire \f$Smaller\f$.
+            **/
+            void smaller_fixed(const FixedPoint& in_a, const FixedPoint& in_b, Wire& out);
+        };
+
+        /**
+         * @brief Profiling scope of a circuit generator.
+         * 
+         * -----
+         * 
+         * Attributes all the gates written by a circuit generator during the lifetime of this object to a scope with the given
+         * name, nested in the scope that was active when this object was created. Does nothing if the generator profiling is
+         * disabled.
+         * 
+         * ```
+         * {
+         *     gabe::bcgen::ProfileScope scope(generator, "round");
+         *     generator.sum(a, b, c); // Attributed to "circuit;round;sum"
+         * }
+         * ```
+        **/
+        class ProfileScope
+        {
+        private:
+            CircuitGenerator& _generator; /**<Profiled circuit generator.*/
+            bool _active; /**<Whether the scope was entered (profiling enabled).*/
+
+        public:
+            /**
+             * @brief Construct a new Profile Scope object, entering the scope.
+             * @param generator Profiled circuit generator.
+             * @param name Scope name.
+            **/
+            ProfileScope(CircuitGenerator& generator, const char* name);
+
+            /** @brief Destroy the Profile Scope object, leaving the scope. **/
+            ~ProfileScope();
+
+            /** @brief Copy construction of a Profile Scope object is deleted. **/
+            ProfileScope(const ProfileScope&) = delete;
+
+            /** @brief Copy assignment of a Profile Scope object is deleted. **/
+            ProfileScope& operator = (const ProfileScope&) = delete;
         };
 
         /**
@@ -2329,6 +4357,118 @@ namespace gabe {
             BristolCircuitGenerator(const std::string &circuit_name, const std::string &circuits_directory = "circuits");
         };
 
+        /**
+         * @brief Circuit generator class for Bristol Fashion format circuits.
+         * 
+         * -----
+         * 
+         * This class extends the Bristol circuit generator and it was developed to target the generation of boolean circuits
+         * with [Bristol Fashion](https://nigelsmart.github.io/MPC-Circuits/) format, as read by SCALE-MAMBA and MP-SPDZ. On top
+         * of the Bristol gates, this format has the following gates:
+         * - EQ: assigns a constant value to a wire. Used to create the zero and one wires;
+         * - EQW: copies a wire into another. Used to make the output wires the last wires of the circuit;
+         * - MAND: multiple independent AND gates in a single line. Used to batch the AND gates of the same AND layer.
+         * 
+         * ```
+         * 2n n <in_a 1> ... <in_a n> <in_b 1> ... <in_b n> <out 1> ... <out n> MAND
+         * ```
+         * 
+         * The AND layer of a gate is the maximum amount of AND gates in a path between the circuit inputs and the gate. AND
+         * gates of the same layer do not depend on each other, thus a multiparty computation backend can evaluate a whole MAND
+         * line in a single communication round.
+         * 
+         * @note To batch the AND gates, the gates are reordered once the circuit is complete. Thus, all the gates are kept in
+         * memory until the circuit is written, regardless of the buffer limit.
+        **/
+        class BristolFashionCircuitGenerator : public BristolCircuitGenerator
+        {
+        protected:
+            /** @brief Gate kept in memory until the circuit is written. **/
+            struct Gate {
+                label_t in_a = 0; /**<Input wire A label (or constant value of an EQ gate).*/
+                label_t in_b = 0; /**<Input wire B label (gates with 2 input wires).*/
+                label_t out = 0; /**<Output wire label.*/
+                uint8_t inputs = 0; /**<Number of input wires (0 for an EQ gate).*/
+                std::string name; /**<Gate name.*/
+            };
+
+            std::vector<Gate> _gates; /**<Circuit gates, in the order they were created.*/
+
+        protected:
+            /**
+             * @brief Writes a logic gate that has 1 input wire and 1 output wire.
+             * 
+             * -----
+             * 
+             * This function overrides the behavior from the original virtual function from the circuit generator abstract class.
+             * It keeps the gate in memory, so that the gates can be batched once the circuit is complete.
+             * 
+             * @param in_a Input wire (or constant value of an EQ gate).
+             * @param output Output wire.
+             * @param gate Gate name.
+            **/
+            virtual void _write_1_1_gate(const uint64_t in_a, const uint64_t output, const std::string &gate) override;
+
+            /**
+             * @brief Writes a logic gate that has 2 input wires and 1 output wire.
+             * 
+             * -----
+             * 
+             * This function overrides the behavior from the original virtual function from the circuit generator abstract class.
+             * It keeps the gate in memory, so that the gates can be batched once the circuit is complete.
+             * 
+             * @param in_a Input wire A.
+             * @param in_b Input wire B.
+             * @param output Output wire.
+             * @param gate Gate name.
+            **/
+            virtual void _write_2_1_gate(const uint64_t in_a, const uint64_t in_b, const uint64_t output, const std::string &gate) override;
+
+            /**
+             * @brief Reorders the circuit gates by AND layer and writes their lines into the buffer.
+             * 
+             * -----
+             * 
+             * Every gate gets a position, which is 2L - 1 for an AND gate of layer L, and 2L for any other gate of layer L. The
+             * gates are then stable sorted by position. An AND gate only depends on gates of lower layers, and any other gate only
+             * depends on gates of the same or lower layers, thus the circuit order is preserved. The AND gates with the same
+             * position are written as a single MAND line.
+            **/
+            void _batch_gates();
+
+            /**
+             * @brief Writes the header section of the circuit into a file.
+             * 
+             * -----
+             * 
+             * This function overrides the behavior from the Bristol circuit generator. The header has the same format, except
+             * that the number of gates is the number of gate lines, where a MAND line counts as a single gate.
+             * 
+             * @param file File to write.
+            **/
+            virtual void _write_header(std::ofstream& file) override;
+
+        public:
+            /** @brief Default construction of a new Bristol Fashion Circuit Generator object is deleted. **/
+            BristolFashionCircuitGenerator() = delete;
+
+            /**
+             * @brief Construct a new Bristol Fashion Circuit Generator object for a specified circuit name and location.
+             * 
+             * -----
+             * 
+             * In the end, the generated circuit file will have the name of the inserted circuit name and located into the
+             * inserted location.
+             * 
+             * @note By default, the directory to the circuits is located at a circuits directory that should be in the same level
+             * from where the executable is being executed.
+             * 
+             * @param circuit_name Name of the circuit.
+             * @param circuits_directory Location of the circuit.
+            **/
+            BristolFashionCircuitGenerator(const std::string &circuit_name, const std::string &circuits_directory = "circuits");
+        };
+
         /**
          * @brief Circuit generator class for Libscapi format circuits.
          * 
@@ -2376,5 +4516,152 @@ namespace gabe {
             **/
             LibscapiCircuitGenerator(const std::string &circuit_name, const std::string &circuits_directory = "circuits");
         };
+
+        /**
+         * @brief Circuit generator class for BCGen binary format circuits.
+         * 
+         * -----
+         * 
+         * This class extends all the core functionality of the circuit generator abstract class and it was developed to target
+         * the generation of boolean circuits with the BCGen binary format (.bcg). Instead of text lines, every gate is written
+         * as a binary record, either with fixed size labels or with variable length label differences (check BinaryFormat.hpp
+         * to understand the specific format features).
+         * 
+         * Binary circuits are several times smaller than the equivalent text circuits, and can be loaded without parsing text.
+         * They are meant to be read with the BinaryCircuitTester class.
+        **/
+        class BinaryCircuitGenerator : public CircuitGenerator
+        {
+        protected:
+            // Binary format options
+            binary_format::Layout _layout; /**<Layout of the gates records.*/
+            bool _checksums; /**<Whether the gates section is followed by the blocks checksums.*/
+            std::unordered_map<std::string, uint8_t> _operations; /**<Mapping of gates names to their operation codes.*/
+
+            // Gates section - Control variables
+            uint64_t _section_size = 0x00; /**<Size of the gates section in bytes.*/
+            uint64_t _previous_output = 0x00; /**<Output wire of the previous gate (variable length layout).*/
+            uint32_t _block_checksum = binary_format::checksum_seed; /**<Checksum of the current block of the gates section.*/
+            std::vector<uint32_t> _blocks_checksums; /**<Checksums of the finished blocks of the gates section.*/
+
+        protected:
+            /**
+             * @brief Writes a gate record of the circuit.
+             * 
+             * -----
+             * 
+             * Updates the gates section size and checksums with the record, and gives it to the _write_gate function.
+             * 
+             * @param record Gate record.
+             * @param gate Gate name.
+            **/
+            void _write_record(const std::string& record, const std::string& gate);
+
+            /**
+             * @brief Checks if a wire label can be written with the fixed size layout.
+             * 
+             * -----
+             * 
+             * This check raises a runtime exception if the label does not fit in 32 bits.
+             * 
+             * @param label Wire label.
+            **/
+            void _assert_fixed_label(uint64_t label);
+
+            /**
+             * @brief Gets the operation code of a gate.
+             * 
+             * -----
+             * 
+             * This function raises a runtime exception if the gate has no operation code in the binary format.
+             * 
+             * @param gate Gate name.
+             * 
+             * @return Operation code of the gate.
+            **/
+            uint8_t _operation(const std::string &gate) const;
+
+            /**
+             * @brief Writes a logic gate that has 1 input wire and 1 output wire.
+             * 
+             * -----
+             * 
+             * This function overrides the behavior from the original virtual function from the circuit generator abstract class.
+             * It encodes the gate as a binary record with the layout of the generator.
+             * 
+             * @param in_a Input wire.
+             * @param output Output wire.
+             * @param gate Gate name.
+            **/
+            virtual void _write_1_1_gate(const uint64_t in_a, const uint64_t output, const std::string &gate) override;
+
+            /**
+             * @brief Writes a logic gate that has 2 input wires and 1 output wire.
+             * 
+             * -----
+             * 
+             * This function overrides the behavior from the original virtual function from the circuit generator abstract class.
+             * It encodes the gate as a binary record with the layout of the generator.
+             * 
+             * @param in_a Input wire A.
+             * @param in_b Input wire B.
+             * @param output Output wire.
+             * @param gate Gate name.
+            **/
+            virtual void _write_2_1_gate(const uint64_t in_a, const uint64_t in_b, const uint64_t output, const std::string &gate) override;
+
+            /**
+             * @brief Writes the header section of the circuit into a file.
+             * 
+             * -----
+             * 
+             * This function overrides the behavior from the original virtual function from the circuit generator abstract class.
+             * It writes the binary header with the format version, the layout, the gates section size and the parties sizes.
+             * 
+             * @param file File to write.
+            **/
+            virtual void _write_header(std::ofstream& file) override;
+
+            /**
+             * @brief Writes the circuit section of the circuit into a file.
+             * 
+             * -----
+             * 
+             * This function overrides the behavior from the original virtual function from the circuit generator abstract class.
+             * It writes the gates section as usual, followed by the blocks checksums if they are enabled.
+             * 
+             * @param file File to write.
+            **/
+            virtual void _write_circuit(std::ofstream& file) override;
+
+        public:
+            /** @brief Default construction of a new Binary Circuit Generator object is deleted. **/
+            BinaryCircuitGenerator() = delete;
+
+            /**
+             * @brief Construct a new Binary Circuit Generator object for a specified circuit name and location.
+             * 
+             * -----
+             * 
+             * In the end, the generated circuit file will have the name of the inserted circuit name and located into the
+             * inserted location.
+             * 
+             * @note By default, the directory to the circuits is located at a circuits directory that should be in the same level
+             * from where the executable is being executed.
+             * 
+             * @note The fixed size layout only supports circuits with less than 2^32 wires.
+             * 
+             * @param circuit_name Name of the circuit.
+             * @param circuits_directory Location of the circuit.
+             * @param layout Layout of the gates records.
+             * @param checksums Whether to write the blocks checksums of the gates section.
+            **/
+            BinaryCircuitGenerator(
+                const std::string &circuit_name,
+                const std::string &circuits_directory = "circuits",
+                binary_format::Layout layout = binary_format::Layout::Varint,
+                bool checksums = true
+            );
+        };
     }
 }
@@ -1,12 +1,14 @@
 #pragma once
 
-#include <fstream>
+#include <chrono>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cstdint>
-#include <functional>
 #include <unordered_map>
 
+#include <bcgen/Label.hpp>
+
 namespace gabe {
     namespace bcgen {
         /**
@@ -24,22 +26,75 @@ namespace gabe {
         **/
         class CircuitTester
         {
+        public:
+            /** @brief Logic operation of a gate. **/
+            enum class GateType : uint8_t {
+                XOR, /**<Exclusive OR between two wires.*/
+                AND, /**<AND between two wires.*/
+                OR,  /**<OR between two wires.*/
+                INV, /**<Negation of a single wire.*/
+                EQ,  /**<Assignment of a constant value (stored in the input wire A label).*/
+                EQW  /**<Copy of a single wire.*/
+            };
+
+            /**
+             * @brief Gate structure.
+             * 
+             * -----
+             * 
+             * Parsed representation of a circuit gate line. Gates with a single input wire repeat it in both input labels.
+            **/
+            struct Gate {
+                label_t in_a = 0; /**<Input wire A label.*/
+                label_t in_b = 0; /**<Input wire B label.*/
+                label_t out = 0; /**<Output wire label.*/
+                GateType type = GateType::XOR; /**<Gate operation.*/
+            };
+
+            /** @brief Execution statistics of a level of the circuit. **/
+            struct LevelStatistics {
+                uint64_t gates = 0; /**<Number of gates in the level.*/
+                std::chrono::nanoseconds time{0}; /**<Time spent evaluating the level in the last execution.*/
+            };
+
         protected:
+            /**
+             * @brief Group of consecutive levels that are evaluated between two threads synchronizations.
+             * 
+             * -----
+             * 
+             * A level with enough gates is split between all the threads (parallel phase). Consecutive levels with few gates are
+             * grouped together and evaluated by a single thread, so that the threads are not synchronized for every small level.
+            **/
+            struct Phase {
+                uint64_t first_level = 0; /**<First level of the phase.*/
+                uint64_t last_level = 0; /**<Last level of the phase (exclusive).*/
+                bool parallel = false; /**<Whether the level of the phase is split between the threads.*/
+            };
+
             // Circuit name and location
             std::string _circuit_name; /**<Circuit file name.*/
             std::string _circuits_directory; /**<Circuit location.*/
+            std::string _circuit_extension = ".txt"; /**<Circuit file extension.*/
 
             // Circuit file
-            std::ifstream _circuit; /**<Circuit file.*/
-            std::size_t _circuit_start_pos; /**<Start position (reader pointer) of the circuit section.*/
+            const char* _circuit = nullptr; /**<Circuit file contents (memory mapped).*/
+            uint64_t _circuit_size = 0x00; /**<Size of the circuit file.*/
+            uint64_t _circuit_position = 0x00; /**<Current reading position in the circuit file contents.*/
 
             // Circuit info
             std::vector<uint8_t> _wires; /**<Circuit wires values.*/
             std::vector<uint64_t> _input_parties; /**<Input parties and their sizes.*/
             std::vector<uint64_t> _output_parties; /**<Output parties and their sizes.*/
-            std::vector<std::vector<uint64_t>> _input_parties_wires; /**<Input parties wire labels.*/
-            std::vector<std::vector<uint64_t>> _output_parties_wires; /**<Output parties wire labels.*/
-            std::unordered_map<std::string, std::function<uint8_t(const std::vector<std::string>&)>> _gates_operations; /**<Mapping of gates operations.*/
+            std::vector<std::vector<label_t>> _input_parties_wires; /**<Input parties wire labels.*/
+            std::vector<std::vector<label_t>> _output_parties_wires; /**<Output parties wire labels.*/
+            std::unordered_map<std::string, GateType> _gates_types; /**<Mapping of gates names to their operations.*/
+
+            // Circuit program
+            std::vector<Gate> _gates; /**<Circuit gates, sorted by level.*/
+            std::vector<uint64_t> _levels; /**<Index of the first gate of each level (plus the total of gates at the end).*/
+            std::vector<Phase> _phases; /**<Levels grouped by the way they are evaluated with multiple threads.*/
+            std::vector<LevelStatistics> _statistics; /**<Execution statistics of each level.*/
 
             // Circuit info complement - Control variables
             uint64_t _counter_wires = 0x00; /**<Control variable to count wires.*/
@@ -47,6 +102,9 @@ namespace gabe {
 
             // Other control variables
             uint64_t _counter_executions = 0x00; /**<Control variable to count circuit executions.*/
+            uint64_t _threads = 1; /**<Number of threads used to evaluate the circuit.*/
+            uint64_t _parallel_threshold = 4096; /**<Minimum gates in a level to split it between multiple threads.*/
+            bool _verbose = true; /**<Control variable to print circuit information and execution results.*/
         
         protected:
             /**
@@ -110,18 +168,113 @@ namespace gabe {
             virtual void _read_header() = 0;
 
             /**
-             * @brief Splits a string into multiple parts by a delimiter.
+             * @brief Reads the circuit section of the circuit file.
+             * 
+             * -----
+             * 
+             * Parses every gate line of the circuit into the internal gate list, so that the circuit file is only read once
+             * regardless of how many times the circuit is executed. It can be overriden by formats that do not write gates as
+             * text lines.
+             * 
+             * Lines with n outputs and 2n inputs (e.g. Bristol Fashion MAND gates) are split into n gates of 2 inputs, where the
+             * k-th gate has the inputs k and n + k.
+            **/
+            virtual void _read_gates();
+
+            /**
+             * @brief Sorts the circuit gates by level.
+             * 
+             * -----
+             * 
+             * The level of a gate is the length of the longest path between the circuit inputs and the gate output. Gates of the
+             * same level do not depend on each other, thus they can be evaluated in any order, or simultaneously.
+             * This function reorders the gates list so that the gates of each level are contiguous in memory, and groups the
+             * levels into the phases used by the multithreaded evaluation.
+             * 
+             * Circuits that reuse the labels of dead wires (a wire is written more than once) keep the file order, and all their
+             * gates are evaluated by a single thread as a single level.
+            **/
+            void _levelize();
+
+            /**
+             * @brief Evaluates all the circuit gates.
+             * 
+             * -----
+             * 
+             * The wires values type defines how many circuit instances are evaluated at once. Every bit of a value is an
+             * independent instance of the circuit (bit-slicing), thus a true wire must have all its bits set.
+             * 
+             * @tparam T Wires values type.
+             * @param wires Values of all the circuit wires. The input wires must be already assigned.
+            **/
+            template <typename T>
+            void _evaluate(std::vector<T>& wires);
+
+            /**
+             * @brief Maps the contents of a circuit file into memory.
              * 
              * -----
              * 
-             * This function searches all the delimiters that the input word contains and divides it in those points.
-             * If no delimiter is found, the vector should contain a single element which is the input word.
+             * The circuit file is never copied into a buffer. Its pages are loaded by the operating system as they are read,
+             * which allows very big circuit files to be read at close to the disk bandwidth.
+             * This function raises a runtime exception if the file cannot be mapped.
              * 
-             * @param word String to split.
-             * @param delimiter Delimiter to split at.
-             * @return List with all the word parts.
+             * @param circuit_path Path to the circuit file.
             **/
-            std::vector<std::string> _split_str(std::string word, std::string delimiter);
+            void _map_circuit(const std::string& circuit_path);
+
+            /** @brief Unmaps the contents of the current circuit file from memory, if any. **/
+            void _unmap_circuit();
+
+            /**
+             * @brief Checks if the circuit wires fit in the label type.
+             * 
+             * -----
+             * 
+             * The parsed gates store their wires labels with the label type (see label_t). This function raises a runtime
+             * exception if the circuit has more wires than the labels can address, instead of silently truncating them.
+            **/
+            void _assert_labels() const;
+
+            /**
+             * @brief Reads the next line of the circuit file.
+             * 
+             * -----
+             * 
+             * The returned line does not include the line break, and it points directly into the circuit file contents. The
+             * reading position is moved to the beginning of the following line.
+             * 
+             * @return Line contents.
+            **/
+            std::string_view _read_line();
+
+            /**
+             * @brief Scans an unsigned integer from a text.
+             * 
+             * -----
+             * 
+             * This function skips any whitespace before the integer and moves the cursor right after its last digit. The digits
+             * are converted 8 at a time with SIMD within a register (SWAR) operations, falling back to a digit by digit
+             * conversion near the end of the text.
+             * This function raises a runtime exception if there is no integer to scan.
+             * 
+             * @param cursor Text position to scan from. Updated to the position after the integer.
+             * @param end End of the text.
+             * @return Scanned integer.
+            **/
+            static uint64_t _scan_uint(const char*& cursor, const char* end);
+
+            /**
+             * @brief Scans an unsigned integer from a line.
+             * 
+             * -----
+             * 
+             * Same as the other overload, except that the line view is shortened to the text after the scanned integer.
+             * 
+             * @param line Line to scan from. Updated to the text after the integer.
+             * @return Scanned integer.
+            **/
+            static uint64_t _scan_uint(std::string_view& line);
 
             /**
              * @brief Construct a new Circuit Tester object.
@@ -133,6 +286,51 @@ namespace gabe {
             /** @brief Destroy the Circuit Tester object. **/
             ~CircuitTester();
 
+        // Tester Options
+        public:
+            /**
+             * @brief Enables or disables the console output of the tester.
+             * 
+             * -----
+             * 
+             * By default, the circuit tester prints the circuit information once a circuit is opened, and the execution results
+             * every time the circuit is ran. For automated test campaigns that evaluate a large amount of circuits, formatting
+             * this output takes most of the execution time. In those cases, this function can be used to disable it, and the
+             * results should be collected with the evaluate method instead.
+             * 
+             * @param enable True to print into the console, false otherwise.
+            **/
+            void verbose(bool enable);
+
+            /**
+             * @brief Sets the number of threads used to evaluate the circuit.
+             * 
+             * -----
+             * 
+             * By default, the circuit is evaluated in a single thread. With multiple threads, the gates of each circuit level are
+             * split between all the threads, which is only worth it for very large circuits. Levels with few gates are always
+             * evaluated by a single thread.
+             * 
+             * @note A value of 0 is treated as 1.
+             * 
+             * @param count Number of threads.
+            **/
+            void threads(uint64_t count);
+
+            /**
+             * @brief Gets the execution statistics of each circuit level.
+             * 
+             * -----
+             * 
+             * The returned list has one entry per circuit level, with the amount of gates in the level and the time spent to
+             * evaluate it during the last execution of the circuit.
+             * 
+             * @return List of levels statistics.
+            **/
+            const std::vector<LevelStatistics>& statistics() const;
+
+        // Circuit Execution
+        public:
             /**
              * @brief Opens a specified circuit file.
              * 
@@ -151,6 +349,49 @@ namespace gabe {
              * @param inputs Input values.
             **/
             void run(const std::vector<uint8_t>& inputs);
+
+            /**
+             * @brief Executes the circuit with the input values and returns the output values.
+             * 
+             * -----
+             * 
+             * This function behaves as the run method, except that it does not print anything into the console. Instead, the
+             * values of the output wires are returned to the caller, one entry per output party.
+             * 
+             * The output wires of each party are packed into 64 bit words. The i-th wire of a party is stored in the bit
+             * (i % 64) of the word (i / 64), i.e, the least significant wire is the least significant bit of the first word.
+             * 
+             * ```
+             * Output party of 8 wires: 00111100 (wire 7 ... wire 0)
+             * Returned party value: { 0x3C }
+             * ```
+             * 
+             * @note The inputs should be given with from least significant wires (lower indexes in the list) to the most
+             * significant wires (higher indexes in the list)
+             * @param inputs Input values.
+             * @return Output values of each output party.
+            **/
+            std::vector<std::vector<uint64_t>> evaluate(const std::vector<uint8_t>& inputs);
+
+            /**
+             * @brief Executes 64 independent instances of the circuit at once (bit-sliced evaluation).
+             * 
+             * -----
+             * 
+             * Each input value holds the 64 instances values of a single input wire, i.e, the bit k of the value is the input
+             * wire value for the k-th instance. The returned values follow the same layout, with one entry per output party and,
+             * inside each party, one 64 bit value per output wire.
+             * 
+             * ```
+             * Input wire 0 values: 0x...0101 -> Instances 0 and 8 have the wire set, the others not.
+             * ```
+             * 
+             * @note The inputs should be given with from least significant wires (lower indexes in the list) to the most
+             * significant wires (higher indexes in the list)
+             * @param inputs Input wires values of all the instances.
+             * @return Output wires values of all the instances, for each output party.
+            **/
+            std::vector<std::vector<uint64_t>> evaluate_batch(const std::vector<uint64_t>& inputs);
         };
 
         /**
@@ -179,6 +420,22 @@ namespace gabe {
             BristolCircuitTester();
         };
 
+        /**
+         * @brief Circuit tester class for Bristol Fashion format circuits.
+         * 
+         * -----
+         * 
+         * This class extends the Bristol circuit tester and it was developed to target the testing of boolean circuits with
+         * [Bristol Fashion](https://nigelsmart.github.io/MPC-Circuits/) format. The header section is the same as the Bristol
+         * one, and the circuit section can also have EQ, EQW and MAND gates.
+        **/
+        class BristolFashionCircuitTester : public BristolCircuitTester
+        {
+        public:
+            /** @brief Construct a new Bristol Fashion Circuit Tester object. **/
+            BristolFashionCircuitTester();
+        };
+
         /**
          * @brief Circuit tester class for Libscapi format circuits.
          * 
@@ -207,5 +464,51 @@ namespace gabe {
             /** @brief Construct a new Libscapi Circuit Tester object. **/
             LibscapiCircuitTester();
         };
+
+        /**
+         * @brief Circuit tester class for BCGen binary format circuits.
+         * 
+         * -----
+         * 
+         * This class extends all the core functionality of a circuit tester abstract class and it was developed to target the
+         * testing of boolean circuits with the BCGen binary format (.bcg), as written by the BinaryCircuitGenerator class
+         * (check BinaryFormat.hpp to understand the specific format features).
+         * 
+         * Both gates records layouts are supported. If the circuit file has blocks checksums, they are verified before the
+         * gates are read.
+        **/
+        class BinaryCircuitTester : public CircuitTester
+        {
+        protected:
+            uint8_t _layout = 0x00; /**<Layout of the gates records of the current circuit file.*/
+            uint64_t _section_size = 0x00; /**<Size of the gates section of the current circuit file.*/
+
+        protected:
+            /**
+             * @brief Reads the header section of the binary circuit file.
+             * 
+             * -----
+             * 
+             * This function contains the header reading for binary circuit formats. It also verifies the blocks checksums of
+             * the gates section, when present.
+             * This function raises a runtime exception if the file is not a valid binary circuit file.
+            **/
+            void _read_header() override;
+
+            /**
+             * @brief Reads the gates section of the binary circuit file.
+             * 
+             * -----
+             * 
+             * This function overrides the behavior from the original virtual function from the circuit tester abstract class.
+             * It decodes the gates records with the layout of the circuit file.
+             * This function raises a runtime exception if a record is truncated or has an unknown operation.
+            **/
+            void _read_gates() override;
+
+        public:
+            /** @brief Construct a new Binary Circuit Tester object. **/
+            BinaryCircuitTester();
+        };
     }
 }
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace gabe {
+    namespace bcgen {
+        /**
+         * @brief Wire label type.
+         * 
+         * -----
+         * 
+         * Wire labels are stored in every wire, every gate kept in memory and every parsed circuit program, thus their size
+         * defines most of the memory used by big circuits. Labels have 32 bits by default, which is enough for circuits with
+         * up to 2^32 - 1 wires. Circuits with more wires require the library to be built with the BCGEN_64BIT_LABELS option.
+        **/
+#if BCGEN_64BIT_LABELS
+        typedef uint64_t label_t;
+#else
+        typedef uint32_t label_t;
+#endif
+
+        /** @brief Maximum number of wires of a circuit (its labels go from 0 to max_wires - 1). **/
+        constexpr uint64_t max_wires = std::numeric_limits<label_t>::max();
+    }
+}
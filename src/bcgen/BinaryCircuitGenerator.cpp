@@ -0,0 +1,155 @@
+#include <bcgen/CircuitGenerator.hpp>
+#include <bcgen/BinaryFormat.hpp>
+#include <fmt/format.h>
+
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+
+namespace format = gabe::bcgen::binary_format;
+
+gabe::bcgen::BinaryCircuitGenerator::BinaryCircuitGenerator(const std::string &circuit_name, const std::string &circuits_directory, binary_format::Layout layout, bool checksums) : CircuitGenerator("binary_" + circuit_name, circuits_directory), _layout(layout), _checksums(checksums) {
+    _gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+    _operations = { {"XOR", format::XOR}, {"INV", format::INV}, {"AND", format::AND}, {"OR", format::OR} };
+    _circuit_extension = ".bcg";
+}
+
+void gabe::bcgen::BinaryCircuitGenerator::_write_record(const std::string& record, const std::string& gate) {
+    // Updates the checksums
+    // > A record can be split between two blocks
+    if (_checksums) {
+        uint64_t written = 0;
+        while (written < record.size()) {
+            const uint64_t block_left = format::checksum_block_size - _section_size % format::checksum_block_size;
+            const uint64_t size = std::min<uint64_t>(block_left, record.size() - written);
+
+            _block_checksum = format::checksum_update(_block_checksum, record.data() + written, size);
+            _section_size += size;
+            written += size;
+
+            // Block is complete
+            if (_section_size % format::checksum_block_size == 0) {
+                _blocks_checksums.push_back(_block_checksum);
+                _block_checksum = format::checksum_seed;
+            }
+        }
+    } else {
+        _section_size += record.size();
+    }
+
+    _write_gate(record, gate);
+}
+
+void gabe::bcgen::BinaryCircuitGenerator::_assert_fixed_label(uint64_t label) {
+    if (label > std::numeric_limits<uint32_t>::max()) {
+        // Creates the error message
+        const std::string error_msg = fmt::format("Wire label {} does not fit in the fixed layout. Use the variable length layout instead.", label);
+
+        // Raises the error
+        throw std::runtime_error(error_msg);
+    }
+}
+
+uint8_t gabe::bcgen::BinaryCircuitGenerator::_operation(const std::string &gate) const {
+    const auto operation = _operations.find(gate);
+    if (operation == _operations.end()) {
+        // Creates the error message
+        const std::string error_msg = fmt::format("Gate {} has no operation code in the binary format.", gate);
+
+        // Raises the error
+        throw std::runtime_error(error_msg);
+    }
+
+    return operation->second;
+}
+
+void gabe::bcgen::BinaryCircuitGenerator::_write_1_1_gate(const uint64_t in_a, const uint64_t output, const std::string &gate) {
+    std::string record;
+
+    // Record construction
+    if (_layout == format::Layout::Fixed) {
+        _assert_fixed_label(in_a);
+        _assert_fixed_label(output);
+
+        format::append_uint(record, in_a, 4);
+        format::append_uint(record, in_a, 4);
+        format::append_uint(record, output, 4);
+        format::append_uint(record, _operation(gate), 4);
+    } else {
+        format::append_varint(record, (format::zigzag_encode(static_cast<int64_t>(output - _previous_output - 1)) << 2) | _operation(gate));
+        format::append_varint(record, format::zigzag_encode(static_cast<int64_t>(output - in_a)));
+    }
+
+    _previous_output = output;
+    _write_record(record, gate);
+}
+
+void gabe::bcgen::BinaryCircuitGenerator::_write_2_1_gate(const uint64_t in_a, const uint64_t in_b, const uint64_t output, const std::string &gate) {
+    std::string record;
+
+    // Record construction
+    if (_layout == format::Layout::Fixed) {
+        _assert_fixed_label(in_a);
+        _assert_fixed_label(in_b);
+        _assert_fixed_label(output);
+
+        format::append_uint(record, in_a, 4);
+        format::append_uint(record, in_b, 4);
+        format::append_uint(record, output, 4);
+        format::append_uint(record, _operation(gate), 4);
+    } else {
+        format::append_varint(record, (format::zigzag_encode(static_cast<int64_t>(output - _previous_output - 1)) << 2) | _operation(gate));
+        format::append_varint(record, format::zigzag_encode(static_cast<int64_t>(output - in_a)));
+        format::append_varint(record, format::zigzag_encode(static_cast<int64_t>(output - in_b)));
+    }
+
+    _previous_output = output;
+    _write_record(record, gate);
+}
+
+void gabe::bcgen::BinaryCircuitGenerator::_write_header(std::ofstream& file) {
+    std::string header;
+
+    // Header construction
+    header.append(format::magic, sizeof(format::magic));
+    format::append_uint(header, format::version, 2);
+    format::append_uint(header, static_cast<uint8_t>(_layout), 1);
+    format::append_uint(header, _checksums ? format::flag_checksums : 0x00, 1);
+    format::append_uint(header, _counter_gates, 8);
+    format::append_uint(header, _counter_wires, 8);
+    format::append_uint(header, _section_size, 8);
+    format::append_uint(header, format::checksum_block_size, 4);
+    format::append_uint(header, _input_parties.size(), 4);
+    format::append_uint(header, _output_parties.size(), 4);
+    format::append_uint(header, 0x00, 4);
+
+    // Parties sizes
+    for (auto size : _input_parties) {
+        format::append_uint(header, size, 8);
+    }
+    for (auto size : _output_parties) {
+        format::append_uint(header, size, 8);
+    }
+
+    // Header writing
+    file.write(header.c_str(), header.size());
+}
+
+void gabe::bcgen::BinaryCircuitGenerator::_write_circuit(std::ofstream& file) {
+    // Gates section
+    CircuitGenerator::_write_circuit(file);
+
+    if (!_checksums) return;
+
+    // Checksum of the last (incomplete) block
+    if (_section_size % format::checksum_block_size) {
+        _blocks_checksums.push_back(_block_checksum);
+    }
+
+    // Checksums section
+    std::string checksums;
+    for (auto checksum : _blocks_checksums) {
+        format::append_uint(checksums, checksum, 4);
+    }
+    file.write(checksums.c_str(), checksums.size());
+}
@@ -0,0 +1,160 @@
+#include <bcgen/CircuitTester.hpp>
+#include <bcgen/BinaryFormat.hpp>
+#include <fmt/format.h>
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+namespace format = gabe::bcgen::binary_format;
+
+gabe::bcgen::BinaryCircuitTester::BinaryCircuitTester() : CircuitTester() {
+    _gates_types = { {"XOR", GateType::XOR}, {"INV", GateType::INV}, {"AND", GateType::AND}, {"OR", GateType::OR} };
+    _circuit_extension = ".bcg";
+}
+
+void gabe::bcgen::BinaryCircuitTester::_read_header() {
+    // Safety check - File identification
+    if (_circuit_size < format::header_size || std::memcmp(_circuit, format::magic, sizeof(format::magic)) != 0) {
+        const std::string error_msg = "Failed to read circuit file. It is not a binary circuit file.";
+        throw std::runtime_error(error_msg);
+    }
+
+    // Fixed size part of the header
+    const uint64_t version = format::read_uint(_circuit + 4, 2);
+    _layout = format::read_uint(_circuit + 6, 1);
+    const uint8_t flags = format::read_uint(_circuit + 7, 1);
+    _counter_gates = format::read_uint(_circuit + 8, 8);
+    _counter_wires = format::read_uint(_circuit + 16, 8);
+    _section_size = format::read_uint(_circuit + 24, 8);
+    const uint64_t block_size = format::read_uint(_circuit + 32, 4);
+    const uint64_t n_input_parties = format::read_uint(_circuit + 36, 4);
+    const uint64_t n_output_parties = format::read_uint(_circuit + 40, 4);
+
+    // Safety check - Supported format
+    if (version != format::version || _layout > static_cast<uint8_t>(format::Layout::Varint)) {
+        const std::string error_msg = fmt::format("Unsupported binary circuit format (version {}, layout {}).", version, _layout);
+        throw std::runtime_error(error_msg);
+    }
+
+    // Sections positions
+    const uint64_t section_begin = format::header_size + 8 * (n_input_parties + n_output_parties);
+    const uint64_t n_blocks = block_size ? (_section_size + block_size - 1) / block_size : 0;
+    const uint64_t checksums_size = flags & format::flag_checksums ? 4 * n_blocks : 0;
+
+    // Safety check - Truncated file
+    if (section_begin > _circuit_size || _section_size > _circuit_size - section_begin || checksums_size > _circuit_size - section_begin - _section_size) {
+        const std::string error_msg = "Failed to read circuit file. The binary circuit file is truncated.";
+        throw std::runtime_error(error_msg);
+    }
+
+    // Input parties
+    // > The input wires are the first wires of the circuit
+    const char* cursor = _circuit + format::header_size;
+    uint64_t input_wires_counter = 0;
+    for (uint64_t i = 0; i < n_input_parties; i++, cursor += 8) {
+        const uint64_t cur_party_size = format::read_uint(cursor, 8);
+        _input_parties.push_back(cur_party_size);
+        std::vector<label_t> cur_party_wires;
+        for (uint64_t j = 0; j < cur_party_size; j++) {
+            cur_party_wires.push_back(input_wires_counter++);
+        }
+        _input_parties_wires.push_back(cur_party_wires);
+    }
+
+    // Output parties
+    // > The output wires are the last wires of the circuit
+    uint64_t total_output_wires = 0;
+    for (uint64_t i = 0; i < n_output_parties; i++, cursor += 8) {
+        _output_parties.push_back(format::read_uint(cursor, 8));
+        total_output_wires += _output_parties.back();
+    }
+    uint64_t output_wires_counter = 0;
+    for (uint64_t i = 0; i < n_output_parties; i++) {
+        std::vector<label_t> cur_party_wires;
+        for (uint64_t j = 0; j < _output_parties[i]; j++) {
+            cur_party_wires.push_back(_counter_wires - total_output_wires + output_wires_counter++);
+        }
+        _output_parties_wires.push_back(cur_party_wires);
+    }
+
+    // Blocks checksums verification
+    if (flags & format::flag_checksums) {
+        const char* checksums = _circuit + section_begin + _section_size;
+
+        for (uint64_t i = 0; i < n_blocks; i++) {
+            const uint64_t block_begin = i * block_size;
+            const uint64_t size = std::min(block_size, _section_size - block_begin);
+            const uint32_t checksum = format::checksum_update(format::checksum_seed, _circuit + section_begin + block_begin, size);
+
+            // Safety check
+            if (checksum != format::read_uint(checksums + 4 * i, 4)) {
+                const std::string error_msg = fmt::format("Failed to read circuit file. Checksum mismatch in block {} of the gates section.", i);
+                throw std::runtime_error(error_msg);
+            }
+        }
+    }
+
+    // The reading position is now at the start of the circuit
+    _circuit_position = section_begin;
+}
+
+void gabe::bcgen::BinaryCircuitTester::_read_gates() {
+    _gates.clear();
+    _gates.reserve(_counter_gates);
+
+    // Operation codes to gate types
+    static constexpr GateType types[4] = { GateType::XOR, GateType::AND, GateType::OR, GateType::INV };
+
+    // Gates section contents
+    const char* cursor = _circuit + _circuit_position;
+    const char* end = cursor + _section_size;
+
+    // Safety check - A fixed layout section has exactly one record per gate
+    if (_layout == static_cast<uint8_t>(format::Layout::Fixed) && _section_size != 16 * _counter_gates) {
+        const std::string error_msg = "Failed to read circuit file. The gates section does not match the number of gates.";
+        throw std::runtime_error(error_msg);
+    }
+
+    uint64_t previous_output = 0;
+    for (uint64_t i = 0; i < _counter_gates; i++) {
+        Gate gate;
+        uint64_t operation;
+
+        if (_layout == static_cast<uint8_t>(format::Layout::Fixed)) {
+            // Record: <input A> <input B> <output> <operation>
+            gate.in_a = format::read_uint(cursor, 4);
+            gate.in_b = format::read_uint(cursor + 4, 4);
+            gate.out = format::read_uint(cursor + 8, 4);
+            operation = format::read_uint(cursor + 12, 4);
+            cursor += 16;
+        } else {
+            // Record: <output delta | operation> <input A delta> [<input B delta>]
+            const uint64_t first = format::read_varint(cursor, end);
+            operation = first & 0x03;
+            gate.out = previous_output + format::zigzag_decode(first >> 2) + 1;
+            gate.in_a = gate.out - format::zigzag_decode(format::read_varint(cursor, end));
+            gate.in_b = operation == format::INV ? gate.in_a : gate.out - format::zigzag_decode(format::read_varint(cursor, end));
+        }
+
+        // Safety check
+        // > Every wire label must be one of the circuit wires given in the header
+        const bool invalid_labels = gate.in_a >= _counter_wires || gate.in_b >= _counter_wires || gate.out >= _counter_wires;
+        if (cursor > end || (cursor == end && i + 1 < _counter_gates) || operation > format::INV || invalid_labels) {
+            const std::string error_msg = fmt::format("Failed to read circuit file. Invalid gate record (gate {}).", i);
+            throw std::runtime_error(error_msg);
+        }
+
+        gate.type = types[operation];
+        _gates.push_back(gate);
+        previous_output = gate.out;
+    }
+
+    _circuit_position = cursor - _circuit;
+
+    // Setups the whole size of the wires
+    _wires = std::vector<uint8_t>(_counter_wires);
+}
@@ -4,36 +4,28 @@
 #include <cstdint>
 
 gabe::bcgen::BristolCircuitTester::BristolCircuitTester() : CircuitTester() {
-    _gates_operations = {
-        { "XOR", [&](const std::vector<std::string>& gate){ return _wires[std::stoi(gate[2])] ^ _wires[std::stoi(gate[3])]; } },
-        { "INV", [&](const std::vector<std::string>& gate){ return !_wires[std::stoi(gate[2])]; } },
-        { "AND", [&](const std::vector<std::string>& gate){ return _wires[std::stoi(gate[2])] & _wires[std::stoi(gate[3])]; } },
-        { "OR",  [&](const std::vector<std::string>& gate){ return _wires[std::stoi(gate[2])] | _wires[std::stoi(gate[3])]; } }
-    };
+    _gates_types = { {"XOR", GateType::XOR}, {"INV", GateType::INV}, {"AND", GateType::AND}, {"OR", GateType::OR} };
 }
 
 void gabe::bcgen::BristolCircuitTester::_read_header() {
-    std::string line;
-    std::vector<std::string> line_parts;
+    std::string_view line;
     
     // Reads the first line
     // > Should contain the total number of gates followed by the total number of wires
-    std::getline(_circuit, line);
-    line_parts = _split_str(line, " ");
-    _counter_gates = std::stoul(line_parts[0]);
-    _counter_wires = std::stoul(line_parts[1]);
+    line = _read_line();
+    _counter_gates = _scan_uint(line);
+    _counter_wires = _scan_uint(line);
 
     // Reads the second line
     // > Should contain the amount of input parties followed by their sizes
-    std::getline(_circuit, line);
-    line_parts = _split_str(line, " ");
-    int input_wires_counter = 0;
-    int n_input_parties = std::stoi(line_parts[0]);
-    for (int i = 0; i < n_input_parties; i++) {
-        int cur_party_size = std::stoi(line_parts[i+1]);
+    line = _read_line();
+    uint64_t input_wires_counter = 0;
+    uint64_t n_input_parties = _scan_uint(line);
+    for (uint64_t i = 0; i < n_input_parties; i++) {
+        uint64_t cur_party_size = _scan_uint(line);
         _input_parties.push_back(cur_party_size);
-        std::vector<uint64_t> cur_party_wires;
-        for (int j = 0; j < cur_party_size; j++) {
+        std::vector<label_t> cur_party_wires;
+        for (uint64_t j = 0; j < cur_party_size; j++) {
             cur_party_wires.push_back(input_wires_counter++);
         }
         _input_parties_wires.push_back(cur_party_wires);
@@ -41,19 +33,18 @@ void gabe::bcgen::BristolCircuitTester::_read_header() {
 
     // Reads the third line
     // > Should contain the amount of output parties followed by their sizes
-    std::getline(_circuit, line);
-    line_parts = _split_str(line, " ");
-    int output_wires_counter = 0;
-    int total_output_wires = 0;
-    int n_output_parties = std::stoi(line_parts[0]);
-    for (int i = 0; i < n_output_parties; i++) {
-        int cur_party_size = std::stoi(line_parts[i+1]);
+    line = _read_line();
+    uint64_t output_wires_counter = 0;
+    uint64_t total_output_wires = 0;
+    uint64_t n_output_parties = _scan_uint(line);
+    for (uint64_t i = 0; i < n_output_parties; i++) {
+        uint64_t cur_party_size = _scan_uint(line);
         _output_parties.push_back(cur_party_size);
         total_output_wires += cur_party_size;
     }
-    for (int i = 0; i < n_output_parties; i++) {
-        std::vector<uint64_t> cur_party_wires;
-        for (int j = 0; j < _output_parties[i]; j++) {
+    for (uint64_t i = 0; i < n_output_parties; i++) {
+        std::vector<label_t> cur_party_wires;
+        for (uint64_t j = 0; j < _output_parties[i]; j++) {
             cur_party_wires.push_back(_counter_wires - total_output_wires + output_wires_counter);
             output_wires_counter++;
         }
@@ -61,14 +52,6 @@ void gabe::bcgen::BristolCircuitTester::_read_header() {
     }
 
     // Ignores the next line (empty line)
-    std::getline(_circuit, line);
-
-    // Saves the current read index (start of the circuit)
-    _circuit_start_pos = _circuit.tellg();
-
-    // Setups the whole size of the wires
-    _wires = std::vector<uint8_t>(_counter_wires);
-
-    // Prints circuit information to the user
-    _print_circuit_info();
+    // > The reading position is now at the start of the circuit
+    _read_line();
 }
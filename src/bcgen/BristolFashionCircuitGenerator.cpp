@@ -0,0 +1,128 @@
+#include <bcgen/CircuitGenerator.hpp>
+#include <fmt/format.h>
+
+#include <numeric>
+#include <algorithm>
+
+gabe::bcgen::BristolFashionCircuitGenerator::BristolFashionCircuitGenerator(const std::string &circuit_name, const std::string &circuits_directory) : BristolCircuitGenerator("fashion_" + circuit_name, circuits_directory) {
+    _gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"}, {"eq", "EQ"}, {"eqw", "EQW"}, {"mand", "MAND"} };
+}
+
+void gabe::bcgen::BristolFashionCircuitGenerator::_write_1_1_gate(const uint64_t in_a, const uint64_t output, const std::string &gate) {
+    // EQ gates have a constant value instead of an input wire
+    const uint8_t inputs = gate == _gates_map["eq"] ? 0 : 1;
+    _gates.push_back(Gate{ label_t(in_a), label_t(in_a), label_t(output), inputs, gate });
+
+    // Increments the counters
+    _counter_gates++;
+    _gates_counters[gate]++;
+}
+
+void gabe::bcgen::BristolFashionCircuitGenerator::_write_2_1_gate(const uint64_t in_a, const uint64_t in_b, const uint64_t output, const std::string &gate) {
+    _gates.push_back(Gate{ label_t(std::min(in_a, in_b)), label_t(std::max(in_a, in_b)), label_t(output), 2, gate });
+
+    // Increments the counters
+    _counter_gates++;
+    _gates_counters[gate]++;
+}
+
+void gabe::bcgen::BristolFashionCircuitGenerator::_batch_gates() {
+    const std::string& and_gate = _gates_map["and"];
+
+    // AND layer of each wire and position of each gate
+    // > Input wires are at layer 0
+    std::vector<uint64_t> wires_layers(_counter_wires, 0);
+    std::vector<uint64_t> gates_positions(_gates.size());
+    uint64_t n_positions = 1;
+    for (uint64_t i = 0; i < _gates.size(); i++) {
+        const Gate& gate = _gates[i];
+        const bool is_and = gate.name == and_gate;
+
+        // Wires can be written more than once if their labels are reused, thus the gates must keep their order
+        if (_reuse_labels) {
+            gates_positions[i] = i;
+            n_positions = i + 1;
+            continue;
+        }
+
+        uint64_t layer = gate.inputs ? std::max(wires_layers[gate.in_a], wires_layers[gate.in_b]) : 0;
+        if (is_and) {
+            layer++;
+        }
+
+        wires_layers[gate.out] = layer;
+        gates_positions[i] = is_and ? 2 * layer - 1 : 2 * layer;
+        n_positions = std::max(n_positions, gates_positions[i] + 1);
+    }
+
+    // Places every gate in its position (stable counting sort)
+    std::vector<uint64_t> offsets(n_positions + 1, 0);
+    for (auto position : gates_positions) {
+        offsets[position + 1]++;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<uint64_t> order(_gates.size());
+    for (uint64_t i = 0; i < _gates.size(); i++) {
+        order[offsets[gates_positions[i]]++] = i;
+    }
+
+    // Writes the gates lines
+    // > The AND gates of a position are contiguous, and are written in a single MAND line
+    auto write_line = [&](const std::string& line) {
+        _buffer.push_back(line);
+        _buffer_size += line.size();
+    };
+
+    for (uint64_t i = 0; i < order.size();) {
+        const Gate& gate = _gates[order[i]];
+
+        // Batch of AND gates
+        uint64_t batch_end = i + 1;
+        if (gate.name == and_gate) {
+            while (batch_end < order.size() && gates_positions[order[batch_end]] == gates_positions[order[i]]) {
+                batch_end++;
+            }
+        }
+
+        if (batch_end - i > 1) {
+            std::vector<uint64_t> in_a, in_b, out;
+            for (uint64_t j = i; j < batch_end; j++) {
+                in_a.push_back(_gates[order[j]].in_a);
+                in_b.push_back(_gates[order[j]].in_b);
+                out.push_back(_gates[order[j]].out);
+            }
+
+            write_line(fmt::format("{} {} {} {} {} {}\n",
+                2 * out.size(), out.size(), fmt::join(in_a, " "), fmt::join(in_b, " "), fmt::join(out, " "), _gates_map["mand"]
+            ));
+        } else if (gate.inputs == 2) {
+            write_line(fmt::format("2 1 {} {} {} {}\n", gate.in_a, gate.in_b, gate.out, gate.name));
+        } else {
+            write_line(fmt::format("1 1 {} {} {}\n", gate.in_a, gate.out, gate.name));
+        }
+
+        i = batch_end;
+    }
+
+    // The gates are no longer needed
+    _gates.clear();
+    _gates.shrink_to_fit();
+}
+
+void gabe::bcgen::BristolFashionCircuitGenerator::_write_header(std::ofstream& file) {
+    // The number of gate lines is only known once the gates are batched
+    _batch_gates();
+
+    // Header construction
+    const std::string header = fmt::format("{} {}\n", _buffer.size(), _counter_wires);
+    const std::string inputs = fmt::format("{} {}\n", _input_parties.size(), fmt::join(_input_parties, " "));
+    const std::string outputs = fmt::format("{} {}\n", _output_parties.size(), fmt::join(_output_parties, " "));
+    const std::string linebrk = "\n";
+
+    // Header writing
+    file.write(header.c_str(), header.size());
+    file.write(inputs.c_str(), inputs.size());
+    file.write(outputs.c_str(), outputs.size());
+    file.write(linebrk.c_str(), linebrk.size());
+}
@@ -0,0 +1,8 @@
+#include <bcgen/CircuitTester.hpp>
+
+gabe::bcgen::BristolFashionCircuitTester::BristolFashionCircuitTester() : BristolCircuitTester() {
+    _gates_types = {
+        {"XOR", GateType::XOR}, {"INV", GateType::INV}, {"AND", GateType::AND}, {"OR", GateType::OR},
+        {"EQ", GateType::EQ}, {"EQW", GateType::EQW}, {"MAND", GateType::AND}
+    };
+}
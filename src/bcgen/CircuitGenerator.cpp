@@ -2,6 +2,12 @@
 #include <bcgen/CircuitGenerator.hpp>
 #include <fmt/format.h>
 
+#include <queue>
+#include <limits>
+#include <bit>
+#include <numeric>
+#include <algorithm>
+
 void gabe::bcgen::CircuitGenerator::_create_save_directory() {
     // There is nothing to be created if the specified directory is empty
     if (_circuits_directory.empty()) return;
@@ -31,7 +37,7 @@ void gabe::bcgen::CircuitGenerator::_write_gate(const std::string& line, const s
         // Open the temporary circuit file
         std::ofstream temp_circuit(
             _circuits_directory / (_circuit_name + "_temp.txt"),
-            std::ios::out | std::ios::app
+            std::ios::out | std::ios::app | std::ios::binary
         );
 
         // Flushes the buffer into the temporary file
@@ -55,6 +61,319 @@ void gabe::bcgen::CircuitGenerator::_write_2_1_gate(const uint64_t in_a, const u
     _write_gate(line, gate);
 }
 
+void gabe::bcgen::CircuitGenerator::_add_1_1_gate(const uint64_t in_a, const uint64_t output, const std::string &gate) {
+    if (!_reuse_labels && !_schedule_gates) {
+        _write_1_1_gate(in_a, output, gate);
+        return;
+    }
+
+    // EQ gates have a constant value instead of an input wire
+    auto constant_gate = _gates_map.find("eq");
+    const uint8_t inputs = constant_gate != _gates_map.end() && constant_gate->second == gate ? 0 : 1;
+    _recorded_gates.push_back(RecordedGate{ label_t(in_a), label_t(in_a), label_t(output), inputs, &gate });
+
+    // Increments the counters
+    _counter_gates++;
+    _gates_counters[gate]++;
+}
+
+void gabe::bcgen::CircuitGenerator::_add_2_1_gate(const uint64_t in_a, const uint64_t in_b, const uint64_t output, const std::string &gate) {
+    if (!_reuse_labels && !_schedule_gates) {
+        _write_2_1_gate(in_a, in_b, output, gate);
+        return;
+    }
+
+    _recorded_gates.push_back(RecordedGate{ label_t(in_a), label_t(in_b), label_t(output), 2, &gate });
+
+    // Increments the counters
+    _counter_gates++;
+    _gates_counters[gate]++;
+}
+
+void gabe::bcgen::CircuitGenerator::_schedule() {
+    const uint64_t n_gates = _recorded_gates.size();
+    const uint64_t n_outputs = _output_wires.size();
+    const uint64_t n_scheduled = n_gates - n_outputs;
+    const uint64_t none = std::numeric_limits<uint64_t>::max();
+
+    _schedule_report.before = _reuse_distance();
+
+    // Gate that writes each wire
+    std::vector<uint64_t> writers(_counter_wires, none);
+    for (uint64_t i = 0; i < n_scheduled; i++) {
+        writers[_recorded_gates[i].out] = i;
+    }
+
+    // Gates that read each wire (compressed rows, indexed by the gate that writes the wire)
+    // > Each gate also counts its input wires that are written by a gate not yet placed
+    std::vector<uint64_t> readers_offsets(n_scheduled + 1, 0);
+    std::vector<uint8_t> pending_inputs(n_scheduled, 0);
+    auto for_each_writer = [&](const RecordedGate& gate, auto&& function) {
+        if (gate.inputs == 0) return;
+        if (writers[gate.in_a] != none) function(writers[gate.in_a]);
+        if (gate.inputs == 2 && gate.in_b != gate.in_a && writers[gate.in_b] != none) function(writers[gate.in_b]);
+    };
+    for (uint64_t i = 0; i < n_scheduled; i++) {
+        for_each_writer(_recorded_gates[i], [&](uint64_t writer) { readers_offsets[writer + 1]++; pending_inputs[i]++; });
+    }
+    std::partial_sum(readers_offsets.begin(), readers_offsets.end(), readers_offsets.begin());
+
+    std::vector<uint64_t> readers(readers_offsets.back());
+    std::vector<uint64_t> positions(readers_offsets.begin(), readers_offsets.end() - 1);
+    for (uint64_t i = 0; i < n_scheduled; i++) {
+        for_each_writer(_recorded_gates[i], [&](uint64_t writer) { readers[positions[writer]++] = i; });
+    }
+
+    // List scheduling
+    // > Among the gates whose input wires are all written, the next gate is the one that reads the most recently written wire
+    // > Ties keep the original order of the gates
+    std::priority_queue<std::pair<uint64_t, uint64_t>> ready;
+    for (uint64_t i = 0; i < n_scheduled; i++) {
+        if (!pending_inputs[i]) ready.push({ 0, none - i });
+    }
+
+    std::vector<RecordedGate> scheduled_gates;
+    scheduled_gates.reserve(n_gates);
+    while (!ready.empty()) {
+        const uint64_t index = none - ready.top().second;
+        ready.pop();
+
+        scheduled_gates.push_back(_recorded_gates[index]);
+        for (uint64_t j = readers_offsets[index]; j < readers_offsets[index + 1]; j++) {
+            if (!--pending_inputs[readers[j]]) {
+                ready.push({ scheduled_gates.size(), none - readers[j] });
+            }
+        }
+    }
+
+    // Output copies stay the last gates
+    for (uint64_t i = n_scheduled; i < n_gates; i++) {
+        scheduled_gates.push_back(_recorded_gates[i]);
+    }
+    std::swap(_recorded_gates, scheduled_gates);
+    _schedule_report.after = _reuse_distance();
+
+    // The original order is kept when the scheduling does not shorten the reuse distances
+    if (_schedule_report.after.mean > _schedule_report.before.mean) {
+        std::swap(_recorded_gates, scheduled_gates);
+        _schedule_report.after = _schedule_report.before;
+    }
+}
+
+gabe::bcgen::ReuseDistance gabe::bcgen::CircuitGenerator::_reuse_distance() const {
+    const uint64_t none = std::numeric_limits<uint64_t>::max();
+
+    // Position of the gate that writes each wire
+    std::vector<uint64_t> writers(_counter_wires, none);
+    ReuseDistance distance;
+    uint64_t reads = 0;
+    double total = 0;
+
+    for (uint64_t i = 0; i < _recorded_gates.size(); i++) {
+        const RecordedGate& gate = _recorded_gates[i];
+
+        for (uint8_t input = 0; input < std::min<uint8_t>(gate.inputs, 2); input++) {
+            // Constant wires are read all over the circuit, and do not depend on the order of the gates
+            const uint64_t label = input ? gate.in_b : gate.in_a;
+            const uint64_t writer = writers[label];
+            if (writer == none || label == _zero_wire.label || label == _one_wire.label) continue;
+
+            total += i - writer;
+            distance.max = std::max(distance.max, i - writer);
+            reads++;
+        }
+
+        writers[gate.out] = i;
+    }
+
+    distance.mean = reads ? total / reads : 0;
+    return distance;
+}
+
+void gabe::bcgen::CircuitGenerator::_reassign_labels() {
+    const uint64_t n_gates = _recorded_gates.size();
+    const uint64_t n_outputs = _output_wires.size();
+
+    // Last gate that reads each wire (only needed to reuse the labels)
+    // > Wires that are never read are dead as soon as they are written
+    const uint64_t never = std::numeric_limits<uint64_t>::max();
+    std::vector<uint64_t> last_reads(_reuse_labels ? _counter_wires : 0, never);
+    for (uint64_t i = 0; _reuse_labels && i < n_gates; i++) {
+        const RecordedGate& gate = _recorded_gates[i];
+        if (gate.inputs) {
+            last_reads[gate.in_a] = i;
+            last_reads[gate.in_b] = i;
+        }
+    }
+
+    // New label of every wire
+    // > The input wires keep their labels
+    std::vector<label_t> labels(_counter_wires);
+    std::iota(labels.begin(), labels.begin() + _expected_input_wires, label_t(0));
+    std::vector<label_t> dead_labels;
+    uint64_t counter_wires = _expected_input_wires;
+
+    // The replayed gates are counted again
+    _counter_gates = 0;
+    _gates_counters.clear();
+
+    for (uint64_t i = 0; i < n_gates; i++) {
+        const RecordedGate& gate = _recorded_gates[i];
+
+        // Input wires labels (EQ gates have a constant value instead)
+        const label_t in_a = gate.inputs ? labels[gate.in_a] : gate.in_a;
+        const label_t in_b = gate.inputs ? labels[gate.in_b] : gate.in_b;
+
+        // Input wires read for the last time can give their labels to the output wire
+        if (_reuse_labels && gate.inputs && last_reads[gate.in_a] == i) {
+            dead_labels.push_back(in_a);
+        }
+        if (_reuse_labels && gate.inputs && gate.in_b != gate.in_a && last_reads[gate.in_b] == i) {
+            dead_labels.push_back(in_b);
+        }
+
+        // Output wire label
+        // > The circuit outputs are copied by the last gates of the circuit, and must have the last labels
+        label_t out;
+        if (i < n_gates - n_outputs && !dead_labels.empty()) {
+            out = dead_labels.back();
+            dead_labels.pop_back();
+        } else {
+            out = counter_wires++;
+        }
+        labels[gate.out] = out;
+
+        if (_reuse_labels && i < n_gates - n_outputs && last_reads[gate.out] == never) {
+            dead_labels.push_back(out);
+        }
+
+        if (gate.inputs == 2) {
+            _write_2_1_gate(in_a, in_b, out, *gate.gate);
+        } else {
+            _write_1_1_gate(in_a, out, *gate.gate);
+        }
+    }
+
+    // The gates are no longer needed
+    _recorded_gates.clear();
+    _recorded_gates.shrink_to_fit();
+
+    _counter_wires = counter_wires;
+}
+
+void gabe::bcgen::CircuitGenerator::_track_gate(const uint64_t in_a, const uint64_t in_b, const uint64_t output, const std::string &gate) {
+    if (!_track_depth && !_profiling) return;
+
+    // Makes sure all the wires have a depth
+    if (_wires_depths.size() < _counter_wires) {
+        _wires_depths.resize(_counter_wires);
+    }
+
+    // Copies of wires (EQW gates) do not compute anything
+    auto copy_gate = _gates_map.find("eqw");
+    const bool is_copy = copy_gate != _gates_map.end() && copy_gate->second == gate;
+    const bool is_and = gate == _gates_map["and"];
+
+    // The output wire is one gate deeper than the deepest input wire
+    const Depth& depth_a = _wires_depths[in_a];
+    const Depth& depth_b = _wires_depths[in_b];
+    Depth depth;
+    depth.depth = std::max(depth_a.depth, depth_b.depth) + (is_copy ? 0 : 1);
+    depth.and_depth = std::max(depth_a.and_depth, depth_b.and_depth) + (is_and ? 1 : 0);
+
+    _wires_depths[output] = depth;
+
+    if (!_profiling) return;
+
+    // Attributes the gate to the innermost profiling scope
+    ProfileNode& node = _profile_nodes[_profile_node];
+    node.gates++;
+    node.and_gates += is_and;
+    node.wires++;
+    node.depth = std::max(node.depth, depth.depth);
+    node.and_depth = std::max(node.and_depth, depth.and_depth);
+    node.gates_counters[gate]++;
+}
+
+void gabe::bcgen::CircuitGenerator::_profile_push(const char* name) {
+    // Finds the scope in the children of the current scope, or creates it
+    auto child = _profile_nodes[_profile_node].children.find(name);
+    uint64_t index;
+    if (child != _profile_nodes[_profile_node].children.end()) {
+        index = child->second;
+    } else {
+        index = _profile_nodes.size();
+        _profile_nodes[_profile_node].children[name] = index;
+        _profile_nodes.emplace_back();
+        _profile_nodes[index].name = name;
+        _profile_nodes[index].parent = _profile_node;
+    }
+
+    _profile_nodes[index].calls++;
+    _profile_node = index;
+}
+
+void gabe::bcgen::CircuitGenerator::_profile_pop() {
+    _profile_node = _profile_nodes[_profile_node].parent;
+}
+
+uint64_t gabe::bcgen::CircuitGenerator::_shadow_lanes(uint64_t label) const {
+    return label < _shadow_values.size() ? _shadow_values[label] : 0x00;
+}
+
+void gabe::bcgen::CircuitGenerator::_shadow_gate(uint64_t label, uint64_t lanes) {
+    // Makes sure all the wires have a value
+    if (_shadow_values.size() < _counter_wires) {
+        _shadow_values.resize(_counter_wires);
+    }
+
+    _shadow_values[label] = lanes;
+}
+
+gabe::bcgen::label_t gabe::bcgen::CircuitGenerator::_new_label() {
+    // Safety check
+    _assert_new_label();
+
+    return _counter_wires++;
+}
+
+gabe::bcgen::Wire gabe::bcgen::CircuitGenerator::_extended(const Variable& variable, uint64_t index, bool is_signed) const {
+    if (index < variable.size()) {
+        return variable[index];
+    }
+
+    // The wires after the most significant one are copies of the sign wire, or zero wires
+    return is_signed && variable.size() ? variable[variable.size() - 1] : _zero_wire;
+}
+
+void gabe::bcgen::CircuitGenerator::_fold_XOR(const Wire in_a, const Wire in_b, Wire& out) {
+    if (in_a.label == _zero_wire.label) {
+        out = in_b;
+    } else if (in_b.label == _zero_wire.label) {
+        out = in_a;
+    } else {
+        XOR(in_a, in_b, out);
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::_fold_AND(const Wire in_a, const Wire in_b, Wire& out) {
+    if (in_a.label == _zero_wire.label || in_b.label == _zero_wire.label) {
+        out = _zero_wire;
+    } else {
+        AND(in_a, in_b, out);
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::_fold_OR(const Wire in_a, const Wire in_b, Wire& out) {
+    if (in_a.label == _zero_wire.label) {
+        out = in_b;
+    } else if (in_b.label == _zero_wire.label) {
+        out = in_a;
+    } else {
+        OR(in_a, in_b, out);
+    }
+}
+
 void gabe::bcgen::CircuitGenerator::_assert_equal_size(const Variable &variable, uint64_t size) {
     // Checks if the variable as the expected size
     if (variable.size() != size) {
@@ -88,6 +407,26 @@ void gabe::bcgen::CircuitGenerator::_assert_add_output(uint64_t size) {
     }
 }
 
+void gabe::bcgen::CircuitGenerator::_assert_shadow() const {
+    if (!_shadow) {
+        // Creates the error message
+        const std::string error_msg = "The shadow evaluation is disabled. Enable it with shadow before adding the circuit inputs.";
+
+        // Raises the error
+        throw std::runtime_error(error_msg);
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::_assert_new_label() const {
+    if (_counter_wires >= max_wires) {
+        // Creates the error message
+        const std::string error_msg = fmt::format("The circuit exceeds the {} wires supported by {} bits labels. Build bcgen with BCGEN_64BIT_LABELS instead.", max_wires, 8 * sizeof(label_t));
+
+        // Raises the error
+        throw std::runtime_error(error_msg);
+    }
+}
+
 gabe::bcgen::CircuitGenerator::CircuitGenerator(const std::string &circuit_name, const std::string &circuits_directory) : _circuit_name(circuit_name), _circuits_directory(circuits_directory) {
     _create_save_directory();
 }
@@ -102,17 +441,13 @@ void gabe::bcgen::CircuitGenerator::_write_circuit(std::ofstream& file) {
     // Open the temporary circuit file
     std::ifstream temp_circuit(
         _circuits_directory / (_circuit_name + "_temp.txt"),
-        std::ios::in
+        std::ios::in | std::ios::binary
     );
 
     // Can only move temp contents if file was created
-    if (!temp_circuit.fail()) {
-        // Contents transfer
-        std::string line;
-        while (std::getline(temp_circuit, line)) {
-            line += "\n";
-            file.write(line.c_str(), line.size());
-        }
+    // > The contents are copied as they are, since they are not always text lines
+    if (!temp_circuit.fail() && temp_circuit.peek() != std::ifstream::traits_type::eof()) {
+        file << temp_circuit.rdbuf();
     }
 
     // Writes unflushed data inside the buffer 
@@ -123,6 +458,171 @@ void gabe::bcgen::CircuitGenerator::limit_buffer(uint64_t size) {
     _buffer_max_size = size;
 }
 
+void gabe::bcgen::CircuitGenerator::reuse_labels(bool enable) {
+    _reuse_labels = enable;
+}
+
+void gabe::bcgen::CircuitGenerator::schedule_gates(bool enable) {
+    _schedule_gates = enable;
+}
+
+const gabe::bcgen::ScheduleReport& gabe::bcgen::CircuitGenerator::schedule_report() const {
+    return _schedule_report;
+}
+
+void gabe::bcgen::CircuitGenerator::log_depth_comparators(bool enable) {
+    _log_depth_comparators = enable;
+}
+
+void gabe::bcgen::CircuitGenerator::track_depth(bool enable) {
+    _track_depth = enable;
+}
+
+gabe::bcgen::Depth gabe::bcgen::CircuitGenerator::depth(const Wire& wire) const {
+    // Safety check
+    if (!_track_depth) {
+        const std::string error_msg = "The depth tracking is disabled. Enable it with track_depth before starting the circuit.";
+        throw std::runtime_error(error_msg);
+    }
+
+    // Wires without a tracked depth are input wires
+    return wire.label < _wires_depths.size() ? _wires_depths[wire.label] : Depth();
+}
+
+gabe::bcgen::Depth gabe::bcgen::CircuitGenerator::depth(const Variable& variable) const {
+    Depth variable_depth;
+
+    // Deepest wire of the variable
+    for (auto & wire : variable) {
+        const Depth wire_depth = depth(wire);
+        variable_depth.depth = std::max(variable_depth.depth, wire_depth.depth);
+        variable_depth.and_depth = std::max(variable_depth.and_depth, wire_depth.and_depth);
+    }
+
+    return variable_depth;
+}
+
+void gabe::bcgen::CircuitGenerator::profile(bool enable) {
+    _profiling = enable;
+
+    // The profiling reports the depth of the scopes
+    if (enable) {
+        _track_depth = true;
+    }
+
+    // Restarts the call path tree with the root scope
+    _profile_nodes.assign(1, ProfileNode());
+    _profile_nodes[0].name = _circuit_name;
+    _profile_nodes[0].calls = 1;
+    _profile_node = 0;
+}
+
+std::string gabe::bcgen::CircuitGenerator::profile_folded() const {
+    std::string report;
+
+    // Call path of every node
+    std::vector<std::string> paths(_profile_nodes.size());
+    for (uint64_t i = 0; i < _profile_nodes.size(); i++) {
+        const ProfileNode& node = _profile_nodes[i];
+        paths[i] = i ? paths[node.parent] + ";" + node.name : node.name;
+
+        // One line per gate written directly in the scope
+        for (auto & [gate, count] : node.gates_counters) {
+            report += fmt::format("{};{} {}\n", paths[i], gate, count);
+        }
+    }
+
+    return report;
+}
+
+std::string gabe::bcgen::CircuitGenerator::profile_json() const {
+    if (_profile_nodes.empty()) return "{}";
+
+    // Total costs of every node (scope and children)
+    // > Children are always created after their parents
+    std::vector<ProfileNode> totals(_profile_nodes.begin(), _profile_nodes.end());
+    for (uint64_t i = totals.size() - 1; i > 0; i--) {
+        ProfileNode& parent = totals[totals[i].parent];
+        parent.gates += totals[i].gates;
+        parent.and_gates += totals[i].and_gates;
+        parent.wires += totals[i].wires;
+        parent.depth = std::max(parent.depth, totals[i].depth);
+        parent.and_depth = std::max(parent.and_depth, totals[i].and_depth);
+    }
+
+    // Escapes the special characters of a JSON string
+    auto escape = [](const std::string& text) {
+        std::string escaped;
+        for (char c : text) {
+            if (c == '"' || c == '\\') escaped.push_back('\\');
+            escaped.push_back(c);
+        }
+        return escaped;
+    };
+
+    // Writes a node and its children
+    auto write_node = [&](auto& write_node, uint64_t index) -> std::string {
+        const ProfileNode& node = _profile_nodes[index];
+        const ProfileNode& total = totals[index];
+
+        std::vector<std::string> children;
+        for (auto & [name, child] : node.children) {
+            children.push_back(write_node(write_node, child));
+        }
+
+        return fmt::format(
+            "{{\"name\":\"{}\",\"calls\":{},\"gates\":{},\"and_gates\":{},\"wires\":{},\"depth\":{},\"and_depth\":{},"
+            "\"self\":{{\"gates\":{},\"and_gates\":{},\"wires\":{}}},\"children\":[{}]}}",
+            escape(node.name), node.calls, total.gates, total.and_gates, total.wires, total.depth, total.and_depth,
+            node.gates, node.and_gates, node.wires, fmt::join(children, ",")
+        );
+    };
+
+    return write_node(write_node, 0);
+}
+
+void gabe::bcgen::CircuitGenerator::shadow(bool enable) {
+    _shadow = enable;
+}
+
+bool gabe::bcgen::CircuitGenerator::value(const Wire& wire, uint64_t lane) const {
+    return (lanes(wire) >> lane) & 0x01;
+}
+
+uint64_t gabe::bcgen::CircuitGenerator::value(const Variable& variable, uint64_t lane) const {
+    // Safety check
+    if (variable.size() > 64) {
+        const std::string error_msg = fmt::format("Variable of size {} does not fit in a value. Use the lanes method instead.", variable.size());
+        throw std::runtime_error(error_msg);
+    }
+
+    // The i-th wire is the i-th bit of the value
+    uint64_t variable_value = 0;
+    for (uint64_t i = 0; i < variable.size(); i++) {
+        variable_value |= uint64_t(value(variable[i], lane)) << i;
+    }
+
+    return variable_value;
+}
+
+uint64_t gabe::bcgen::CircuitGenerator::lanes(const Wire& wire) const {
+    // Safety check
+    _assert_shadow();
+
+    return _shadow_lanes(wire.label);
+}
+
+std::vector<uint64_t> gabe::bcgen::CircuitGenerator::lanes(const Variable& variable) const {
+    std::vector<uint64_t> variable_lanes;
+    variable_lanes.reserve(variable.size());
+
+    for (auto & wire : variable) {
+        variable_lanes.push_back(lanes(wire));
+    }
+
+    return variable_lanes;
+}
+
 void gabe::bcgen::CircuitGenerator::add_input_party(uint64_t size) {
     _input_parties.push_back(size);
     _expected_input_wires += size;
@@ -138,7 +638,7 @@ void gabe::bcgen::CircuitGenerator::add_input(Wire& wire) {
     _assert_add_input(1);
     
     // Assigns a label to the wire
-    wire.label = _counter_wires++;
+    wire.label = _new_label();
 }
 
 void gabe::bcgen::CircuitGenerator::add_input(Variable& variable) {
@@ -147,7 +647,45 @@ void gabe::bcgen::CircuitGenerator::add_input(Variable& variable) {
 
     // Assigns a label to all the wires
     for (int i = 0; i < variable.size(); i++) {
-        variable[i].label = _counter_wires++;
+        variable[i].label = _new_label();
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::add_input(Wire& wire, bool value) {
+    // Safety check
+    _assert_shadow();
+
+    add_input(wire);
+
+    // The value is the same in all the lanes
+    _shadow_gate(wire.label, value ? ~uint64_t(0) : 0x00);
+}
+
+void gabe::bcgen::CircuitGenerator::add_input(Variable& variable, uint64_t value) {
+    // Safety check
+    _assert_shadow();
+
+    add_input(variable);
+
+    // The value is the same in all the lanes
+    for (uint64_t i = 0; i < variable.size(); i++) {
+        const bool bit = i < 64 && (value >> i) & 0x01;
+        _shadow_gate(variable[i].label, bit ? ~uint64_t(0) : 0x00);
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::add_input_lanes(Variable& variable, const std::vector<uint64_t>& lanes) {
+    // Safety checks
+    _assert_shadow();
+    if (lanes.size() != variable.size()) {
+        const std::string error_msg = fmt::format("Expected the lanes of {} wires, but got {}.", variable.size(), lanes.size());
+        throw std::runtime_error(error_msg);
+    }
+
+    add_input(variable);
+
+    for (uint64_t i = 0; i < variable.size(); i++) {
+        _shadow_gate(variable[i].label, lanes[i]);
     }
 }
 
@@ -195,21 +733,58 @@ void gabe::bcgen::CircuitGenerator::start() {
     }
 
     // Creates the zero and one wires
-    XOR( Wire(), Wire(), _zero_wire );
-    INV( _zero_wire, _one_wire ); 
+    // > Formats with a constant assignment gate (EQ) assign the values directly
+    if (_gates_map.count("eq")) {
+        _add_1_1_gate( 0, _zero_wire.label = _new_label(), _gates_map["eq"] );
+        _add_1_1_gate( 1, _one_wire.label = _new_label(), _gates_map["eq"] );
+        _track_gate( _zero_wire.label, _zero_wire.label, _zero_wire.label, _gates_map["eq"] );
+        _track_gate( _one_wire.label, _one_wire.label, _one_wire.label, _gates_map["eq"] );
+        if (_shadow) {
+            _shadow_gate( _zero_wire.label, 0x00 );
+            _shadow_gate( _one_wire.label, ~uint64_t(0) );
+        }
+    } else {
+        XOR( Wire(), Wire(), _zero_wire );
+        INV( _zero_wire, _one_wire );
+    }
+
+    // Constant wires do not depend on the circuit inputs
+    if (_track_depth) {
+        _wires_depths.resize(_counter_wires);
+        _wires_depths[_zero_wire.label] = Depth();
+        _wires_depths[_one_wire.label] = Depth();
+    }
 }
 
 void gabe::bcgen::CircuitGenerator::stop() {
     // This is just to make the output wires the last ones written in the circuit file
+    // > Formats with a wire copy gate (EQW) copy the wire instead of computing an AND gate
     // TODO - Think of a better way to do this...
     for (auto& wire : _output_wires) {
-        AND(*wire, _one_wire, *wire);
+        if (_gates_map.count("eqw")) {
+            const uint64_t label = wire->label;
+            _add_1_1_gate( label, wire->label = _new_label(), _gates_map["eqw"] );
+            _track_gate( label, label, wire->label, _gates_map["eqw"] );
+            if (_shadow) _shadow_gate( wire->label, _shadow_lanes(label) );
+        } else {
+            AND(*wire, _one_wire, *wire);
+        }
+    }
+
+    // Gates kept in memory are reordered and relabeled
+    // > Labels of the dead wires are given to new wires
+    const uint64_t created_wires = _counter_wires;
+    if (_schedule_gates) {
+        _schedule();
+    }
+    if (_reuse_labels || _schedule_gates) {
+        _reassign_labels();
     }
 
     // Open circuit file
     std::ofstream circuit(
-        _circuits_directory / (_circuit_name + ".txt"),
-        std::ios::out | std::ios::trunc
+        _circuits_directory / (_circuit_name + _circuit_extension),
+        std::ios::out | std::ios::trunc | std::ios::binary
     );
 
     // Safety check
@@ -232,7 +807,40 @@ void gabe::bcgen::CircuitGenerator::stop() {
     printf("-> XOR: %lu\n", _gates_counters[_gates_map["xor"]]);
     printf("-> AND: %lu\n", _gates_counters[_gates_map["and"]]);
     printf("-> INV: %lu\n", _gates_counters[_gates_map["inv"]]);
+    if (_gates_map.count("eq")) printf("-> EQ: %lu\n", _gates_counters[_gates_map["eq"]]);
+    if (_gates_map.count("eqw")) printf("-> EQW: %lu\n", _gates_counters[_gates_map["eqw"]]);
     printf("> Total wires: %lu\n", _counter_wires);
+    if (_reuse_labels) printf("-> Created: %lu\n", created_wires);
+    if (_schedule_gates) {
+        printf("> Mean reuse distance: %.1f -> %.1f\n", _schedule_report.before.mean, _schedule_report.after.mean);
+        printf("> Max reuse distance: %lu -> %lu\n", _schedule_report.before.max, _schedule_report.after.max);
+    }
+
+    // Depth report
+    if (_track_depth) {
+        Depth circuit_depth;
+        for (auto& wire : _output_wires) {
+            circuit_depth.depth = std::max(circuit_depth.depth, _wires_depths[wire->label].depth);
+            circuit_depth.and_depth = std::max(circuit_depth.and_depth, _wires_depths[wire->label].and_depth);
+        }
+
+        printf("> Depth: %lu\n", circuit_depth.depth);
+        printf("> AND depth: %lu\n", circuit_depth.and_depth);
+    }
+
+    // Profiling reports
+    if (_profiling) {
+        const std::filesystem::path folded_path = _circuits_directory / (_circuit_name + "_profile.folded");
+        const std::filesystem::path json_path = _circuits_directory / (_circuit_name + "_profile.json");
+
+        const std::string folded = profile_folded();
+        const std::string json = profile_json();
+
+        std::ofstream(folded_path, std::ios::out | std::ios::trunc).write(folded.c_str(), folded.size());
+        std::ofstream(json_path, std::ios::out | std::ios::trunc).write(json.c_str(), json.size());
+
+        printf("> Profile: %s\n", json_path.c_str());
+    }
 }
 
 void gabe::bcgen::CircuitGenerator::assign_value(Wire& wire, uint8_t value) {
@@ -354,27 +962,25 @@ void gabe::bcgen::CircuitGenerator::flip(const Variable& variable, Variable& out
 }
 
 void gabe::bcgen::CircuitGenerator::twos_complement(Variable& variable) {
-    // Variable creations
-    Variable one(variable.size());
+    ProfileScope scope(*this, "twos_complement");
 
-    // Variable value initializations
-    assign_value(one, 1);
-
-    // Algorithm
-    INV(variable, variable);
-    sum(one, variable, variable);
+    // The 2's complement is the negation of the variable, which does not need the adder of the constant one
+    negate(variable, variable);
 }
 
 void gabe::bcgen::CircuitGenerator::twos_complement(const Variable& variable, Variable& output) {
-    // Makes a copy of the input variable
-    output = variable;
+    ProfileScope scope(*this, "twos_complement");
+
+    // Safety checks
+    _assert_equal_size(variable, output.size());
 
-    // Performs the complement to the output variable
-    twos_complement(output);
+    negate(variable, output);
 }
 
 void gabe::bcgen::CircuitGenerator::XOR(const Wire in_a, const Wire in_b, Wire& out) {
-    _write_2_1_gate( in_a.label, in_b.label, out.label = _counter_wires++, _gates_map["xor"] );
+    _add_2_1_gate( in_a.label, in_b.label, out.label = _new_label(), _gates_map["xor"] );
+    _track_gate( in_a.label, in_b.label, out.label, _gates_map["xor"] );
+    if (_shadow) _shadow_gate( out.label, _shadow_lanes(in_a.label) ^ _shadow_lanes(in_b.label) );
 }
 
 void gabe::bcgen::CircuitGenerator::XOR(const Variable& in_a, const Variable& in_b, Variable& out) {
@@ -389,7 +995,9 @@ void gabe::bcgen::CircuitGenerator::XOR(const Variable& in_a, const Variable& in
 }
 
 void gabe::bcgen::CircuitGenerator::AND(const Wire in_a, const Wire in_b, Wire& out) {
-    _write_2_1_gate( in_a.label, in_b.label, out.label = _counter_wires++, _gates_map["and"] );
+    _add_2_1_gate( in_a.label, in_b.label, out.label = _new_label(), _gates_map["and"] );
+    _track_gate( in_a.label, in_b.label, out.label, _gates_map["and"] );
+    if (_shadow) _shadow_gate( out.label, _shadow_lanes(in_a.label) & _shadow_lanes(in_b.label) );
 }
 
 void gabe::bcgen::CircuitGenerator::AND(const Variable& in_a, const Variable& in_b, Variable& out) {
@@ -405,7 +1013,9 @@ void gabe::bcgen::CircuitGenerator::AND(const Variable& in_a, const Variable& in
 
 void gabe::bcgen::CircuitGenerator::OR(const Wire in_a, const Wire in_b, Wire& out) {
 #if BCGEN_OR_GATES == 1
-    _write_2_1_gate( in_a.label, in_b.label, out.label = _counter_wires++, _gates_map["or"] );
+    _add_2_1_gate( in_a.label, in_b.label, out.label = _new_label(), _gates_map["or"] );
+    _track_gate( in_a.label, in_b.label, out.label, _gates_map["or"] );
+    if (_shadow) _shadow_gate( out.label, _shadow_lanes(in_a.label) | _shadow_lanes(in_b.label) );
 #else
     // Temp wires
     Wire wire1, wire2;
@@ -430,7 +1040,9 @@ void gabe::bcgen::CircuitGenerator::OR(const Variable& in_a, const Variable& in_
 }
 
 void gabe::bcgen::CircuitGenerator::INV(const Wire in_a, Wire& out) {
-    _write_1_1_gate( in_a.label, out.label = _counter_wires++, _gates_map["inv"] );
+    _add_1_1_gate( in_a.label, out.label = _new_label(), _gates_map["inv"] );
+    _track_gate( in_a.label, in_a.label, out.label, _gates_map["inv"] );
+    if (_shadow) _shadow_gate( out.label, ~_shadow_lanes(in_a.label) );
 }
 
 void gabe::bcgen::CircuitGenerator::INV(const Variable& in_a, Variable& out) {
@@ -474,309 +1086,726 @@ void gabe::bcgen::CircuitGenerator::NOR(const Variable& in_a, const Variable& in
 }
 
 void gabe::bcgen::CircuitGenerator::sum(const Variable& in_a, const Variable& in_b, Variable& out) {
-#if BCGEN_OPTIMIZE
-    // const Variable& biggest_in = in_a.size() < in_b.size() ? in_b : in_a;
-    // const Variable& smallest_in = in_a.size() < in_b.size() ? in_a : in_b;
+    ProfileScope scope(*this, "sum");
 
-    // int n_operations = out_sum.size() < ;
+    // The variables are unsigned, thus the narrowest one is zero extended
+    _sum(in_a, in_b, false, out);
+}
 
-    // assign_value(out_sum, 0);
+void gabe::bcgen::CircuitGenerator::sum_s(const Variable& in_a, const Variable& in_b, Variable& out) {
+    ProfileScope scope(*this, "sum_s");
 
-    // -------
-    
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-
-    // Examples
-    // 
-    // carry       11110    [5 bits]
-    // in_a     01100011    [8 bits]
-    // in_b         1111    [4 bits]
-    // sum         10010    [5 bits]
-    //
-    // carry       11110    [5 bits]
-    // in_a     01100011    [8 bits]
-    // in_b        11111    [5 bits]
-    // sum         00010    [5 bits]
-    //
-    // carry       11110    [5 bits]
-    // in_a     01100011    [8 bits]
-    // in_b       111111    [6 bits]
-    // sum         00010    [5 bits]
-    //
-    // carry        1110    [4 bits]
-    // in_a     01100011    [8 bits]
-    // in_b          111    [3 bits]
-    // sum         01010    [5 bits]
-    //
-    // The point here is to demonstrate the behavior changes when the output is 5 bits and the in_b varaibles have different sizes.
-#else
-    // Safety checks
-    _assert_equal_size(in_a, out.size());
-    _assert_equal_size(in_b, out.size());
+    _sum(in_a, in_b, true, out);
+}
 
-    int n_operations = out.size();
-#endif
+void gabe::bcgen::CircuitGenerator::_sum(const Variable& in_a, const Variable& in_b, bool is_signed, Variable& out) {
+    // Util variables
+    // > Only the bits of the output are computed, the input variables being extended or truncated to its size
+    const uint64_t n_operations = out.size();
 
-    // Variables creation
+    // Wires creation
+    // > Every temporary wire is only needed in its own bit operation
     Wire c = _zero_wire; // This is the carry bit
-    Variable a_xor_b (out.size()); // Consider as "d"
-    Variable a_and_b (out.size());
-    Variable c_and_d (out.size());
+    Wire a_xor_b; // Consider as "d"
+    Wire a_and_b;
+    Wire c_and_d;
 
     // Circuit construction
-    for (int i = 0; i < n_operations; i++) {
-        // Sum wire
-        XOR(in_a[i], in_b[i], a_xor_b[i]);
-        XOR(a_xor_b[i], c, out[i]); // TODO: This must be placed somewhere else if output wires are aimed to be placed in the end
+    // > The input wires of a bit are copied before its output wire is written, thus the output can be one of the inputs
+    // > The gates with a zero wire (the carry in of the least significant bit, or the bits of a zero extended variable) are
+    //   not needed, which turns the full adders into half adders
+    for (uint64_t i = 0; i < n_operations; i++) {
+        const bool carry_out = i != n_operations - 1;
+        const Wire a = _extended(in_a, i, is_signed);
+        const Wire b = _extended(in_b, i, is_signed);
+
+        _fold_XOR(a, b, a_xor_b);
 
         // Carry out wire
         // > This operation is not done in the last bit to avoid dead wires in the circuit, or more gates to avoid it to be dead.
-        if (i != n_operations - 1) {
-            AND(in_a[i], in_b[i], a_and_b[i]);
-            AND(c, a_xor_b[i], c_and_d[i]);
-            OR(a_and_b[i], c_and_d[i], c);
+        if (carry_out) {
+            _fold_AND(a, b, a_and_b);
+            _fold_AND(c, a_xor_b, c_and_d);
+        }
+
+        // Sum wire
+        _fold_XOR(a_xor_b, c, out[i]);
+
+        if (carry_out) {
+            _fold_OR(a_and_b, c_and_d, c);
         }
     }
 }
 
 void gabe::bcgen::CircuitGenerator::subtract(const Variable& in_a, const Variable& in_b, Variable& out) {
-#if BCGEN_OPTIMIZE
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-#else
-    // Safety checks
-    _assert_equal_size(in_a, out.size());
-    _assert_equal_size(in_b, out.size());
+    ProfileScope scope(*this, "subtract");
 
-    int n_operations = out.size();
-#endif
+    // The variables are unsigned, thus the narrowest one is zero extended
+    _subtract(in_a, in_b, false, out);
+}
 
-    // Variables creation
-    Wire b = _zero_wire; // This is the borrow bit. Consider as "B"
-    Variable a_xor_b (out.size());
-    Variable b_xor_B (out.size()); // Consider as "c"
-    Variable inv_a   (out.size()); // Consider as "d"
-    Variable c_and_d (out.size());
-    Variable b_and_B (out.size());
+void gabe::bcgen::CircuitGenerator::subtract_s(const Variable& in_a, const Variable& in_b, Variable& out) {
+    ProfileScope scope(*this, "subtract_s");
 
-    // Circuit construction
-    for (int i = 0; i < n_operations; i++) {
-        // Sub wire
-        XOR(in_a[i], in_b[i], a_xor_b[i]);
-        XOR(a_xor_b[i], b, out[i]); // TODO: This must be placed somewhere else if output wires are aimed to be placed in the end
+    _subtract(in_a, in_b, true, out);
+}
 
-        // Borrow out wire
-        // > This operation is not done in the last bit to avoid dead wires in the circuit, or more gates to avoid it to be dead.
-        if (i != n_operations - 1) {
-            XOR(in_b[i], b, b_xor_B[i]);
-            INV(in_a[i], inv_a[i]);
-            AND(b_xor_B[i], inv_a[i], c_and_d[i]);
-            AND(in_b[i], b, b_and_B[i]);
-            OR(c_and_d[i], b_and_B[i], b);
+void gabe::bcgen::CircuitGenerator::_subtract(const Variable& in_a, const Variable& in_b, bool is_signed, Variable& out) {
+    // Util variables
+    // > Only the bits of the output are computed, the input variables being extended or truncated to its size
+    const uint64_t n_operations = out.size();
+
+    // Wires creation
+    // > Every temporary wire is only needed in its own bit operation
+    Wire borrow = _zero_wire; // Consider as "B"
+    Wire a_xor_borrow;
+    Wire b_xor_borrow;
+
+    // Circuit construction
+    // > The input wires of a bit are copied before its output wire is written, thus the output can be one of the inputs
+    // > The borrow out is the majority of NOT A, B and the borrow in, which is B XOR ((A XOR B_in) AND (B XOR B_in)), thus
+    //   it only needs a single AND gate
+    // > The gates with a zero wire (the borrow in of the least significant bit, or the bits of a zero extended variable) are
+    //   not needed
+    for (uint64_t i = 0; i < n_operations; i++) {
+        const bool borrow_out = i != n_operations - 1;
+        const Wire a = _extended(in_a, i, is_signed);
+        const Wire b = _extended(in_b, i, is_signed);
+
+        _fold_XOR(a, borrow, a_xor_borrow);
+
+        // Sub wire
+        // > Borrow out wire operations are not done in the last bit to avoid dead wires in the circuit
+        if (borrow_out) {
+            _fold_XOR(b, borrow, b_xor_borrow);
+        }
+        _fold_XOR(a_xor_borrow, b, out[i]);
+
+        if (borrow_out) {
+            _fold_AND(a_xor_borrow, b_xor_borrow, a_xor_borrow);
+            _fold_XOR(b, a_xor_borrow, borrow);
+        }
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::increment(Variable& variable) {
+    increment(variable, variable);
+}
+
+void gabe::bcgen::CircuitGenerator::increment(const Variable& variable, Variable& output) {
+    ProfileScope scope(*this, "increment");
+
+    // Wires creation
+    Wire carry; // Consider as "C", which is the AND of all the lower bits
+
+    // Circuit construction
+    // > The input wire of a bit is copied before its output wire is written, thus the output can be the input
+    // > The carry in of the least significant bit is one, thus it is inverted and its carry out is itself
+    // > Carry out wire operations are not done in the last bit to avoid dead wires in the circuit
+    for (uint64_t i = 0; i < output.size(); i++) {
+        const Wire a = _extended(variable, i, false);
+
+        if (i == 0) {
+            INV(a, output[i]);
+            carry = a;
+            continue;
+        }
+
+        _fold_XOR(a, carry, output[i]);
+        if (i != output.size() - 1) {
+            _fold_AND(a, carry, carry);
+        }
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::decrement(Variable& variable) {
+    decrement(variable, variable);
+}
+
+void gabe::bcgen::CircuitGenerator::decrement(const Variable& variable, Variable& output) {
+    ProfileScope scope(*this, "decrement");
+
+    // Wires creation
+    Wire any = _zero_wire; // Consider as "O", which is the OR of all the lower bits (the borrow in is its negation)
+    Wire a_xor_any;
+
+    // Circuit construction
+    // > The input wire of a bit is copied before its output wire is written, thus the output can be the input
+    // > OR wire operations are not done in the last bit to avoid dead wires in the circuit
+    for (uint64_t i = 0; i < output.size(); i++) {
+        const Wire a = _extended(variable, i, false);
+
+        _fold_XOR(a, any, a_xor_any);
+        INV(a_xor_any, output[i]);
+        if (i != output.size() - 1) {
+            _fold_OR(a, any, any);
+        }
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::negate(Variable& variable) {
+    negate(variable, variable);
+}
+
+void gabe::bcgen::CircuitGenerator::negate(const Variable& variable, Variable& output) {
+    ProfileScope scope(*this, "negate");
+
+    // Wires creation
+    Wire any = _zero_wire; // Consider as "O", which is the OR of all the lower bits
+
+    // Circuit construction
+    // > The input wire of a bit is copied before its output wire is written, thus the output can be the input
+    // > OR wire operations are not done in the last bit to avoid dead wires in the circuit
+    for (uint64_t i = 0; i < output.size(); i++) {
+        const Wire a = _extended(variable, i, true);
+
+        _fold_XOR(a, any, output[i]);
+        if (i != output.size() - 1) {
+            _fold_OR(a, any, any);
+        }
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::negate(const Variable& in_a, const Wire& in_c, Variable& out) {
+    ProfileScope scope(*this, "negate");
+
+    // Wires creation
+    // > The control wire is copied, thus it can be one of the output wires
+    const Wire c = in_c;
+    Wire any = _zero_wire; // Consider as "O", which is the OR of all the lower bits
+    Wire c_and_any;
+
+    // Circuit construction
+    // > The input wire of a bit is copied before its output wire is written, thus the output can be the input
+    // > OR wire operations are not done in the last bit to avoid dead wires in the circuit
+    for (uint64_t i = 0; i < out.size(); i++) {
+        const Wire a = _extended(in_a, i, true);
+
+        _fold_AND(c, any, c_and_any);
+        _fold_XOR(a, c_and_any, out[i]);
+        if (i != out.size() - 1) {
+            _fold_OR(a, any, any);
         }
     }
 }
 
 void gabe::bcgen::CircuitGenerator::multiply_u(const Variable &in_a, const Variable &in_b, Variable &out) {
-#if BCGEN_OPTIMIZE
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-#else
-    // Safety checks
-    _assert_equal_size(in_a, in_b.size());
-    _assert_equal_size(out, in_a.size() + in_b.size());
+    ProfileScope scope(*this, "multiply_u");
+
+    // Util variables
+    // > Only the bits of the output are computed, thus a narrow output truncates the product
+    const uint64_t n_bits = out.size();
 
     // Variables creation
-    for (int i = 0; i < in_a.size(); i++) {
-        AND(in_a[i], in_b[0], out[i]);
+    // > The bits of the output that are not computed yet are zero
+    for (auto & wire : out) {
+        wire = _zero_wire;
     }
 
     // Circuit construction
-    for (int op = 1; op < in_b.size(); op++) {
-        Variable sum_with(out.size());
-
-        for (int i = 0; i < in_a.size(); i++) {
-            AND(in_a[i], in_b[op], sum_with[i + op]);
+    // > Each partial product only has the bits that fit in the output, and is only summed to the output bits it can change,
+    //   from its position to its carry bit
+    // > The first partial product is summed to zero wires, which needs no gates
+    for (uint64_t op = 0; op < in_b.size() && op < n_bits; op++) {
+        Variable partial(std::min<uint64_t>(in_a.size(), n_bits - op));
+        for (uint64_t i = 0; i < partial.size(); i++) {
+            AND(in_a[i], in_b[op], partial[i]);
         }
 
-        sum(out, sum_with, out);
+        VariableView window = out.slice(op, std::min<uint64_t>(partial.size() + 1, n_bits - op));
+        sum(window, partial, window);
     }
-#endif
 }
 
 void gabe::bcgen::CircuitGenerator::multiply_s(const Variable &in_a, const Variable &in_b, Variable &out) {
-#if BCGEN_OPTIMIZE
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-#else
-    // Safety checks
-    _assert_equal_size(in_a, in_b.size());
-    _assert_equal_size(out, in_a.size() + in_b.size());
+    ProfileScope scope(*this, "multiply_s");
+
+    // Util variables
+    // > The product of two signed variables fits in the sum of their sizes, thus a wider output is only sign extended
+    const uint64_t n_bits = std::min<uint64_t>(out.size(), in_a.size() + in_b.size());
+    const uint64_t msb_a = in_a.size() - 1;
+    const uint64_t msb_b = in_b.size() - 1;
 
     // Variables creation
-    for (int i = 0; i < in_a.size(); i++) {
-        AND(in_a[i], in_b[0], out[i]);
+    // > The bits of the output that are not computed yet are zero
+    for (auto & wire : out) {
+        wire = _zero_wire;
     }
-    INV(out[in_a.size()-1], out[in_a.size()-1]);
 
     // Circuit construction
-    for (int op = 1; op < in_b.size(); op++) {
-        Variable sum_with(out.size());
-
-        if (op != in_b.size() - 1) {
-            for (int i = 0; i < in_a.size(); i++) {
-                AND(in_a[i], in_b[op], sum_with[i + op]);
+    // > The partial products of exactly one sign bit are negative, thus they are inverted (see the correction constant)
+    // > Each partial product only has the bits that fit in the output, and is only summed to the output bits it can change,
+    //   from its position to its carry bit
+    for (uint64_t op = 0; op < in_b.size() && op < n_bits; op++) {
+        Variable partial(std::min<uint64_t>(in_a.size(), n_bits - op));
+        for (uint64_t i = 0; i < partial.size(); i++) {
+            AND(in_a[i], in_b[op], partial[i]);
+            if ((i == msb_a) != (op == msb_b)) {
+                INV(partial[i], partial[i]);
             }
-            INV(sum_with[in_a.size()-1 + op], sum_with[in_a.size()-1 + op]);
-        } else {
-            for (int i = 0; i < in_a.size(); i++) {
-                AND(in_a[i], in_b[op], sum_with[i + op]);
-                if (i != in_a.size() - 1) {
-                    INV(sum_with[in_a.size()-1 + op], sum_with[in_a.size()-1 + op]);
+        }
+
+        VariableView window = out.slice(op, std::min<uint64_t>(partial.size() + 1, n_bits - op));
+        sum(window, partial, window);
+    }
+
+    // Correction constant of the inverted partial products: 2^(n-1) + 2^(m-1) + 2^(n+m-1)
+    // > n and m are the sizes of the input variables (2^n + 2^(2n-1) for variables with the same size)
+    // > The constant has at most three bits set, thus it is added with an increment from each of them, which only has half
+    //   adders
+    std::vector<uint8_t> constant(in_a.size() + in_b.size() + 1, 0);
+    for (uint64_t position : { msb_a, msb_b, msb_a + msb_b + 1 }) {
+        for (; constant[position]; position++) {
+            constant[position] = 0;
+        }
+        constant[position] = 1;
+    }
+
+    for (uint64_t position = 0; position < n_bits; position++) {
+        if (constant[position]) {
+            VariableView high = out.slice(position, n_bits - position);
+            increment(high);
+        }
+    }
+
+    // Sign extension of the product
+    for (uint64_t i = n_bits; i < out.size(); i++) {
+        out[i] = out[n_bits - 1];
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::_add_power(std::vector<uint8_t>& constant, uint64_t position, bool negative) {
+    // Subtracting 2^k is the same as adding 2^n - 2^k (modulo 2^n), whose bits from the k-th one are all set
+    uint8_t carry = 0;
+    for (uint64_t i = position; i < constant.size(); i++) {
+        const uint8_t bit = i == position || negative;
+        if (!bit && !carry) break;
+
+        const uint8_t result = constant[i] + bit + carry;
+        constant[i] = result & 0x01;
+        carry = result >> 1;
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::_compress(std::vector<std::vector<Wire>>& columns, const std::vector<uint8_t>& constant, Variable& out) {
+    // Util variables
+    const uint64_t n_bits = out.size();
+    columns.resize(n_bits);
+
+    // The constant is placed in the heap as one wires
+    for (uint64_t i = 0; i < n_bits && i < constant.size(); i++) {
+        if (constant[i]) {
+            columns[i].push_back(_one_wire);
+        }
+    }
+
+    // Wires creation
+    Wire a_xor_c;
+    Wire b_xor_c;
+    Wire carry;
+
+    // Compression stages
+    // > Each 3 wires of a column are replaced by a full adder, whose sum stays in the column and whose carry goes to the next
+    //   column of the next stage
+    // > The carry is the majority of the 3 wires, which is C XOR ((A XOR C) AND (B XOR C)), thus it only needs a single AND gate
+    // > The carries of the last column are not computed, to avoid dead wires in the circuit
+    auto max_height = [&]() {
+        uint64_t height = 0;
+        for (auto & column : columns) {
+            height = std::max<uint64_t>(height, column.size());
+        }
+        return height;
+    };
+
+    while (max_height() > 2) {
+        std::vector<std::vector<Wire>> next(n_bits);
+
+        for (uint64_t i = 0; i < n_bits; i++) {
+            const std::vector<Wire>& column = columns[i];
+
+            uint64_t j = 0;
+            for (; j + 3 <= column.size(); j += 3) {
+                const Wire a = column[j];
+                const Wire b = column[j + 1];
+                const Wire c = column[j + 2];
+
+                XOR(a, c, a_xor_c);
+                Wire sum;
+                XOR(a_xor_c, b, sum);
+                next[i].push_back(sum);
+
+                if (i + 1 < n_bits) {
+                    XOR(b, c, b_xor_c);
+                    AND(a_xor_c, b_xor_c, carry);
+                    XOR(carry, c, carry);
+                    next[i + 1].push_back(carry);
                 }
             }
+
+            // The remaining wires go directly to the next stage
+            for (; j < column.size(); j++) {
+                next[i].push_back(column[j]);
+            }
         }
 
-        sum(out, sum_with, out);
+        columns = std::move(next);
     }
 
-    Variable last_sum(out.size());
-    assign_value(last_sum, 9);
-    shift_left(last_sum, in_b.size(), last_sum);
+    // Final adder of the two remaining rows
+    // > Missing wires of the rows are zero wires, which are folded by the adder
+    Variable row_a(n_bits);
+    Variable row_b(n_bits);
+    for (uint64_t i = 0; i < n_bits; i++) {
+        row_a[i] = columns[i].size() > 0 ? columns[i][0] : _zero_wire;
+        row_b[i] = columns[i].size() > 1 ? columns[i][1] : _zero_wire;
+    }
 
-    sum(out, last_sum, out);
-#endif
+    _sum(row_a, row_b, false, out);
 }
 
-void gabe::bcgen::CircuitGenerator::divide_u(const Variable& in_a, const Variable& in_b, Variable& out_q, Variable& out_r) {
-#if BCGEN_OPTIMIZE
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-#else
+void gabe::bcgen::CircuitGenerator::sum_many(const std::vector<Variable>& in, Variable& out) {
+    ProfileScope scope(*this, "sum_many");
+
+    _sum_many(in, false, out);
+}
+
+void gabe::bcgen::CircuitGenerator::sum_many_s(const std::vector<Variable>& in, Variable& out) {
+    ProfileScope scope(*this, "sum_many_s");
+
+    _sum_many(in, true, out);
+}
+
+void gabe::bcgen::CircuitGenerator::_sum_many(const std::vector<Variable>& in, bool is_signed, Variable& out) {
+    // Util variables
+    const uint64_t n_bits = out.size();
+
+    // Bits heap creation
+    // > The zero wires do not change the sum, thus they are not placed in the heap
+    // > The sign wires of signed variables narrower than the output are negated, and their weight subtracted from the
+    //   constant
+    std::vector<std::vector<Wire>> columns(n_bits);
+    std::vector<uint8_t> constant(n_bits, 0);
+    for (auto & variable : in) {
+        for (uint64_t i = 0; i < variable.size() && i < n_bits; i++) {
+            Wire wire = variable[i];
+
+            if (is_signed && i == variable.size() - 1 && variable.size() < n_bits) {
+                INV(wire, wire);
+                _add_power(constant, i, true);
+            }
+
+            if (wire.label != _zero_wire.label) {
+                columns[i].push_back(wire);
+            }
+        }
+    }
+
+    _compress(columns, constant, out);
+}
+
+void gabe::bcgen::CircuitGenerator::inner_product_u(const std::vector<Variable>& in_a, const std::vector<Variable>& in_b, Variable& out) {
+    ProfileScope scope(*this, "inner_product_u");
+
+    _inner_product(in_a, in_b, false, out);
+}
+
+void gabe::bcgen::CircuitGenerator::inner_product_s(const std::vector<Variable>& in_a, const std::vector<Variable>& in_b, Variable& out) {
+    ProfileScope scope(*this, "inner_product_s");
+
+    _inner_product(in_a, in_b, true, out);
+}
+
+void gabe::bcgen::CircuitGenerator::_inner_product(const std::vector<Variable>& in_a, const std::vector<Variable>& in_b, bool is_signed, Variable& out) {
     // Safety checks
-    _assert_equal_size(in_a, out_q.size());
-    _assert_equal_size(in_b, out_q.size());
-    _assert_equal_size(out_r, out_q.size());
+    if (in_a.size() != in_b.size()) {
+        const std::string error_msg = fmt::format("Inner product between vectors with {} and {} variables.", in_a.size(), in_b.size());
+        throw std::runtime_error(error_msg);
+    }
 
-    // Variable value initializations
-    assign_value(out_r, 0);
+    // Util variables
+    const uint64_t n_bits = out.size();
+
+    // Bits heap creation
+    // > Each partial product bit is placed in the column of its weight, if it fits in the output
+    // > The partial product bits of signed variables with exactly one sign wire are negative, thus they are inverted, and the
+    //   correction constant of each product is added to the constant (see multiply_s)
+    std::vector<std::vector<Wire>> columns(n_bits);
+    std::vector<uint8_t> constant(n_bits, 0);
+    for (uint64_t k = 0; k < in_a.size(); k++) {
+        const Variable& a = in_a[k];
+        const Variable& b = in_b[k];
+        const uint64_t msb_a = a.size() - 1;
+        const uint64_t msb_b = b.size() - 1;
+
+        for (uint64_t j = 0; j < b.size() && j < n_bits; j++) {
+            for (uint64_t i = 0; i < a.size() && i + j < n_bits; i++) {
+                Wire bit;
+                _fold_AND(a[i], b[j], bit);
+
+                if (is_signed && (i == msb_a) != (j == msb_b)) {
+                    INV(bit, bit);
+                }
 
-    // Control wires
-    Wire control;
+                if (bit.label != _zero_wire.label) {
+                    columns[i + j].push_back(bit);
+                }
+            }
+        }
 
-    // Relevant variables for circuit contruction
-    // > Zero is a variable that will be used to subtract
-    Variable zero(in_a.size());
-    assign_value(zero, 0);
+        if (is_signed) {
+            _add_power(constant, msb_a, false);
+            _add_power(constant, msb_b, false);
+            _add_power(constant, msb_a + msb_b + 1, true);
+        }
+    }
 
-    // Circuit construction
-    for (int i = in_a.size()-1; i >= 0; i--) {
-        // Updates the remainder value
-        // > Shifts left by 1
-        // > Adds the most significant (not assigned) bit from the dividend to the remainder's least significant bit
-        shift_left(out_r, 1);
-        out_r[0] = in_a[i];
+    _compress(columns, constant, out);
+}
 
-        // Checks if the current remainder value can subtract the divisor value
-        // > This can only be done if remainder value >= divisor value.
-        // > The control variable from this check will also be the quotient bit value
-        greater_or_equal_u(out_r, in_b, control);
+void gabe::bcgen::CircuitGenerator::popcount(const Variable& in_a, Variable& out) {
+    ProfileScope scope(*this, "popcount");
+
+    // Bits heap creation
+    // > Every wire has the weight 1, and the zero wires do not change the count
+    std::vector<std::vector<Wire>> columns(out.size());
+    if (out.size()) {
+        for (auto & wire : in_a) {
+            if (wire.label != _zero_wire.label) {
+                columns[0].push_back(wire);
+            }
+        }
+    }
+
+    _compress(columns, {}, out);
+}
 
-        // Defines if the value to subtract from the remainder if zero of the divisor
-        Variable subtractor(in_a.size());
-        multiplexer(zero, in_b, control, subtractor);
+void gabe::bcgen::CircuitGenerator::hamming_distance(const Variable& in_a, const Variable& in_b, Variable& out) {
+    ProfileScope scope(*this, "hamming_distance");
 
-        // Performs the subtraction
-        subtract(out_r, subtractor, out_r); 
+    // Util variables
+    const uint64_t n_bits = std::max(in_a.size(), in_b.size());
 
-        // Updates the quotient value
-        out_q[i] = control;
+    // Different wires
+    // > The wires after the size of the narrowest variable are compared with zero wires, thus they are not XOR gates
+    Variable difference(n_bits);
+    for (uint64_t i = 0; i < n_bits; i++) {
+        _fold_XOR(_extended(in_a, i, false), _extended(in_b, i, false), difference[i]);
     }
-#endif
+
+    popcount(difference, out);
 }
 
-void gabe::bcgen::CircuitGenerator::divide_u_quotient(const Variable& in_a, const Variable& in_b, Variable& out_q) {
-#if BCGEN_OPTIMIZE
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-#else
+void gabe::bcgen::CircuitGenerator::_prefix_OR(const Variable& in_a, bool from_msb, Variable& out) {
+    // Util variables
+    // > The prefixes from the most significant wire are the prefixes of the reversed variable
+    const uint64_t n_bits = in_a.size();
+    auto index = [&](uint64_t i) { return from_msb ? n_bits - 1 - i : i; };
+
+    out = in_a;
+
+    // First pass
+    // > The prefix of each position 2^k - 1 is the OR of two adjacent groups of 2^(k-1) wires
+    uint64_t top = 1;
+    for (uint64_t step = 1; step < n_bits; step *= 2) {
+        for (uint64_t i = 2 * step - 1; i < n_bits; i += 2 * step) {
+            _fold_OR(out[index(i - step)], out[index(i)], out[index(i)]);
+        }
+        top = step;
+    }
+
+    // Second pass
+    // > The remaining positions are filled with the prefix of the previous group
+    for (uint64_t step = top / 2; step >= 1; step /= 2) {
+        for (uint64_t i = 3 * step - 1; i < n_bits; i += 2 * step) {
+            _fold_OR(out[index(i - step)], out[index(i)], out[index(i)]);
+        }
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::_encode(const Variable& one_hot, Variable& out) {
+    // Each bit of the encoding is the XOR of the wires whose index has the bit set
+    // > Indexes after the size of the output do not change the encoding (it is truncated)
+    // > The wires are XORed in pairs, which gives a balanced tree instead of a chain
+    for (uint64_t k = 0; k < out.size(); k++) {
+        std::vector<Wire> wires;
+        for (uint64_t i = 0; k < 64 && i < one_hot.size(); i++) {
+            if ((i >> k) & 0x01) {
+                wires.push_back(one_hot[i]);
+            }
+        }
+
+        for (uint64_t step = 1; step < wires.size(); step *= 2) {
+            for (uint64_t i = 0; i + step < wires.size(); i += 2 * step) {
+                _fold_XOR(wires[i], wires[i + step], wires[i]);
+            }
+        }
+        out[k] = wires.empty() ? _zero_wire : wires[0];
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::priority_encoder(const Variable& in_a, Variable& out) {
+    ProfileScope scope(*this, "priority_encoder");
+
     // Safety checks
-    _assert_equal_size(in_a, out_q.size());
-    _assert_equal_size(in_b, out_q.size());
+    _assert_equal_size(out, in_a.size());
+
+    // Prefix ORs from the most significant wire
+    Variable prefix(in_a.size());
+    _prefix_OR(in_a, true, prefix);
+
+    // The output is one where the prefix changes
+    for (uint64_t i = 0; i < in_a.size(); i++) {
+        _fold_XOR(prefix[i], _extended(prefix, i + 1, false), out[i]);
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::clz(const Variable& in_a, Variable& out) {
+    ProfileScope scope(*this, "clz");
+
+    // Util variables
+    const uint64_t n_bits = in_a.size();
+
+    // Prefix ORs from the most significant wire
+    Variable prefix(n_bits);
+    _prefix_OR(in_a, true, prefix);
+
+    // One-hot wire of each count
+    // > The count of a position is the number of wires after it, and the count of a zero variable is its size
+    Variable one_hot(n_bits + 1);
+    for (uint64_t i = 0; i < n_bits; i++) {
+        _fold_XOR(prefix[i], _extended(prefix, i + 1, false), one_hot[n_bits - 1 - i]);
+    }
+    if (n_bits) {
+        INV(prefix[0], one_hot[n_bits]);
+    } else {
+        one_hot[n_bits] = _one_wire;
+    }
+
+    _encode(one_hot, out);
+}
 
-    // Control wires
-    Wire control;
+void gabe::bcgen::CircuitGenerator::ctz(const Variable& in_a, Variable& out) {
+    ProfileScope scope(*this, "ctz");
 
-    // Relevant variables for circuit contruction
-    // > Zero is a variable that will be used to subtract
-    Variable zero(in_a.size());
-    assign_value(zero, 0);
-    // > Remainder is the other resulting value, that this function ignores
-    Variable remainder(in_a.size());
-    assign_value(remainder, 0);
+    // Util variables
+    const uint64_t n_bits = in_a.size();
+
+    // Prefix ORs from the least significant wire
+    Variable prefix(n_bits);
+    _prefix_OR(in_a, false, prefix);
+
+    // One-hot wire of each count
+    // > The count of a position is the position, and the count of a zero variable is its size
+    Variable one_hot(n_bits + 1);
+    for (uint64_t i = 0; i < n_bits; i++) {
+        _fold_XOR(prefix[i], i ? prefix[i - 1] : _zero_wire, one_hot[i]);
+    }
+    if (n_bits) {
+        INV(prefix[n_bits - 1], one_hot[n_bits]);
+    } else {
+        one_hot[n_bits] = _one_wire;
+    }
+
+    _encode(one_hot, out);
+}
+
+void gabe::bcgen::CircuitGenerator::ilog2(const Variable& in_a, Variable& out) {
+    ProfileScope scope(*this, "ilog2");
+
+    // The one-hot wire of each position is the one-hot wire of the logarithm
+    Variable one_hot(in_a.size());
+    priority_encoder(in_a, one_hot);
+
+    _encode(one_hot, out);
+}
+
+void gabe::bcgen::CircuitGenerator::_divide_u(const Variable& in_a, const Variable& in_b, Variable& out_q, Variable* out_r) {
+    // Util variables
+    const uint64_t n_a = in_a.size();
+    const uint64_t n_b = in_b.size();
+
+    // Variables creation
+    // > The quotient has the size of the dividend, and the remainder is always smaller than the divisor
+    // > The outputs are only assigned in the end, thus they can be the input variables
+    Variable quotient(n_a);
+    Variable remainder(n_b);
+    uint64_t remainder_size = 0;
 
     // Circuit construction
-    for (int i = in_a.size()-1; i >= 0; i--) {
+    for (int64_t i = n_a - 1; i >= 0; i--) {
         // Updates the remainder value
         // > Shifts left by 1
         // > Adds the most significant (not assigned) bit from the dividend to the remainder's least significant bit
-        shift_left(remainder, 1);
-        remainder[0] = in_a[i];
+        // > The shifted remainder only has the bits of the dividend assigned so far, and at most one more bit than the divisor
+        Variable shifted(std::min<uint64_t>(n_a - i, n_b + 1));
+        shifted[0] = in_a[i];
+        for (uint64_t j = 1; j < shifted.size(); j++) {
+            shifted[j] = remainder[j - 1];
+        }
 
         // Checks if the current remainder value can subtract the divisor value
         // > This can only be done if remainder value >= divisor value.
         // > The control variable from this check will also be the quotient bit value
-        greater_or_equal_u(remainder, in_b, control);
+        greater_or_equal_u(shifted, in_b, quotient[i]);
 
-        // We do not want to perform the following operations in the last bit
+        // The remainder is not needed after the last bit if it is not an output
         // > Otherwise the remainder wires would be left "dead"
-        if (i != 0) {
-            // Defines if the value to subtract from the remainder if zero of the divisor
-            Variable subtractor(in_a.size());
-            multiplexer(zero, in_b, control, subtractor);
+        if (i == 0 && !out_r) {
+            break;
+        }
 
-            // Performs the subtraction
-            subtract(remainder, subtractor, remainder);
+        // Defines the value to subtract from the remainder (zero or the divisor)
+        // > A single AND gate per bit selects between the divisor and zero
+        // > The divisor bits after the remainder size are zero when the subtraction is done
+        Variable subtractor(std::min<uint64_t>(shifted.size(), n_b));
+        for (uint64_t j = 0; j < subtractor.size(); j++) {
+            AND(in_b[j], quotient[i], subtractor[j]);
         }
 
-        // Updates the quotient value
-        out_q[i] = control;
+        // Performs the subtraction
+        // > The result is smaller than the divisor, thus it fits in the divisor size
+        remainder_size = subtractor.size();
+        VariableView difference = remainder.slice(0, remainder_size);
+        subtract(shifted, subtractor, difference);
     }
-#endif
+
+    // Assigns the outputs
+    // > The output bits after the computed ones are zero
+    for (uint64_t i = 0; i < out_q.size(); i++) {
+        out_q[i] = i < n_a ? quotient[i] : _zero_wire;
+    }
+    if (out_r) {
+        for (uint64_t i = 0; i < out_r->size(); i++) {
+            (*out_r)[i] = i < remainder_size ? remainder[i] : _zero_wire;
+        }
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::divide_u(const Variable& in_a, const Variable& in_b, Variable& out_q, Variable& out_r) {
+    ProfileScope scope(*this, "divide_u");
+
+    _divide_u(in_a, in_b, out_q, &out_r);
+}
+
+void gabe::bcgen::CircuitGenerator::divide_u_quotient(const Variable& in_a, const Variable& in_b, Variable& out_q) {
+    ProfileScope scope(*this, "divide_u_quotient");
+
+    _divide_u(in_a, in_b, out_q, nullptr);
 }
 
 void gabe::bcgen::CircuitGenerator::divide_u_remainder(const Variable& in_a, const Variable& in_b, Variable& out_r) {
-#if BCGEN_OPTIMIZE
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-#else
+    ProfileScope scope(*this, "divide_u_remainder");
+
     // Creates the quotient variable
     // > This is temporary. This function ignores this result
-    Variable quotient(out_r.size());
+    Variable quotient(in_a.size());
 
     // Performs the division
-    divide_u(in_a, in_b, quotient, out_r);
-#endif
+    _divide_u(in_a, in_b, quotient, &out_r);
 }
 
 void gabe::bcgen::CircuitGenerator::divide_s(const Variable& in_a, const Variable& in_b, Variable& out_q, Variable& out_r) {
-#if BCGEN_OPTIMIZE
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-#else
-    // Safety checks
-    _assert_equal_size(in_a, out_q.size());
-    _assert_equal_size(in_b, out_q.size());
-    _assert_equal_size(out_r, out_q.size());
+    ProfileScope scope(*this, "divide_s");
 
     // Input variable signs
     // > This will define what will be the dividend and divisor variable of the division.
@@ -785,17 +1814,13 @@ void gabe::bcgen::CircuitGenerator::divide_s(const Variable& in_a, const Variabl
     Wire in_a_sign = in_a[in_a.size()-1];
     Wire in_b_sign = in_b[in_b.size()-1];
 
-    // Inputs two's complements
-    Variable in_a_complement(in_a.size());
-    Variable in_b_complement(in_b.size());
-    twos_complement(in_a, in_a_complement);
-    twos_complement(in_b, in_b_complement);
-
     // Define the dividend and divisor variables that will be used
+    // > The absolute values are conditional negations, instead of multiplexers between the variables and their two's
+    //   complements
     Variable dividend(in_a.size());
     Variable divisor(in_b.size());
-    multiplexer(in_a, in_a_complement, in_a_sign, dividend);
-    multiplexer(in_b, in_b_complement, in_b_sign, divisor);
+    negate(in_a, in_a_sign, dividend);
+    negate(in_b, in_b_sign, divisor);
 
     // Performs the unsigned division
     divide_u(dividend, divisor, out_q, out_r);
@@ -805,24 +1830,12 @@ void gabe::bcgen::CircuitGenerator::divide_s(const Variable& in_a, const Variabl
     Wire out_sign;
     XOR(in_a_sign, in_b_sign, out_sign);
 
-    // Quotient two's complement
-    Variable out_q_complement(out_q.size());
-    twos_complement(out_q, out_q_complement);
-    
     // Define the output quotient
-    multiplexer(out_q, out_q_complement, out_sign, out_q);
-#endif
+    negate(out_q, out_sign, out_q);
 }
 
 void gabe::bcgen::CircuitGenerator::divide_s_quotient(const Variable& in_a, const Variable& in_b, Variable& out_q) {
-#if BCGEN_OPTIMIZE
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-#else
-    // Safety checks
-    _assert_equal_size(in_a, out_q.size());
-    _assert_equal_size(in_b, out_q.size());
+    ProfileScope scope(*this, "divide_s_quotient");
 
     // Input variable signs
     // > This will define what will be the dividend and divisor variable of the division.
@@ -831,17 +1844,13 @@ void gabe::bcgen::CircuitGenerator::divide_s_quotient(const Variable& in_a, cons
     Wire in_a_sign = in_a[in_a.size()-1];
     Wire in_b_sign = in_b[in_b.size()-1];
 
-    // Inputs two's complements
-    Variable in_a_complement(in_a.size());
-    Variable in_b_complement(in_b.size());
-    twos_complement(in_a, in_a_complement);
-    twos_complement(in_b, in_b_complement);
-
     // Define the dividend and divisor variables that will be used
+    // > The absolute values are conditional negations, instead of multiplexers between the variables and their two's
+    //   complements
     Variable dividend(in_a.size());
     Variable divisor(in_b.size());
-    multiplexer(in_a, in_a_complement, in_a_sign, dividend);
-    multiplexer(in_b, in_b_complement, in_b_sign, divisor);
+    negate(in_a, in_a_sign, dividend);
+    negate(in_b, in_b_sign, divisor);
 
     // Performs the unsigned division
     divide_u_quotient(dividend, divisor, out_q);
@@ -851,24 +1860,12 @@ void gabe::bcgen::CircuitGenerator::divide_s_quotient(const Variable& in_a, cons
     Wire out_sign;
     XOR(in_a_sign, in_b_sign, out_sign);
 
-    // Quotient two's complement
-    Variable out_q_complement(out_q.size());
-    twos_complement(out_q, out_q_complement);
-    
     // Define the output quotient
-    multiplexer(out_q, out_q_complement, out_sign, out_q);
-#endif
+    negate(out_q, out_sign, out_q);
 }
 
 void gabe::bcgen::CircuitGenerator::divide_s_remainder(const Variable& in_a, const Variable& in_b, Variable& out_r) {
-#if BCGEN_OPTIMIZE
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-#else
-    // Safety checks
-    _assert_equal_size(in_a, out_r.size());
-    _assert_equal_size(in_b, out_r.size());
+    ProfileScope scope(*this, "divide_s_remainder");
 
     // Input variable signs
     // > This will define what will be the dividend and divisor variable of the division.
@@ -877,24 +1874,21 @@ void gabe::bcgen::CircuitGenerator::divide_s_remainder(const Variable& in_a, con
     Wire in_a_sign = in_a[in_a.size()-1];
     Wire in_b_sign = in_b[in_b.size()-1];
 
-    // Inputs two's complements
-    Variable in_a_complement(in_a.size());
-    Variable in_b_complement(in_b.size());
-    twos_complement(in_a, in_a_complement);
-    twos_complement(in_b, in_b_complement);
-
     // Define the dividend and divisor variables that will be used
+    // > The absolute values are conditional negations, instead of multiplexers between the variables and their two's
+    //   complements
     Variable dividend(in_a.size());
     Variable divisor(in_b.size());
-    multiplexer(in_a, in_a_complement, in_a_sign, dividend);
-    multiplexer(in_b, in_b_complement, in_b_sign, divisor);
+    negate(in_a, in_a_sign, dividend);
+    negate(in_b, in_b_sign, divisor);
 
     // Performs the unsigned division
     divide_u_remainder(dividend, divisor, out_r);
-#endif
 }
 
 void gabe::bcgen::CircuitGenerator::multiplexer(const Variable& in_a, const Variable& in_b, const Wire& in_c, Variable& out) {
+    ProfileScope scope(*this, "multiplexer");
+
     // Safety checks
     _assert_equal_size(in_a, in_b.size());
 
@@ -919,25 +1913,110 @@ void gabe::bcgen::CircuitGenerator::multiplexer(const Variable& in_a, const Vari
     }
 }
 
-void gabe::bcgen::CircuitGenerator::equal(const Variable& in_a, const Variable& in_b, Wire& out) {
-#if BCGEN_OPTIMIZE
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-#else
+void gabe::bcgen::CircuitGenerator::conditional_swap(Variable& in_a, Variable& in_b, const Wire& in_c) {
+    ProfileScope scope(*this, "conditional_swap");
+
     // Safety checks
     _assert_equal_size(in_a, in_b.size());
 
-    // XORs every wire between the variables
-    Variable inputs_xor(in_a.size());
-    XOR(in_a, in_b, inputs_xor);
+    // Wires creation
+    // > The control wire is copied, thus it can be one of the variables wires
+    const Wire c = in_c;
+    Wire difference;
+
+    // Circuit construction
+    // > The difference between the variables is only applied to both if they are swapped
+    for (uint64_t i = 0; i < in_a.size(); i++) {
+        XOR(in_a[i], in_b[i], difference);
+        AND(c, difference, difference);
+        XOR(in_a[i], difference, in_a[i]);
+        XOR(in_b[i], difference, in_b[i]);
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::_smaller(const Variable& in_a, const Variable& in_b, bool is_signed, Wire& out) {
+    // Util variables
+    // > The narrowest variable is extended to the size of the widest one
+    const uint64_t n_bits = std::max(in_a.size(), in_b.size());
+    const uint64_t msb = n_bits - 1; // msb = Most Significant Bit
+    auto bit_a = [&](uint64_t i) { return _extended(in_a, i, is_signed); };
+    auto bit_b = [&](uint64_t i) { return _extended(in_b, i, is_signed); };
+
+    // Base bit of each bit comparison
+    // > A signed comparison is an unsigned comparison with both sign bits flipped, which only swaps the base bit of the most
+    //   significant bit from B to A
+    auto base = [&](uint64_t i) { return is_signed && i == msb ? bit_a(i) : bit_b(i); };
+
+    if (!_log_depth_comparators) {
+        // Borrow chain of A - B
+        // > The borrow out of a bit is the majority of NOT A, B and the borrow in, which is B XOR ((A XOR Bin) AND (B XOR Bin))
+        // > The gates with a zero wire (the borrow in of the least significant bit, or the bits of a zero extended variable)
+        //   are not needed
+        Wire borrow = _zero_wire;
+        for (uint64_t i = 0; i <= msb; i++) {
+            Wire a_xor_borrow, b_xor_borrow;
+            _fold_XOR(bit_a(i), borrow, a_xor_borrow);
+            _fold_XOR(bit_b(i), borrow, b_xor_borrow);
+            _fold_AND(a_xor_borrow, b_xor_borrow, a_xor_borrow);
+            _fold_XOR(base(i), a_xor_borrow, borrow);
+        }
 
-    // Starts the output result with the first wire XOR
-    out = inputs_xor[0];
+        out = borrow;
+        return;
+    }
 
-    // ORs every single wire with the current output result
-    for (int i = 1; i < inputs_xor.size(); i++) {
-        OR(inputs_xor[i], out, out);
+    // Comparison tree
+    // > Every group of bits has a smaller wire and an equal wire, starting with one group per bit
+    // > Two adjacent groups are merged as S = S_high XOR (E_high AND S_low) and E = E_high AND E_low, where the XOR replaces an
+    //   OR because S_high and E_high can not be true at the same time
+    // > The least significant group is never the high group of a merge, thus its equal wire is not needed
+    const uint64_t n_groups = n_bits;
+    Variable groups_smaller(n_groups), groups_equal(n_groups);
+    for (uint64_t i = 0; i < n_groups; i++) {
+        _fold_AND(bit_a(i), bit_b(i), groups_smaller[i]);
+        _fold_XOR(base(i), groups_smaller[i], groups_smaller[i]);
+        if (i) {
+            _fold_XOR(bit_a(i), bit_b(i), groups_equal[i]);
+            INV(groups_equal[i], groups_equal[i]);
+        }
+    }
+
+    for (uint64_t step = 1; step < n_groups; step *= 2) {
+        for (uint64_t i = 0; i + step < n_groups; i += 2 * step) {
+            const uint64_t high = i + step;
+
+            Wire propagated;
+            AND(groups_equal[high], groups_smaller[i], propagated);
+            XOR(groups_smaller[high], propagated, groups_smaller[i]);
+            if (i) AND(groups_equal[high], groups_equal[i], groups_equal[i]);
+        }
+    }
+
+    out = groups_smaller[0];
+}
+
+void gabe::bcgen::CircuitGenerator::_equal(const Variable& in_a, const Variable& in_b, bool is_signed, Wire& out) {
+    // XORs every wire between the variables
+    // > The narrowest variable is extended to the size of the widest one
+    Variable inputs_xor(std::max(in_a.size(), in_b.size()));
+    for (uint64_t i = 0; i < inputs_xor.size(); i++) {
+        _fold_XOR(_extended(in_a, i, is_signed), _extended(in_b, i, is_signed), inputs_xor[i]);
+    }
+
+    // ORs every single wire XOR
+    // > The log depth comparators OR the wires in pairs, which gives a balanced tree instead of a chain
+    if (_log_depth_comparators) {
+        for (uint64_t step = 1; step < inputs_xor.size(); step *= 2) {
+            for (uint64_t i = 0; i + step < inputs_xor.size(); i += 2 * step) {
+                _fold_OR(inputs_xor[i], inputs_xor[i + step], inputs_xor[i]);
+            }
+        }
+        out = inputs_xor[0];
+    } else {
+        out = inputs_xor[0];
+        for (uint64_t i = 1; i < inputs_xor.size(); i++) {
+            _fold_OR(inputs_xor[i], out, out);
+        }
     }
 
     // Inverts the output result
@@ -946,7 +2025,13 @@ void gabe::bcgen::CircuitGenerator::equal(const Variable& in_a, const Variable&
     //   > Output = 1 : Variables are not equal.
     // > We want to output 1 if equal, 0 otherwise.
     INV(out, out);
-#endif
+}
+
+void gabe::bcgen::CircuitGenerator::equal(const Variable& in_a, const Variable& in_b, Wire& out) {
+    ProfileScope scope(*this, "equal");
+
+    // The variables are unsigned, thus the narrowest one is zero extended
+    _equal(in_a, in_b, false, out);
 }
 
 void gabe::bcgen::CircuitGenerator::equal(const Variable& in_a, const Variable& in_b, Variable& out) {
@@ -957,56 +2042,10 @@ void gabe::bcgen::CircuitGenerator::equal(const Variable& in_a, const Variable&
 }
 
 void gabe::bcgen::CircuitGenerator::greater_u(const Variable& in_a, const Variable& in_b, Wire& out) {
-#if BCGEN_OPTIMIZE
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-#else
-    // Safety checks
-    _assert_equal_size(in_a, in_b.size());
-
-    // Util variables
-    const uint64_t msb = in_a.size() - 1; // msb = Most Significant Bit
-
-    // Calculates A AND NOT_B
-    // > All the B bits must be negated
-    // > All the B negated bits must be AND with the A bits
-    Variable a_and_not_b(in_b.size());
-    {
-        Variable not_b(in_b.size());
-        INV(in_b, not_b);
-        AND(in_a, not_b, a_and_not_b);
-    }
-
-    // Calculates all the XNORs
-    // > All the bits need to be XNORed, except the least significant one
-    // > The i-th xnored bit must be AND with the XNORs from all its most significant bits
-    // > (Check documentation expression)
-    Variable xnors(in_a.size());
-    for (int i = msb; i > 0; i--) {
-        // XNOR current bit
-        XNOR(in_a[i], in_b[i], xnors[i]);
-
-        // Updates the XNOR chain of the current bit
-        if (i != msb) {
-            AND(xnors[i], xnors[i+1], xnors[i]);
-        }
-    }
-
-    // Assigns the most significant bit to the output result
-    out = a_and_not_b[msb];
+    ProfileScope scope(*this, "greater_u");
 
-    // Calculates all the operations between the ORs
-    // > -1 is because the most significant bit is already assigned in the output
-    for (int i = 0; i < msb; i++) {
-        // Current operation between ORs
-        Wire cur_operation;
-        AND(a_and_not_b[i], xnors[i+1], cur_operation);
-
-        // Updates the output
-        OR(cur_operation, out, out);
-    }
-#endif
+    // A is greater than B if B is smaller than A
+    _smaller(in_b, in_a, false, out);
 }
 
 void gabe::bcgen::CircuitGenerator::greater_u(const Variable& in_a, const Variable& in_b, Variable& out) {
@@ -1017,59 +2056,10 @@ void gabe::bcgen::CircuitGenerator::greater_u(const Variable& in_a, const Variab
 }
 
 void gabe::bcgen::CircuitGenerator::greater_s(const Variable& in_a, const Variable& in_b, Wire& out) {
-#if BCGEN_OPTIMIZE
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-#else
-    // Safety checks
-    _assert_equal_size(in_a, in_b.size());
-
-    // Util variables
-    const uint64_t msb = in_a.size() - 1; // msb = Most Significant Bit
-
-    // Calculates A AND NOT_B
-    // > B bits must be negated (except the most significant bit)
-    // > B negated bits must be AND with the A bits (except the most significant bit)
-    Variable a_and_not_b(in_b.size());
-    {
-        for (int i = 0; i < msb; i++) {
-            Wire not_b;
-            INV(in_b[i], not_b);
-            AND(in_a[i], not_b, a_and_not_b[i]);
-        }
-    }
+    ProfileScope scope(*this, "greater_s");
 
-    // Calculates all the XNORs
-    // > All the bits need to be XNORed, except the least significant one
-    // > The i-th xnored bit must be AND with the XNORs from all its most significant bits
-    // > (Check documentation expression)
-    Variable xnors(in_a.size());
-    for (int i = msb; i > 0; i--) {
-        // XNOR current bit
-        XNOR(in_a[i], in_b[i], xnors[i]);
-
-        // Updates the XNOR chain of the current bit
-        if (i != msb) {
-            AND(xnors[i], xnors[i+1], xnors[i]);
-        }
-    }
-
-    // Calculates and assigns the most significant bit to the output result
-    INV(in_a[msb], out);
-    AND(in_b[msb], out, out);
-
-    // Calculates all the operations between the ORs
-    // > -1 is because the most significant bit is already assigned in the output
-    for (int i = 0; i < msb; i++) {
-        // Current operation between ORs
-        Wire cur_operation;
-        AND(a_and_not_b[i], xnors[i+1], cur_operation);
-
-        // Updates the output
-        OR(cur_operation, out, out);
-    }
-#endif
+    // A is greater than B if B is smaller than A
+    _smaller(in_b, in_a, true, out);
 }
 
 void gabe::bcgen::CircuitGenerator::greater_s(const Variable& in_a, const Variable& in_b, Variable& out) {
@@ -1080,56 +2070,9 @@ void gabe::bcgen::CircuitGenerator::greater_s(const Variable& in_a, const Variab
 }
 
 void gabe::bcgen::CircuitGenerator::smaller_u(const Variable& in_a, const Variable& in_b, Wire& out) {
-#if BCGEN_OPTIMIZE
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-#else
-    // Safety checks
-    _assert_equal_size(in_a, in_b.size());
-
-    // Util variables
-    const uint64_t msb = in_a.size() - 1; // msb = Most Significant Bit
-
-    // Calculates NOT_A AND B
-    // > All the A bits must be negated
-    // > All the A negated bits must be AND with the B bits
-    Variable not_a_and_b(in_a.size());
-    {
-        Variable not_a(in_a.size());
-        INV(in_a, not_a);
-        AND(not_a, in_b, not_a_and_b);
-    }
-
-    // Calculates all the XNORs
-    // > All the bits need to be XNORed, except the least significant one
-    // > The i-th xnored bit must be AND with the XNORs from all its most significant bits
-    // > (Check documentation expression)
-    Variable xnors(in_a.size());
-    for (int i = msb; i > 0; i--) {
-        // XNOR current bit
-        XNOR(in_a[i], in_b[i], xnors[i]);
-
-        // Updates the XNOR chain of the current bit
-        if (i != msb) {
-            AND(xnors[i], xnors[i+1], xnors[i]);
-        }
-    }
-
-    // Assigns the most significant bit to the output result
-    out = not_a_and_b[msb];
-
-    // Calculates all the operations between the ORs
-    // > -1 is because the most significant bit is already assigned in the output
-    for (int i = 0; i < in_a.size() - 1; i++) {
-        // Current operation between ORs
-        Wire cur_operation;
-        AND(not_a_and_b[i], xnors[i+1], cur_operation);
+    ProfileScope scope(*this, "smaller_u");
 
-        // Updates the output
-        OR(cur_operation, out, out);
-    }
-#endif
+    _smaller(in_a, in_b, false, out);
 }
 
 void gabe::bcgen::CircuitGenerator::smaller_u(const Variable& in_a, const Variable& in_b, Variable& out) {
@@ -1140,59 +2083,9 @@ void gabe::bcgen::CircuitGenerator::smaller_u(const Variable& in_a, const Variab
 }
 
 void gabe::bcgen::CircuitGenerator::smaller_s(const Variable& in_a, const Variable& in_b, Wire& out) {
-#if BCGEN_OPTIMIZE
-    // TODO: Think in the function optimization...
-    // > Variables should have arbitrary size
-    // > Perform as many bit operations as the length of the input variables
-#else
-    // Safety checks
-    _assert_equal_size(in_a, in_b.size());
+    ProfileScope scope(*this, "smaller_s");
 
-    // Util variables
-    const uint64_t msb = in_a.size() - 1; // msb = Most Significant Bit
-
-    // Calculates NOT_A AND B
-    // > All the A bits must be negated
-    // > All the A negated bits must be AND with the B bits
-    Variable not_a_and_b(in_a.size());
-    {
-        for (int i = 0; i < msb; i++) {
-            Wire not_a;
-            INV(in_a[i], not_a);
-            AND(in_b[i], not_a, not_a_and_b[i]);
-        }
-    }
-
-    // Calculates all the XNORs
-    // > All the bits need to be XNORed, except the least significant one
-    // > The i-th xnored bit must be AND with the XNORs from all its most significant bits
-    // > (Check documentation expression)
-    Variable xnors(in_a.size());
-    for (int i = msb; i > 0; i--) {
-        // XNOR current bit
-        XNOR(in_a[i], in_b[i], xnors[i]);
-
-        // Updates the XNOR chain of the current bit
-        if (i != msb) {
-            AND(xnors[i], xnors[i+1], xnors[i]);
-        }
-    }
-
-    // Calculates and assigns the most significant bit to the output result
-    INV(in_b[msb], out);
-    AND(in_a[msb], out, out);
-
-    // Calculates all the operations between the ORs
-    // > -1 is because the most significant bit is already assigned in the output
-    for (int i = 0; i < in_a.size() - 1; i++) {
-        // Current operation between ORs
-        Wire cur_operation;
-        AND(not_a_and_b[i], xnors[i+1], cur_operation);
-
-        // Updates the output
-        OR(cur_operation, out, out);
-    }
-#endif
+    _smaller(in_a, in_b, true, out);
 }
 
 void gabe::bcgen::CircuitGenerator::smaller_s(const Variable& in_a, const Variable& in_b, Variable& out) {
@@ -1203,6 +2096,8 @@ void gabe::bcgen::CircuitGenerator::smaller_s(const Variable& in_a, const Variab
 }
 
 void gabe::bcgen::CircuitGenerator::greater_or_equal_u(const Variable& in_a, const Variable& in_b, Wire& out) {
+    ProfileScope scope(*this, "greater_or_equal_u");
+
     smaller_u(in_a, in_b, out);
     INV(out, out);
 }
@@ -1215,6 +2110,8 @@ void gabe::bcgen::CircuitGenerator::greater_or_equal_u(const Variable& in_a, con
 }
 
 void gabe::bcgen::CircuitGenerator::greater_or_equal_s(const Variable& in_a, const Variable& in_b, Wire& out) {
+    ProfileScope scope(*this, "greater_or_equal_s");
+
     smaller_s(in_a, in_b, out);
     INV(out, out);
 }
@@ -1227,6 +2124,8 @@ void gabe::bcgen::CircuitGenerator::greater_or_equal_s(const Variable& in_a, con
 }
 
 void gabe::bcgen::CircuitGenerator::smaller_or_equal_u(const Variable& in_a, const Variable& in_b, Wire& out) {
+    ProfileScope scope(*this, "smaller_or_equal_u");
+
     greater_u(in_a, in_b, out);
     INV(out, out);
 }
@@ -1239,6 +2138,8 @@ void gabe::bcgen::CircuitGenerator::smaller_or_equal_u(const Variable& in_a, con
 }
 
 void gabe::bcgen::CircuitGenerator::smaller_or_equal_s(const Variable& in_a, const Variable& in_b, Wire& out) {
+    ProfileScope scope(*this, "smaller_or_equal_s");
+
     greater_s(in_a, in_b, out);
     INV(out, out);
 }
@@ -1251,70 +2152,23 @@ void gabe::bcgen::CircuitGenerator::smaller_or_equal_s(const Variable& in_a, con
 }
 
 void gabe::bcgen::CircuitGenerator::comparator_u(const Variable& in_a, const Variable& in_b, Wire& out_e, Wire& out_g, Wire& out_s) {
-    // Safety checks
-    _assert_equal_size(in_a, in_b.size());
+    ProfileScope scope(*this, "comparator_u");
 
-    // Util variables
-    const uint64_t msb = in_a.size() - 1; // msb = Most Significant Bit
-
-    // Calculates A AND NOT_B (greater part)
-    // > All the B bits must be negated
-    // > All the B negated bits must be AND with the A bits
-    Variable a_and_not_b(in_b.size());
-    {
-        Variable not_b(in_b.size());
-        INV(in_b, not_b);
-        AND(in_a, not_b, a_and_not_b);
-    }
-
-    // Calculates NOT_A AND B (smaller part)
-    // > All the A bits must be negated
-    // > All the A negated bits must be AND with the B bits
-    Variable not_a_and_b(in_a.size());
-    {
-        Variable not_a(in_a.size());
-        INV(in_a, not_a);
-        AND(not_a, in_b, not_a_and_b);
-    }
-
-    // Calculates all the XNORs (all parts)
-    // > All the bits need to be XNORed, except the least significant one
-    // > The i-th xnored bit must be AND with the XNORs from all its most significant bits
-    // > (Check documentation expression)
-    Variable xnors(in_a.size());
-    for (int i = msb; i > 0; i--) {
-        // XNOR current bit
-        XNOR(in_a[i], in_b[i], xnors[i]);
-
-        // Updates the XNOR chain of the current bit
-        if (i != msb) {
-            AND(xnors[i], xnors[i+1], xnors[i]);
-        }
-    }
-
-    // Assigns the most significant bit to the greater and smaller output results
-    out_g = a_and_not_b[msb];
-    out_s = not_a_and_b[msb];
+    // Equal and smaller parts
+    // > The outputs are only assigned in the end, thus they can be wires of the input variables
+    Wire equal_wire, smaller_wire;
+    _equal(in_a, in_b, false, equal_wire);
+    _smaller(in_a, in_b, false, smaller_wire);
 
-    // Calculates all the operations between the ORs
-    // > -1 is because the most significant bit is already assigned in the output
-    for (int i = 0; i < in_a.size() - 1; i++) {
-        // Current operation between ORs (greater part)
-        Wire cur_operation_g;
-        AND(a_and_not_b[i], xnors[i+1], cur_operation_g);
+    // Greater part
+    // > A is greater than B if it is neither equal nor smaller, and both can not be true at the same time, thus
+    //   NOR(E, S) = XNOR(E, S)
+    Wire greater_wire;
+    XNOR(equal_wire, smaller_wire, greater_wire);
 
-        // Current operation between ORs (smaller part)
-        Wire cur_operation_s;
-        AND(not_a_and_b[i], xnors[i+1], cur_operation_s);
-
-        // Updates the outputs
-        OR(cur_operation_g, out_g, out_g);
-        OR(cur_operation_s, out_s, out_s);
-    }
-
-    // Finally, the equal part
-    OR(out_g, out_s, out_e);
-    INV(out_e, out_e);
+    out_e = equal_wire;
+    out_g = greater_wire;
+    out_s = smaller_wire;
 }
 
 void gabe::bcgen::CircuitGenerator::comparator_u(const Variable& in_a, const Variable& in_b, Variable& out_e, Variable& out_g, Variable &out_s) {
@@ -1327,77 +2181,548 @@ void gabe::bcgen::CircuitGenerator::comparator_u(const Variable& in_a, const Var
 }
 
 void gabe::bcgen::CircuitGenerator::comparator_s(const Variable& in_a, const Variable& in_b, Wire& out_e, Wire& out_g, Wire& out_s) {
+    ProfileScope scope(*this, "comparator_s");
+
+    // Equal and smaller parts
+    // > The outputs are only assigned in the end, thus they can be wires of the input variables
+    Wire equal_wire, smaller_wire;
+    _equal(in_a, in_b, true, equal_wire);
+    _smaller(in_a, in_b, true, smaller_wire);
+
+    // Greater part
+    // > A is greater than B if it is neither equal nor smaller, and both can not be true at the same time, thus
+    //   NOR(E, S) = XNOR(E, S)
+    Wire greater_wire;
+    XNOR(equal_wire, smaller_wire, greater_wire);
+
+    out_e = equal_wire;
+    out_g = greater_wire;
+    out_s = smaller_wire;
+}
+
+void gabe::bcgen::CircuitGenerator::comparator_s(const Variable& in_a, const Variable& in_b, Variable& out_e, Variable& out_g, Variable &out_s) {
+    assign_value(out_e, 0);
+    assign_value(out_g, 0);
+    assign_value(out_s, 0);
+
+    // Performs the smaller or equal operation
+    comparator_s(in_a, in_b, out_e[0], out_g[0], out_s[0]);
+}
+
+gabe::bcgen::ProfileScope::ProfileScope(CircuitGenerator& generator, const char* name) : _generator(generator), _active(generator._profiling) {
+    if (_active) {
+        _generator._profile_push(name);
+    }
+}
+
+gabe::bcgen::ProfileScope::~ProfileScope() {
+    if (_active) {
+        _generator._profile_pop();
+    }
+}
+
+std::vector<gabe::bcgen::Comparator> gabe::bcgen::CircuitGenerator::sorting_network(uint64_t size, SortingNetwork network) {
+    std::vector<Comparator> comparators;
+
+    // Networks of the next power of 2
+    // > The comparators of the missing positions are skipped
+    uint64_t padded_size = 1;
+    while (padded_size < size) {
+        padded_size *= 2;
+    }
+
+    if (network == SortingNetwork::OddEvenMerge) {
+        // Each stage merges sorted groups of p positions, comparing positions at a distance k of the same group of 2p
+        for (uint64_t p = 1; p < padded_size; p *= 2) {
+            for (uint64_t k = p; k >= 1; k /= 2) {
+                for (uint64_t j = k % p; j + k < size; j += 2 * k) {
+                    for (uint64_t i = 0; i < k && i + j + k < size; i++) {
+                        if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                            comparators.push_back({ i + j, i + j + k });
+                        }
+                    }
+                }
+            }
+        }
+    } else {
+        // Each stage merges groups of k positions, whose first merge compares mirrored positions (as if the second half was in
+        // the opposite order), and the next ones compare positions at a distance j
+        for (uint64_t k = 2; k <= padded_size; k *= 2) {
+            for (uint64_t j = k / 2; j >= 1; j /= 2) {
+                for (uint64_t i = 0; i < size; i++) {
+                    const uint64_t l = j == k / 2 ? i ^ (k - 1) : i ^ j;
+                    if (l > i && l < size) {
+                        comparators.push_back({ i, l });
+                    }
+                }
+            }
+        }
+    }
+
+    return comparators;
+}
+
+void gabe::bcgen::CircuitGenerator::sort(std::vector<Variable>& keys, bool ascending, SortingNetwork network) {
+    ProfileScope scope(*this, "sort");
+
+    _sort(keys, nullptr, ascending, network);
+}
+
+void gabe::bcgen::CircuitGenerator::sort(std::vector<Variable>& keys, std::vector<Variable>& payloads, bool ascending, SortingNetwork network) {
+    ProfileScope scope(*this, "sort");
+
     // Safety checks
-    _assert_equal_size(in_a, in_b.size());
+    if (payloads.size() != keys.size()) {
+        const std::string error_msg = fmt::format("Sorting {} variables with {} payloads.", keys.size(), payloads.size());
+        throw std::runtime_error(error_msg);
+    }
 
-    // Util variables
-    const uint64_t msb = in_a.size() - 1; // msb = Most Significant Bit
-
-    // Calculates A AND NOT_B (greater part) (msb for smaller part)
-    // > All the B bits must be negated
-    // > All the B negated bits must be AND with the A bits
-    Variable a_and_not_b(in_b.size());
-    {
-        Variable not_b(in_b.size());
-        INV(in_b, not_b);
-        AND(in_a, not_b, a_and_not_b);
-    }
-
-    // Calculates NOT_A AND B (smaller part) (msb for greater part)
-    // > All the A bits must be negated
-    // > All the A negated bits must be AND with the B bits
-    Variable not_a_and_b(in_a.size());
-    {
-        Variable not_a(in_a.size());
-        INV(in_a, not_a);
-        AND(not_a, in_b, not_a_and_b);
-    }
-
-    // Calculates all the XNORs (all parts)
-    // > All the bits need to be XNORed, except the least significant one
-    // > The i-th xnored bit must be AND with the XNORs from all its most significant bits
-    // > (Check documentation expression)
-    Variable xnors(in_a.size());
-    for (int i = msb; i > 0; i--) {
-        // XNOR current bit
-        XNOR(in_a[i], in_b[i], xnors[i]);
-
-        // Updates the XNOR chain of the current bit
-        if (i != msb) {
-            AND(xnors[i], xnors[i+1], xnors[i]);
+    _sort(keys, &payloads, ascending, network);
+}
+
+void gabe::bcgen::CircuitGenerator::_sort(std::vector<Variable>& keys, std::vector<Variable>* payloads, bool ascending, SortingNetwork network) {
+    // Safety checks
+    // > The swaps check the sizes too, but only once the circuit has gates of the previous comparators
+    for (uint64_t i = 1; i < keys.size(); i++) {
+        _assert_equal_size(keys[i], keys[0].size());
+        if (payloads) _assert_equal_size((*payloads)[i], (*payloads)[0].size());
+    }
+
+    // Circuit construction
+    // > The variables of a comparator are swapped if they are not in the sorting order
+    for (auto & comparator : sorting_network(keys.size(), network)) {
+        Variable& low = keys[comparator.low];
+        Variable& high = keys[comparator.high];
+
+        Wire swap;
+        if (ascending) {
+            greater_u(low, high, swap);
+        } else {
+            smaller_u(low, high, swap);
+        }
+
+        conditional_swap(low, high, swap);
+        if (payloads) {
+            conditional_swap((*payloads)[comparator.low], (*payloads)[comparator.high], swap);
         }
     }
+}
 
-    // Assigns the most significant bit to the greater and smaller output results
-    out_g = not_a_and_b[msb];
-    out_s = a_and_not_b[msb];
+std::vector<gabe::bcgen::Comparator> gabe::bcgen::CircuitGenerator::permutation_network(uint64_t size) {
+    std::vector<uint64_t> positions(size);
+    std::iota(positions.begin(), positions.end(), 0);
 
-    // Calculates all the operations between the ORs
-    // > -1 is because the most significant bit is already assigned in the output
-    for (int i = 0; i < in_a.size() - 1; i++) {
-        // Current operation between ORs (greater part)
-        Wire cur_operation_g;
-        AND(a_and_not_b[i], xnors[i+1], cur_operation_g);
+    std::vector<Comparator> switches;
+    _permutation_network(positions, switches);
+    return switches;
+}
 
-        // Current operation between ORs (smaller part)
-        Wire cur_operation_s;
-        AND(not_a_and_b[i], xnors[i+1], cur_operation_s);
+void gabe::bcgen::CircuitGenerator::_permutation_network(const std::vector<uint64_t>& positions, std::vector<Comparator>& switches) {
+    const uint64_t size = positions.size();
+    const uint64_t half = size / 2;
+    if (size < 2) return;
 
-        // Updates the outputs
-        OR(cur_operation_g, out_g, out_g);
-        OR(cur_operation_s, out_s, out_s);
+    // Input switches
+    for (uint64_t i = 0; i < half; i++) {
+        switches.push_back({ positions[2 * i], positions[2 * i + 1] });
     }
 
-    // Finally, the equal part
-    OR(out_g, out_s, out_e);
-    INV(out_e, out_e);
+    // Subnetworks of the even and the odd positions
+    // > The last position is in the odd subnetwork if the size is odd
+    std::vector<uint64_t> upper, lower;
+    for (uint64_t i = 0; i < half; i++) {
+        upper.push_back(positions[2 * i]);
+        lower.push_back(positions[2 * i + 1]);
+    }
+    if (size % 2) lower.push_back(positions[size - 1]);
+
+    _permutation_network(upper, switches);
+    _permutation_network(lower, switches);
+
+    // Output switches
+    // > An even size does not need the last switch, as its elements can be routed to the right subnetworks instead
+    const uint64_t n_outputs = size % 2 ? half : half - 1;
+    for (uint64_t i = 0; i < n_outputs; i++) {
+        switches.push_back({ positions[2 * i], positions[2 * i + 1] });
+    }
 }
 
-void gabe::bcgen::CircuitGenerator::comparator_s(const Variable& in_a, const Variable& in_b, Variable& out_e, Variable& out_g, Variable &out_s) {
-    assign_value(out_e, 0);
-    assign_value(out_g, 0);
-    assign_value(out_s, 0);
+std::vector<uint8_t> gabe::bcgen::CircuitGenerator::permutation_control_bits(const std::vector<uint64_t>& permutation) {
+    // Safety checks
+    std::vector<uint8_t> found(permutation.size(), 0);
+    for (auto element : permutation) {
+        if (element >= permutation.size() || found[element]) {
+            const std::string error_msg = fmt::format("Invalid permutation of {} elements (element {} is out of range or repeated).", permutation.size(), element);
+            throw std::runtime_error(error_msg);
+        }
+        found[element] = 1;
+    }
 
-    // Performs the smaller or equal operation
-    comparator_s(in_a, in_b, out_e[0], out_g[0], out_s[0]);
+    std::vector<uint8_t> control_bits;
+    _route_permutation(permutation, control_bits);
+    return control_bits;
+}
+
+void gabe::bcgen::CircuitGenerator::_route_permutation(const std::vector<uint64_t>& permutation, std::vector<uint8_t>& control_bits) {
+    const uint64_t size = permutation.size();
+    const uint64_t half = size / 2;
+    if (size < 2) return;
+
+    // Output position of each element
+    std::vector<uint64_t> destination(size);
+    for (uint64_t i = 0; i < size; i++) {
+        destination[permutation[i]] = i;
+    }
+
+    // Subnetwork of each element (0 - upper, 1 - lower, 2 - not routed yet)
+    // > Routing an element routes the other element of its input switch and of its output switch to the other subnetwork
+    std::vector<uint8_t> subnetwork(size, 2);
+    auto route = [&](uint64_t element, uint8_t side) {
+        std::vector<std::pair<uint64_t, uint8_t>> pending = { {element, side} };
+        while (!pending.empty()) {
+            auto [cur_element, cur_side] = pending.back();
+            pending.pop_back();
+            if (subnetwork[cur_element] != 2) continue;
+
+            subnetwork[cur_element] = cur_side;
+            if (cur_element < 2 * half) pending.push_back({ cur_element ^ 1, cur_side ^ 1 });
+            if (destination[cur_element] < 2 * half) pending.push_back({ permutation[destination[cur_element] ^ 1], cur_side ^ 1 });
+        }
+    };
+
+    // The last positions without a switch are fixed to their subnetworks
+    if (size % 2) {
+        route(size - 1, 1);
+        route(permutation[size - 1], 1);
+    } else {
+        route(permutation[size - 2], 0);
+    }
+    for (uint64_t i = 0; i < size; i++) {
+        route(i, 0);
+    }
+
+    // Input switches
+    // > A switch is set if its first element goes to the lower subnetwork
+    for (uint64_t i = 0; i < half; i++) {
+        control_bits.push_back(subnetwork[2 * i]);
+    }
+
+    // Permutations of the subnetworks
+    // > The element at position i of a subnetwork comes from the input switch i / 2, and ends at the output switch i / 2
+    std::vector<uint64_t> upper(half), lower(size - half);
+    for (uint64_t i = 0; i < half; i++) {
+        const bool first_is_upper = subnetwork[permutation[2 * i]] == 0;
+        upper[i] = permutation[first_is_upper ? 2 * i : 2 * i + 1] / 2;
+        lower[i] = permutation[first_is_upper ? 2 * i + 1 : 2 * i] / 2;
+    }
+    if (size % 2) lower[half] = permutation[size - 1] / 2;
+
+    _route_permutation(upper, control_bits);
+    _route_permutation(lower, control_bits);
+
+    // Output switches
+    // > A switch is set if its first element comes from the lower subnetwork
+    const uint64_t n_outputs = size % 2 ? half : half - 1;
+    for (uint64_t i = 0; i < n_outputs; i++) {
+        control_bits.push_back(subnetwork[permutation[2 * i]]);
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::permute(std::vector<Variable>& variables, const Variable& control_bits) {
+    ProfileScope scope(*this, "permute");
+
+    const std::vector<Comparator> switches = permutation_network(variables.size());
+
+    // Safety checks
+    for (uint64_t i = 1; i < variables.size(); i++) {
+        _assert_equal_size(variables[i], variables[0].size());
+    }
+    _assert_equal_size(control_bits, switches.size());
+
+    // Circuit construction
+    for (uint64_t i = 0; i < switches.size(); i++) {
+        conditional_swap(variables[switches[i].low], variables[switches[i].high], control_bits[i]);
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::decoder(const Variable& in_a, Variable& out) {
+    ProfileScope scope(*this, "decoder");
+
+    if (out.size() == 0) return;
+
+    // Input bits of the decoded values
+    // > Values after 2^64 are not representable, thus the size does not need more than 64 bits
+    const uint64_t n_bits = std::min<uint64_t>(in_a.size(), std::bit_width(out.size() - 1));
+    const uint64_t n_values = n_bits < 64 ? std::min<uint64_t>(out.size(), uint64_t(1) << n_bits) : out.size();
+
+    // Root of the tree
+    // > It is zero if any of the remaining bits is one, and none is needed if there are no remaining bits
+    const bool rooted = in_a.size() > n_bits;
+    std::vector<Wire> wires = { _one_wire };
+    if (rooted) {
+        Wire any = _zero_wire;
+        for (uint64_t i = n_bits; i < in_a.size(); i++) {
+            _fold_OR(any, in_a[i], any);
+        }
+        INV(any, wires[0]);
+    }
+
+    // Each level splits the wires with the next bit of the input
+    // > The last level only has the wires of the decoded values
+    for (uint64_t k = 0; k < n_bits; k++) {
+        const uint64_t size = k + 1 < n_bits ? uint64_t(1) << (k + 1) : n_values;
+        const uint64_t half = uint64_t(1) << k;
+
+        std::vector<Wire> next(size);
+        for (uint64_t i = 0; i < half; i++) {
+            Wire high;
+            if (k == 0 && !rooted) {
+                high = in_a[0];
+                INV(in_a[0], next[i]);
+            } else {
+                AND(wires[i], in_a[k], high);
+                XOR(wires[i], high, next[i]);
+            }
+
+            if (i + half < size) next[i + half] = high;
+        }
+        wires = next;
+    }
+
+    // Values that the input cannot represent
+    for (uint64_t i = 0; i < out.size(); i++) {
+        out[i] = i < n_values ? wires[i] : _zero_wire;
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::array_read(const std::vector<Variable>& array, const Variable& index, Variable& out) {
+    ProfileScope scope(*this, "array_read");
+
+    // Safety checks
+    for (auto & element : array) {
+        _assert_equal_size(element, out.size());
+    }
+
+    Variable one_hot(array.size());
+    decoder(index, one_hot);
+
+    // Circuit construction
+    // > Constant bits do not need an AND gate, the decoded wire is already the selected bit or zero
+    // > The selected bits are XORed in pairs, which gives a balanced tree instead of a chain
+    for (uint64_t k = 0; k < out.size(); k++) {
+        std::vector<Wire> wires;
+        for (uint64_t i = 0; i < array.size(); i++) {
+            Wire selected;
+            if (array[i][k].label == _one_wire.label) {
+                selected = one_hot[i];
+            } else {
+                _fold_AND(one_hot[i], array[i][k], selected);
+            }
+
+            if (selected.label != _zero_wire.label) {
+                wires.push_back(selected);
+            }
+        }
+
+        for (uint64_t step = 1; step < wires.size(); step *= 2) {
+            for (uint64_t i = 0; i + step < wires.size(); i += 2 * step) {
+                XOR(wires[i], wires[i + step], wires[i]);
+            }
+        }
+        out[k] = wires.empty() ? _zero_wire : wires[0];
+    }
+}
+
+void gabe::bcgen::CircuitGenerator::array_write(std::vector<Variable>& array, const Variable& index, const Variable& value) {
+    ProfileScope scope(*this, "array_write");
+
+    // Safety checks
+    for (auto & element : array) {
+        _assert_equal_size(element, value.size());
+    }
+
+    Variable one_hot(array.size());
+    decoder(index, one_hot);
+
+    // Circuit construction
+    // > The elements that the index cannot represent are unchanged
+    for (uint64_t i = 0; i < array.size(); i++) {
+        if (one_hot[i].label == _zero_wire.label) continue;
+
+        for (uint64_t k = 0; k < value.size(); k++) {
+            Wire difference;
+            _fold_XOR(array[i][k], value[k], difference);
+            _fold_AND(one_hot[i], difference, difference);
+            _fold_XOR(array[i][k], difference, array[i][k]);
+        }
+    }
+}
+
+gabe::bcgen::Variable gabe::bcgen::CircuitGenerator::_align_fixed(const Variable& in_a, uint64_t shift, uint64_t size) {
+    Variable result(size);
+    for (uint64_t i = 0; i < size; i++) {
+        result[i] = i < shift ? _zero_wire : _extended(in_a, i - shift, true);
+    }
+    return result;
+}
+
+void gabe::bcgen::CircuitGenerator::_saturate_fixed(const Variable& in_a, Variable& out, bool saturate) {
+    // Without saturation, or if every value fits in the output, the input is sign extended or truncated
+    if (!saturate || in_a.size() <= out.size()) {
+        for (uint64_t i = 0; i < out.size(); i++) {
+            out[i] = _extended(in_a, i, true);
+        }
+        return;
+    }
+
+    // The value overflows if any truncated bit (or the output sign bit) differs from the input sign bit
+    const Wire sign = in_a[in_a.size() - 1];
+    Wire overflow = _zero_wire;
+    for (uint64_t i = out.size() - 1; i + 1 < in_a.size(); i++) {
+        Wire difference;
+        XOR(in_a[i], sign, difference);
+        _fold_OR(overflow, difference, overflow);
+    }
+
+    // Saturated values are 011...1 (maximum) for positive values, and 100...0 (minimum) for negative ones
+    // > The output sign bit is the input sign bit in both cases
+    Wire not_sign;
+    INV(sign, not_sign);
+    for (uint64_t i = 0; i + 1 < out.size(); i++) {
+        Wire difference;
+        XOR(in_a[i], not_sign, difference);
+        AND(overflow, difference, difference);
+        XOR(in_a[i], difference, out[i]);
+    }
+    out[out.size() - 1] = sign;
+}
+
+void gabe::bcgen::CircuitGenerator::_convert_fixed(const Variable& in_a, uint64_t fraction_bits, FixedPoint& out, Rounding rounding, bool saturate) {
+    // More fraction bits are appended as zeros
+    if (fraction_bits <= out.fraction_bits()) {
+        const uint64_t shift = out.fraction_bits() - fraction_bits;
+        const uint64_t size = saturate ? in_a.size() + shift : std::min(in_a.size() + shift, out.size());
+        _saturate_fixed(_align_fixed(in_a, shift, size), out, saturate);
+        return;
+    }
+
+    // Kept bits (truncated, i.e. rounded towards minus infinity)
+    const uint64_t dropped = fraction_bits - out.fraction_bits();
+    const uint64_t kept_size = in_a.size() > dropped ? in_a.size() - dropped : 1;
+    Variable kept(kept_size);
+    for (uint64_t i = 0; i < kept_size; i++) {
+        kept[i] = _extended(in_a, i + dropped, true);
+    }
+
+    if (rounding == Rounding::Truncate) {
+        _saturate_fixed(kept, out, saturate);
+        return;
+    }
+
+    // Rounding increment
+    // > Nearest: the most significant dropped bit (half) is added
+    // > Nearest even: the half is only added if any other dropped bit is one, or if the kept value is odd
+    Variable increment(2);
+    increment[0] = _extended(in_a, dropped - 1, true);
+    increment[1] = _zero_wire;
+    if (rounding == Rounding::NearestEven) {
+        Wire sticky = kept[0];
+        for (uint64_t i = 0; i + 1 < dropped; i++) {
+            _fold_OR(sticky, _extended(in_a, i, true), sticky);
+        }
+        _fold_AND(increment[0], sticky, increment[0]);
+    }
+
+    // The rounded value has one more bit, which is only computed if it is needed by the output
+    Variable rounded(saturate ? kept_size + 1 : std::min(kept_size + 1, out.size()));
+    sum_s(kept, increment, rounded);
+    _saturate_fixed(rounded, out, saturate);
+}
+
+void gabe::bcgen::CircuitGenerator::convert_fixed(const FixedPoint& in_a, FixedPoint& out, Rounding rounding, bool saturate) {
+    ProfileScope scope(*this, "convert_fixed");
+
+    _convert_fixed(in_a, in_a.fraction_bits(), out, rounding, saturate);
+}
+
+void gabe::bcgen::CircuitGenerator::sum_fixed(const FixedPoint& in_a, const FixedPoint& in_b, FixedPoint& out, Rounding rounding, bool saturate) {
+    ProfileScope scope(*this, "sum_fixed");
+
+    // Inputs aligned to the finest format
+    const uint64_t fraction_bits = std::max(in_a.fraction_bits(), in_b.fraction_bits());
+    const uint64_t size = std::max(in_a.integer_bits(), in_b.integer_bits()) + fraction_bits;
+    const Variable aligned_a = _align_fixed(in_a, fraction_bits - in_a.fraction_bits(), size);
+    const Variable aligned_b = _align_fixed(in_b, fraction_bits - in_b.fraction_bits(), size);
+
+    // The sum has one more integer bit, which is only computed if it is needed by the output
+    Variable result(saturate ? size + 1 : std::min(size + 1, out.integer_bits() + fraction_bits));
+    sum_s(aligned_a, aligned_b, result);
+    _convert_fixed(result, fraction_bits, out, rounding, saturate);
+}
+
+void gabe::bcgen::CircuitGenerator::subtract_fixed(const FixedPoint& in_a, const FixedPoint& in_b, FixedPoint& out, Rounding rounding, bool saturate) {
+    ProfileScope scope(*this, "subtract_fixed");
+
+    // Inputs aligned to the finest format
+    const uint64_t fraction_bits = std::max(in_a.fraction_bits(), in_b.fraction_bits());
+    const uint64_t size = std::max(in_a.integer_bits(), in_b.integer_bits()) + fraction_bits;
+    const Variable aligned_a = _align_fixed(in_a, fraction_bits - in_a.fraction_bits(), size);
+    const Variable aligned_b = _align_fixed(in_b, fraction_bits - in_b.fraction_bits(), size);
+
+    // The difference has one more integer bit, which is only computed if it is needed by the output
+    Variable result(saturate ? size + 1 : std::min(size + 1, out.integer_bits() + fraction_bits));
+    subtract_s(aligned_a, aligned_b, result);
+    _convert_fixed(result, fraction_bits, out, rounding, saturate);
+}
+
+void gabe::bcgen::CircuitGenerator::multiply_fixed(const FixedPoint& in_a, const FixedPoint& in_b, FixedPoint& out, Rounding rounding, bool saturate) {
+    ProfileScope scope(*this, "multiply_fixed");
+
+    // The full product has the integer bits and the fraction bits of both inputs
+    // > Without saturation, the product bits after the most significant bit of the output are not computed
+    const uint64_t fraction_bits = in_a.fraction_bits() + in_b.fraction_bits();
+    const uint64_t size = in_a.size() + in_b.size();
+    Variable product(saturate ? size : std::min(size, out.integer_bits() + fraction_bits));
+    multiply_s(in_a, in_b, product);
+    _convert_fixed(product, fraction_bits, out, rounding, saturate);
+}
+
+void gabe::bcgen::CircuitGenerator::divide_fixed(const FixedPoint& in_a, const FixedPoint& in_b, FixedPoint& out, bool saturate) {
+    ProfileScope scope(*this, "divide_fixed");
+
+    // The quotient of A.2^s / B has the fraction bits of the output for s = Fo + Fb - Fa
+    // > A negative shift is applied to the divisor instead, which keeps the quotient rounded towards zero
+    const uint64_t shift_a = out.fraction_bits() + in_b.fraction_bits() - std::min(in_a.fraction_bits(), out.fraction_bits() + in_b.fraction_bits());
+    const uint64_t shift_b = in_a.fraction_bits() - std::min(in_a.fraction_bits(), out.fraction_bits() + in_b.fraction_bits());
+    const Variable dividend = _align_fixed(in_a, shift_a, in_a.size() + shift_a);
+    const Variable divisor = _align_fixed(in_b, shift_b, in_b.size() + shift_b);
+
+    // The quotient has one more bit than the dividend (the minimum divided by -1)
+    Variable quotient(saturate ? dividend.size() + 1 : out.size());
+    divide_s_quotient(dividend, divisor, quotient);
+    _saturate_fixed(quotient, out, saturate);
+}
+
+void gabe::bcgen::CircuitGenerator::equal_fixed(const FixedPoint& in_a, const FixedPoint& in_b, Wire& out) {
+    ProfileScope scope(*this, "equal_fixed");
+
+    const uint64_t fraction_bits = std::max(in_a.fraction_bits(), in_b.fraction_bits());
+    const uint64_t size = std::max(in_a.integer_bits(), in_b.integer_bits()) + fraction_bits;
+    equal(_align_fixed(in_a, fraction_bits - in_a.fraction_bits(), size), _align_fixed(in_b, fraction_bits - in_b.fraction_bits(), size), out);
+}
+
+void gabe::bcgen::CircuitGenerator::greater_fixed(const FixedPoint& in_a, const FixedPoint& in_b, Wire& out) {
+    ProfileScope scope(*this, "greater_fixed");
+
+    const uint64_t fraction_bits = std::max(in_a.fraction_bits(), in_b.fraction_bits());
+    const uint64_t size = std::max(in_a.integer_bits(), in_b.integer_bits()) + fraction_bits;
+    greater_s(_align_fixed(in_a, fraction_bits - in_a.fraction_bits(), size), _align_fixed(in_b, fraction_bits - in_b.fraction_bits(), size), out);
+}
+
+void gabe::bcgen::CircuitGenerator::smaller_fixed(const FixedPoint& in_a, const FixedPoint& in_b, Wire& out) {
+    ProfileScope scope(*this, "smaller_fixed");
+
+    const uint64_t fraction_bits = std::max(in_a.fraction_bits(), in_b.fraction_bits());
+    const uint64_t size = std::max(in_a.integer_bits(), in_b.integer_bits()) + fraction_bits;
+    smaller_s(_align_fixed(in_a, fraction_bits - in_a.fraction_bits(), size), _align_fixed(in_b, fraction_bits - in_b.fraction_bits(), size), out);
 }
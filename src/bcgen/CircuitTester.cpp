@@ -1,45 +1,161 @@
 #include <bcgen/CircuitTester.hpp>
 #include <fmt/format.h>
 
+#include <bit>
+#include <thread>
+#include <barrier>
+#include <cstring>
 #include <numeric>
+#include <algorithm>
 #include <stdexcept>
 #include <filesystem>
 
-std::vector<std::string> gabe::bcgen::CircuitTester::_split_str(std::string word, std::string delimiter) {
-    // Split result
-    std::vector<std::string> output;
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
-    // Splitting...
-    // > Keep splitting until no more delimiters are found
-    size_t index = word.find(delimiter);
-    while (index != -1) {
-        // Adds the current split part to the output result
-        output.push_back( word.substr(0, index) );
+void gabe::bcgen::CircuitTester::_map_circuit(const std::string& circuit_path) {
+    // Open the circuit file
+    const int fd = ::open(circuit_path.c_str(), O_RDONLY);
+
+    // Safety check
+    if (fd < 0) {
+        const std::string error_msg = fmt::format("Failed to open circuit file. Path to circuit: {}", circuit_path);
+        throw std::runtime_error(error_msg);
+    }
 
-        // Updates the word for next search
-        word = word.substr(index + 1);
+    // Maps the whole file
+    // > The file descriptor is no longer needed once the file is mapped
+    struct stat file_info;
+    void* contents = MAP_FAILED;
+    if (fstat(fd, &file_info) == 0 && file_info.st_size > 0) {
+        contents = mmap(nullptr, file_info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
 
-        // Finds the next index with the delimiter
-        index = word.find(delimiter);
+    // Safety check
+    if (contents == MAP_FAILED) {
+        const std::string error_msg = fmt::format("Failed to map circuit file. Path to circuit: {}", circuit_path);
+        throw std::runtime_error(error_msg);
     }
 
-    // Left string is the last part of the splitting
-    output.push_back(word);
+    // The file is read from the beginning to the end
+    madvise(contents, file_info.st_size, MADV_SEQUENTIAL);
 
-    return output;
+    _circuit = static_cast<const char*>(contents);
+    _circuit_size = file_info.st_size;
+    _circuit_position = 0;
 }
 
-gabe::bcgen::CircuitTester::~CircuitTester() {
-    if (_circuit.is_open()) {
-        _circuit.close();
+void gabe::bcgen::CircuitTester::_unmap_circuit() {
+    if (_circuit) {
+        munmap(const_cast<char*>(_circuit), _circuit_size);
+    }
+
+    _circuit = nullptr;
+    _circuit_size = 0;
+    _circuit_position = 0;
+}
+
+void gabe::bcgen::CircuitTester::_assert_labels() const {
+    if (_counter_wires > max_wires) {
+        // Creates the error message
+        const std::string error_msg = fmt::format("The circuit has {} wires, more than the {} bits labels support. Build bcgen with BCGEN_64BIT_LABELS instead.", _counter_wires, 8 * sizeof(label_t));
+
+        // Raises the error
+        throw std::runtime_error(error_msg);
+    }
+}
+
+std::string_view gabe::bcgen::CircuitTester::_read_line() {
+    // Remaining file contents
+    const char* begin = _circuit + _circuit_position;
+    const char* end = _circuit + _circuit_size;
+
+    // Finds the line break
+    const char* line_end = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+    if (!line_end) {
+        line_end = end;
     }
+
+    // Moves the reading position to the next line
+    _circuit_position = std::min<uint64_t>(line_end + 1 - _circuit, _circuit_size);
+
+    return std::string_view(begin, line_end - begin);
+}
+
+uint64_t gabe::bcgen::CircuitTester::_scan_uint(const char*& cursor, const char* end) {
+    // Skips the whitespaces before the integer
+    while (cursor < end && static_cast<uint8_t>(*cursor) <= ' ') {
+        cursor++;
+    }
+
+    // Safety check
+    if (cursor == end || *cursor < '0' || *cursor > '9') {
+        const std::string error_msg = "Failed to read circuit file. An integer was expected.";
+        throw std::runtime_error(error_msg);
+    }
+
+    // Powers of 10 to append a chunk of digits to the current value
+    static constexpr uint64_t powers[9] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+
+    uint64_t value = 0;
+
+    // Converts 8 characters at a time
+    // > Characters are loaded into a 64 bits integer, with the first character in the least significant byte
+    // > A byte is a digit if (byte - '0') < 10. Non digits get their most significant bit set by one of the following
+    //   operations. Borrows and carries only propagate towards the next characters, i.e, after the first non digit
+    while (end - cursor >= 8) {
+        uint64_t chunk;
+        std::memcpy(&chunk, cursor, 8);
+
+        const uint64_t digits = chunk - 0x3030303030303030ULL;
+        const uint64_t non_digits = (digits | (digits + 0x7676767676767676ULL)) & 0x8080808080808080ULL;
+        const uint64_t n_digits = non_digits ? std::countr_zero(non_digits) >> 3 : 8;
+
+        if (n_digits) {
+            // Keeps only the digits, placing them in the most significant bytes (leading zeros)
+            uint64_t chunk_value = digits << (8 * (8 - n_digits));
+
+            // Combines pairs of digits, then pairs of pairs, then pairs of quadruples
+            chunk_value = ((chunk_value * 10) + (chunk_value >> 8)) & 0x00FF00FF00FF00FFULL;
+            chunk_value = ((chunk_value * 100) + (chunk_value >> 16)) & 0x0000FFFF0000FFFFULL;
+            chunk_value = ((chunk_value * 10000) + (chunk_value >> 32)) & 0x00000000FFFFFFFFULL;
+
+            value = value * powers[n_digits] + chunk_value;
+            cursor += n_digits;
+        }
+
+        if (n_digits != 8) {
+            return value;
+        }
+    }
+
+    // Converts the last characters one by one
+    while (cursor < end && *cursor >= '0' && *cursor <= '9') {
+        value = value * 10 + (*cursor++ - '0');
+    }
+
+    return value;
+}
+
+uint64_t gabe::bcgen::CircuitTester::_scan_uint(std::string_view& line) {
+    const char* cursor = line.data();
+    const uint64_t value = _scan_uint(cursor, line.data() + line.size());
+
+    line.remove_prefix(cursor - line.data());
+
+    return value;
+}
+
+gabe::bcgen::CircuitTester::~CircuitTester() {
+    _unmap_circuit();
 }
 
 void gabe::bcgen::CircuitTester::open(const std::string &circuit_name, const std::string& circuit_directory) {
     // Safety - Closes a previously opened circuit file, in case there is one opened 
-    if (_circuit.is_open()) {
-        _circuit.close();
-    }
+    _unmap_circuit();
 
     // Caches the name and directory of the circuit
     _circuit_name = circuit_name;
@@ -48,73 +164,389 @@ void gabe::bcgen::CircuitTester::open(const std::string &circuit_name, const std
     // Restarts the executions counter
     _counter_executions = 0;
 
+    // Restarts the information of a previously opened circuit
+    _input_parties.clear();
+    _output_parties.clear();
+    _input_parties_wires.clear();
+    _output_parties_wires.clear();
+    _counter_wires = 0;
+    _counter_gates = 0;
+
     // Open the circuit file
-    std::string circuit_path = std::filesystem::absolute(circuit_directory) / (circuit_name + ".txt");
-    _circuit = std::ifstream( circuit_path, std::ios::in );
+    std::string circuit_path = std::filesystem::absolute(circuit_directory) / (circuit_name + _circuit_extension);
+    _map_circuit(circuit_path);
+
+    // Reads the whole circuit
+    _read_header();
+    _assert_labels();
+    _read_gates();
+    _levelize();
+
+    // The circuit file is no longer needed
+    _unmap_circuit();
+
+    // Prints circuit information to the user
+    if (_verbose) {
+        _print_circuit_info();
+    }
+}
+
+void gabe::bcgen::CircuitTester::_read_gates() {
+    _gates.clear();
+    _gates.reserve(_counter_gates);
+
+    // Gates names lookup
+    // > There are only a few gates, a linear search avoids creating a string for every gate name
+    const std::vector<std::pair<std::string, GateType>> gates_types(_gates_types.begin(), _gates_types.end());
+
+    // Circuit section contents
+    const char* cursor = _circuit + _circuit_position;
+    const char* end = _circuit + _circuit_size;
+
+    // Wires labels of a line with multiple gates
+    std::vector<uint64_t> labels;
+
+    for (uint64_t i = 0; i < _counter_gates; i++) {
+        // Gate line: <n_inputs> <n_outputs> <inputs...> <outputs...> <gate name>
+        const uint64_t n_inputs = _scan_uint(cursor, end);
+        const uint64_t n_outputs = _scan_uint(cursor, end);
+        const bool single = n_outputs == 1 && n_inputs >= 1 && n_inputs <= 2;
+
+        // Single gate lines are the common case, their labels are read directly into the gate
+        // > The output label is kept with its full width until the circuit size is checked
+        Gate gate;
+        uint64_t out = 0;
+        if (single) {
+            gate.in_a = _scan_uint(cursor, end);
+            gate.in_b = n_inputs > 1 ? _scan_uint(cursor, end) : gate.in_a;
+            gate.out = out = _scan_uint(cursor, end);
+        } else {
+            labels.clear();
+            for (uint64_t j = 0; j < n_inputs + n_outputs; j++) {
+                labels.push_back(_scan_uint(cursor, end));
+            }
+        }
+
+        // Gate name
+        while (cursor < end && static_cast<uint8_t>(*cursor) <= ' ') {
+            cursor++;
+        }
+        const char* name_begin = cursor;
+        while (cursor < end && static_cast<uint8_t>(*cursor) > ' ') {
+            cursor++;
+        }
+        const std::string_view name(name_begin, cursor - name_begin);
+
+        auto type = std::find_if(gates_types.begin(), gates_types.end(), [&](auto& entry){ return entry.first == name; });
+
+        // Safety check
+        if ((!single && (!n_outputs || n_inputs != 2 * n_outputs)) || type == gates_types.end()) {
+            const std::string error_msg = fmt::format("Unsupported gate in the circuit file: {} (gate {})", name, i);
+            throw std::runtime_error(error_msg);
+        }
+
+        if (single) {
+            gate.type = type->second;
+            _gates.push_back(gate);
+        } else {
+            // Splits the line into gates of 2 input wires
+            for (uint64_t j = 0; j < n_outputs; j++) {
+                _gates.push_back(Gate{ label_t(labels[j]), label_t(labels[n_outputs + j]), label_t(labels[n_inputs + j]), type->second });
+            }
+            out = *std::max_element(labels.begin() + n_inputs, labels.end());
+        }
+
+        // Makes sure all the wires fit in the circuit
+        _counter_wires = std::max(_counter_wires, out + 1);
+    }
+
+    _circuit_position = cursor - _circuit;
+
+    // Safety check
+    _assert_labels();
 
+    // Setups the whole size of the wires
+    _wires = std::vector<uint8_t>(_counter_wires);
+}
+
+void gabe::bcgen::CircuitTester::_levelize() {
+    // Circuits that reuse the labels of dead wires are evaluated in the file order
+    // > A wire written more than once (or an input wire that is written) cannot be placed by level
+    std::vector<bool> written_wires(_counter_wires, false);
+    for (auto & party_wires : _input_parties_wires) {
+        for (auto wire : party_wires) {
+            written_wires[wire] = true;
+        }
+    }
+
+    bool reused_labels = false;
+    for (auto & gate : _gates) {
+        if (written_wires[gate.out]) {
+            reused_labels = true;
+            break;
+        }
+        written_wires[gate.out] = true;
+    }
+
+    if (reused_labels) {
+        _levels = { 0, _gates.size() };
+        _statistics.assign(1, LevelStatistics{ _gates.size() });
+        _phases = { Phase{ 0, 1, false } };
+        return;
+    }
+
+    // Level of each wire
+    // > Input wires (and any wire that is not the output of a gate) are at level 0
+    std::vector<uint32_t> wires_levels(_counter_wires, 0);
+
+    // Level of each gate
+    // > A gate is one level after the deepest of its input wires
+    std::vector<uint32_t> gates_levels(_gates.size());
+    uint32_t n_levels = 0;
+    for (uint64_t i = 0; i < _gates.size(); i++) {
+        const Gate& gate = _gates[i];
+        const uint32_t level = std::max(wires_levels[gate.in_a], wires_levels[gate.in_b]) + 1;
+
+        wires_levels[gate.out] = level;
+        gates_levels[i] = level - 1;
+        n_levels = std::max(n_levels, level);
+    }
+
+    // Counts the gates of each level and computes where each level begins
+    _levels.assign(n_levels + 1, 0);
+    for (auto level : gates_levels) {
+        _levels[level + 1]++;
+    }
+    std::partial_sum(_levels.begin(), _levels.end(), _levels.begin());
+
+    // Places every gate in its level (stable counting sort)
+    std::vector<Gate> sorted_gates(_gates.size());
+    std::vector<uint64_t> positions(_levels.begin(), _levels.end() - 1);
+    for (uint64_t i = 0; i < _gates.size(); i++) {
+        sorted_gates[positions[gates_levels[i]]++] = _gates[i];
+    }
+    _gates = std::move(sorted_gates);
+
+    // Statistics
+    _statistics.assign(n_levels, LevelStatistics());
+    for (uint64_t level = 0; level < n_levels; level++) {
+        _statistics[level].gates = _levels[level + 1] - _levels[level];
+    }
+
+    // Groups the levels into phases
+    // > Big levels are a phase by themselves, and are split between the threads
+    // > Consecutive small levels are grouped together and are evaluated by a single thread
+    _phases.clear();
+    for (uint64_t level = 0; level < n_levels; level++) {
+        const bool parallel = _statistics[level].gates >= _parallel_threshold;
+
+        if (parallel || _phases.empty() || _phases.back().parallel) {
+            _phases.push_back(Phase{ level, level + 1, parallel });
+        } else {
+            _phases.back().last_level = level + 1;
+        }
+    }
+}
+
+template <typename T>
+void gabe::bcgen::CircuitTester::_evaluate(std::vector<T>& wires) {
+    T* values = wires.data();
+    const Gate* gates = _gates.data();
+
+    // Evaluates a range of gates
+    auto evaluate_gates = [values, gates](uint64_t begin, uint64_t end) {
+        for (uint64_t i = begin; i < end; i++) {
+            const Gate& gate = gates[i];
+
+            switch (gate.type) {
+                case GateType::XOR: values[gate.out] = values[gate.in_a] ^ values[gate.in_b]; break;
+                case GateType::AND: values[gate.out] = values[gate.in_a] & values[gate.in_b]; break;
+                case GateType::OR:  values[gate.out] = values[gate.in_a] | values[gate.in_b]; break;
+                case GateType::INV: values[gate.out] = ~values[gate.in_a]; break;
+                case GateType::EQ:  values[gate.out] = gate.in_a ? T(~T(0)) : T(0); break;
+                case GateType::EQW: values[gate.out] = values[gate.in_a]; break;
+            }
+        }
+    };
+
+    // Evaluates a range of levels, measuring the time spent in each of them
+    auto evaluate_levels = [&](uint64_t first_level, uint64_t last_level) {
+        for (uint64_t level = first_level; level < last_level; level++) {
+            const auto start = std::chrono::steady_clock::now();
+            evaluate_gates(_levels[level], _levels[level + 1]);
+            _statistics[level].time = std::chrono::steady_clock::now() - start;
+        }
+    };
+
+    // Single thread execution
+    if (_threads <= 1) {
+        evaluate_levels(0, _statistics.size());
+        return;
+    }
+
+    // Multiple threads execution
+    // > All the threads go through the same phases, and wait for each other at the end of each phase
+    const uint64_t n_threads = _threads;
+    std::barrier sync(n_threads);
+
+    auto worker = [&](uint64_t id) {
+        for (const Phase& phase : _phases) {
+            const auto start = std::chrono::steady_clock::now();
+
+            if (phase.parallel) {
+                // Each thread evaluates a contiguous chunk of the level
+                const uint64_t begin = _levels[phase.first_level];
+                const uint64_t size = _levels[phase.last_level] - begin;
+                evaluate_gates(begin + size * id / n_threads, begin + size * (id + 1) / n_threads);
+            } else if (id == 0) {
+                evaluate_levels(phase.first_level, phase.last_level);
+            }
+
+            sync.arrive_and_wait();
+
+            // The time of a parallel level includes waiting for the slowest thread
+            if (phase.parallel && id == 0) {
+                _statistics[phase.first_level].time = std::chrono::steady_clock::now() - start;
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (uint64_t id = 1; id < n_threads; id++) {
+        pool.emplace_back(worker, id);
+    }
+    worker(0);
+
+    for (auto& thread : pool) {
+        thread.join();
+    }
+}
+
+void gabe::bcgen::CircuitTester::verbose(bool enable) {
+    _verbose = enable;
+}
+
+void gabe::bcgen::CircuitTester::threads(uint64_t count) {
+    _threads = count ? count : 1;
+}
+
+const std::vector<gabe::bcgen::CircuitTester::LevelStatistics>& gabe::bcgen::CircuitTester::statistics() const {
+    return _statistics;
+}
+
+void gabe::bcgen::CircuitTester::run(const std::vector<uint8_t> &inputs) {
+    // Executes the circuit
+    evaluate(inputs);
+
+    // Show results to the user
+    if (_verbose) {
+        _print_results();
+    }
+}
+
+std::vector<std::vector<uint64_t>> gabe::bcgen::CircuitTester::evaluate(const std::vector<uint8_t> &inputs) {
     // Safety check
-    if (_circuit.fail() || !_circuit.is_open()) {
+    // > The given inputs should have the total size of all the input parties of the circuit
+    const uint64_t expected_inputs = std::accumulate(_input_parties.begin(), _input_parties.end(), uint64_t(0));
+    if (inputs.size() != expected_inputs) {
         // Error message
-        const std::string error_msg = fmt::format("Failed to open circuit file. Path to circuit: {}", circuit_path);
+        const std::string error_msg = fmt::format(
+            "Wrong amount of inputs given to the circuit (given/expected: {}/{}).",
+            inputs.size(), expected_inputs
+        );
 
         // Raises the error
         throw std::runtime_error(error_msg);
     }
 
-    _read_header();
+    // Assigns the input values to their respective wires
+    // > Wires values are either all zeros or all ones (check _evaluate documentation)
+    uint64_t input_index = 0;
+    for (auto & party_wires : _input_parties_wires) {
+        for (auto wire : party_wires) {
+            _wires[wire] = inputs[input_index++] & 0x01 ? 0xFF : 0x00;
+        }
+    }
+
+    // Executes all the gates
+    _evaluate(_wires);
+
+    // Updates the executions counter
+    _counter_executions++;
+
+    // Packs the output wires values of every output party
+    std::vector<std::vector<uint64_t>> outputs(_output_parties.size());
+    for (uint64_t i = 0; i < _output_parties.size(); i++) {
+        outputs[i].resize((_output_parties_wires[i].size() + 63) / 64, 0x00);
+
+        for (uint64_t j = 0; j < _output_parties_wires[i].size(); j++) {
+            outputs[i][j / 64] |= uint64_t(_wires[_output_parties_wires[i][j]] & 0x01) << (j % 64);
+        }
+    }
+
+    return outputs;
 }
 
-void gabe::bcgen::CircuitTester::run(const std::vector<uint8_t> &inputs) {
+std::vector<std::vector<uint64_t>> gabe::bcgen::CircuitTester::evaluate_batch(const std::vector<uint64_t> &inputs) {
     // Safety check
     // > The given inputs should have the total size of all the input parties of the circuit
-    if (inputs.size() != std::accumulate(_input_parties.begin(), _input_parties.end(), 0)) {
+    const uint64_t expected_inputs = std::accumulate(_input_parties.begin(), _input_parties.end(), uint64_t(0));
+    if (inputs.size() != expected_inputs) {
         // Error message
         const std::string error_msg = fmt::format(
             "Wrong amount of inputs given to the circuit (given/expected: {}/{}).",
-            inputs.size(), _wires.size()
+            inputs.size(), expected_inputs
         );
 
         // Raises the error
         throw std::runtime_error(error_msg);
     }
 
+    // Wires values of all the instances
+    std::vector<uint64_t> wires(_counter_wires, 0x00);
+
     // Assigns the input values to their respective wires
-    for (int i = 0 ; i < inputs.size() ; i++) {
-        _wires[i] = inputs[i];
+    uint64_t input_index = 0;
+    for (auto & party_wires : _input_parties_wires) {
+        for (auto wire : party_wires) {
+            wires[wire] = inputs[input_index++];
+        }
     }
 
-    // 
-    std::string line;
-    for (int i = 0; i < _counter_gates; i++) {
-        std::getline(_circuit, line);
+    // Executes all the gates
+    _evaluate(wires);
 
-        std::vector<std::string> parts = _split_str(line, " ");
+    // Updates the executions counter
+    _counter_executions++;
 
-        _wires[i + inputs.size()] = _gates_operations[parts[parts.size()-1]](parts);
+    // Collects the output wires values of every output party
+    std::vector<std::vector<uint64_t>> outputs(_output_parties.size());
+    for (uint64_t i = 0; i < _output_parties.size(); i++) {
+        for (auto wire : _output_parties_wires[i]) {
+            outputs[i].push_back(wires[wire]);
+        }
     }
 
-    // Return the reading pointer back to the beginning of the circuit
-    _circuit.seekg(_circuit_start_pos);
-
-    // Show results to the user
-    _print_results();
+    return outputs;
 }
 
 void gabe::bcgen::CircuitTester::_print_results() {
-    printf("%s\n", fmt::format("+ {:^78} +", fmt::format(">>> Execution {} <<<", ++_counter_executions)).c_str());
+    printf("%s\n", fmt::format("+ {:^78} +", fmt::format(">>> Execution {} <<<", _counter_executions)).c_str());
     printf("%s\n", fmt::format("+ {:<78} +", "Inputs:").c_str());
     for (int i = 0; i < _input_parties.size(); i++) {
         std::string word;
+        word.reserve(_input_parties_wires[i].size());
         for (auto wire : _input_parties_wires[i]) {
-            word += std::to_string(_wires[wire]);
+            word.push_back('0' + (_wires[wire] & 0x01));
         }
         printf("%s\n", fmt::format("+--> P{:<5}: {:<67} +", i, word).c_str());
     }
     printf("%s\n", fmt::format("+ {:<78} +", "Outputs:").c_str());
     for (int i = 0; i < _output_parties.size(); i++) {
         std::string word;
+        word.reserve(_output_parties_wires[i].size());
         for (auto wire : _output_parties_wires[i]) {
-            word += std::to_string(_wires[wire]);
+            word.push_back('0' + (_wires[wire] & 0x01));
         }
         printf("%s\n", fmt::format("+--> P{:<5}: {:<67} +", i, word).c_str());
     }
@@ -4,49 +4,42 @@
 #include <cstdint>
 
 gabe::bcgen::LibscapiCircuitTester::LibscapiCircuitTester() : CircuitTester() {
-    _gates_operations = {
-        { "0110", [&](const std::vector<std::string>& gate){ return _wires[std::stoi(gate[2])] ^ _wires[std::stoi(gate[3])]; } },
-        { "10",   [&](const std::vector<std::string>& gate){ return !_wires[std::stoi(gate[2])]; } },
-        { "0001", [&](const std::vector<std::string>& gate){ return _wires[std::stoi(gate[2])] & _wires[std::stoi(gate[3])]; } },
-        { "0111", [&](const std::vector<std::string>& gate){ return _wires[std::stoi(gate[2])] | _wires[std::stoi(gate[3])]; } }
-    };
+    _gates_types = { {"0110", GateType::XOR}, {"10", GateType::INV}, {"0001", GateType::AND}, {"0111", GateType::OR} };
 }
 
 void gabe::bcgen::LibscapiCircuitTester::_read_header() {
-    std::string line;
-    std::vector<std::string> line_parts;
+    std::string_view line;
     
     // Reads the first line
     // > Should contain the total number of gates followed by the total number of input parties
-    std::getline(_circuit, line);
-    line_parts = _split_str(line, " ");
-    _counter_gates = std::stoul(line_parts[0]);
-    int n_input_parties = std::stoi(line_parts[1]);
+    line = _read_line();
+    _counter_gates = _scan_uint(line);
+    uint64_t n_input_parties = _scan_uint(line);
 
     // Ignores the next line (empty line)
-    std::getline(_circuit, line);
+    _read_line();
 
     // Reads all the inputs lines
     // > First line is the party number and followed by its amount
     // > Next lines should contain the wire labels of all the party input wires
     // > Next line is empty -> ignore.
-    for (int i = 0; i < n_input_parties; i++) {
+    for (uint64_t i = 0; i < n_input_parties; i++) {
         // Reads the party number and its size
-        std::getline(_circuit, line);
-        line_parts = _split_str(line, " ");
-        int n_wires = std::stoi(line_parts[1]);
+        line = _read_line();
+        _scan_uint(line);
+        uint64_t n_wires = _scan_uint(line);
         _input_parties.push_back(n_wires);
 
         // Reads the party wire labels
-        std::vector<uint64_t> cur_party_wires;
-        for (int i = 0; i < n_wires; i++) {
-            std::getline(_circuit, line);
-            cur_party_wires.push_back(std::stoi(line));
+        std::vector<label_t> cur_party_wires;
+        for (uint64_t j = 0; j < n_wires; j++) {
+            line = _read_line();
+            cur_party_wires.push_back(_scan_uint(line));
         }
         _input_parties_wires.push_back(cur_party_wires);
 
         // Ignores the next line (empty line)
-        std::getline(_circuit, line);
+        _read_line();
     }
 
     // Reads all the output lines
@@ -55,22 +48,28 @@ void gabe::bcgen::LibscapiCircuitTester::_read_header() {
     //    first line can be already the beginning of the circuit. If so, stop searching.
     // > Next lines should contain the wire labels of all the party output wires
     // > Next line is empty -> ignore.
-    for (int i = 0; i < n_input_parties; i++) {
+    for (uint64_t i = 0; i < n_input_parties; i++) {
         // Reads the party number and its size
-        std::getline(_circuit, line);
-        line_parts = _split_str(line, " ");
+        const uint64_t line_position = _circuit_position;
+        line = _read_line();
 
         // Check if the beginning of the circuit was found instead
-        if (line_parts.size() > 2) { break; }
+        // > A party line only has 2 integers, while a gate line has more than 2 parts
+        std::string_view line_parts = line;
+        _scan_uint(line_parts);
+        uint64_t n_wires = _scan_uint(line_parts);
+        if (line_parts.find_first_not_of(" \r\t") != std::string_view::npos) {
+            _circuit_position = line_position;
+            break;
+        }
 
-        int n_wires = std::stoi(line_parts[1]);
         _output_parties.push_back(n_wires);
 
         // Reads the party wire labels
-        std::vector<uint64_t> cur_party_wires;
-        for (int i = 0; i < n_wires; i++) {
-            std::getline(_circuit, line);
-            uint64_t wire_label = std::stoi(line);
+        std::vector<label_t> cur_party_wires;
+        for (uint64_t j = 0; j < n_wires; j++) {
+            line = _read_line();
+            uint64_t wire_label = _scan_uint(line);
             cur_party_wires.push_back(wire_label);
             if (wire_label + 1 > _counter_wires) {
                 _counter_wires = wire_label + 1;
@@ -79,18 +78,7 @@ void gabe::bcgen::LibscapiCircuitTester::_read_header() {
         _output_parties_wires.push_back(cur_party_wires);
 
         // Ignores the next line (empty line)
-        std::getline(_circuit, line);
-
-        // Updates the current read index (start of the circuit)
-        _circuit_start_pos = _circuit.tellg();
+        // > The reading position is now at the start of the circuit, unless there are more output parties
+        _read_line();
     }
-
-    // Makes sure the reading pointer is back to the beginning of the circuit
-    _circuit.seekg(_circuit_start_pos);
-
-    // Setups the whole size of the wires
-    _wires = std::vector<uint8_t>(_counter_wires);
-
-    // Prints circuit information to the user
-    _print_circuit_info();
 }
@@ -1,20 +1,49 @@
 #include <bcgen/CircuitGenerator.hpp>
+#include <fmt/format.h>
 
-gabe::bcgen::Variable::Variable(uint64_t number_wires) {
-    _wires.resize(number_wires);
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+gabe::bcgen::Variable::Variable(uint64_t number_wires) : _size(number_wires) {
+    // Small variables do not allocate their wires
+    if (_size <= inline_size) {
+        _wires = _inline_wires;
+        std::uninitialized_fill_n(_wires, _size, Wire());
+    } else {
+        _wires = new Wire[_size];
+    }
 }
 
-gabe::bcgen::Wire& gabe::bcgen::Variable::operator[](uint64_t index) {
-    return _wires[index];
+gabe::bcgen::Variable::Variable(Wire* wires, uint64_t size, int64_t stride) : _size(size), _wires(wires), _stride(stride), _view(true) {}
+
+gabe::bcgen::Variable::Variable(const Variable& other) : Variable(other._size) {
+    std::copy(other.begin(), other.end(), _wires);
 }
 
-const gabe::bcgen::Wire& gabe::bcgen::Variable::operator[](uint64_t index) const {
-    return _wires[index];
+gabe::bcgen::Variable::Variable(Variable&& other) noexcept : _size(other._size) {
+    if (other._view || other._wires == other._inline_wires) {
+        // Views and small variables wires are copied
+        _wires = _size <= inline_size ? _inline_wires : new Wire[_size];
+        std::copy(other.begin(), other.end(), _wires);
+    } else {
+        // Allocated wires are taken
+        _wires = std::exchange(other._wires, other._inline_wires);
+        other._size = 0;
+    }
+}
+
+gabe::bcgen::Variable::~Variable() {
+    if (!_view && _wires != _inline_wires) {
+        delete[] _wires;
+    }
 }
 
-void gabe::bcgen::Variable::operator=(const Variable& other) {
+void gabe::bcgen::Variable::_copy_wires(const Variable& other) {
     // TODO: Improve this...
-    if (_wires.size() != other.size()) {
+    if (_size != other.size()) {
         // Error message
         const std::string error_msg = "Cannot use equal operation on variables with different sizes.";
         
@@ -22,11 +51,119 @@ void gabe::bcgen::Variable::operator=(const Variable& other) {
         throw std::runtime_error(error_msg);
     }
 
-    for (int i = 0; i < _wires.size(); i++) {
-        _wires[i].label = other[i].label;
+    // Safety - Views can overlap other wires (e.g, a variable and its reversed view), thus they are copied through a temporary
+    if (_view || other._view) {
+        const Variable copy(other);
+        std::copy(copy.begin(), copy.end(), begin());
+    } else {
+        std::copy(other.begin(), other.end(), begin());
     }
 }
 
-uint64_t gabe::bcgen::Variable::size() const {
-    return _wires.size();
+gabe::bcgen::Variable& gabe::bcgen::Variable::operator=(const Variable& other) {
+    if (this != &other) {
+        _copy_wires(other);
+    }
+
+    return *this;
+}
+
+gabe::bcgen::Variable& gabe::bcgen::Variable::operator=(Variable&& other) {
+    if (this == &other) return *this;
+
+    // Allocated wires are taken when both variables own their wires
+    const bool other_allocated = !other._view && other._wires != other._inline_wires;
+    const bool owner = !_view && _wires != _inline_wires;
+    if (owner && other_allocated && _size == other._size) {
+        std::swap(_wires, other._wires);
+    } else {
+        _copy_wires(other);
+    }
+
+    return *this;
+}
+
+gabe::bcgen::VariableView gabe::bcgen::Variable::slice(uint64_t begin, uint64_t size) {
+    // Safety check
+    if (begin > _size || size > _size - begin) {
+        const std::string error_msg = fmt::format("Cannot view the wires [{}, {}) of a variable with size {}.", begin, begin + size, _size);
+        throw std::runtime_error(error_msg);
+    }
+
+    return VariableView(_wires + static_cast<int64_t>(begin) * _stride, size, _stride);
+}
+
+const gabe::bcgen::VariableView gabe::bcgen::Variable::slice(uint64_t begin, uint64_t size) const {
+    return const_cast<Variable*>(this)->slice(begin, size);
+}
+
+gabe::bcgen::VariableView gabe::bcgen::Variable::reversed() {
+    // The first wire of the view is the last wire of the variable
+    Wire* last = _size ? _wires + static_cast<int64_t>(_size - 1) * _stride : _wires;
+    return VariableView(last, _size, -_stride);
+}
+
+const gabe::bcgen::VariableView gabe::bcgen::Variable::reversed() const {
+    return const_cast<Variable*>(this)->reversed();
+}
+
+gabe::bcgen::Variable gabe::bcgen::Variable::concatenate(const Variable& low, const Variable& high) {
+    Variable result(low.size() + high.size());
+
+    std::copy(low.begin(), low.end(), result.begin());
+    std::copy(high.begin(), high.end(), result.slice(low.size(), high.size()).begin());
+
+    return result;
+}
+
+gabe::bcgen::FixedPoint::FixedPoint(uint64_t integer_bits, uint64_t fraction_bits) : Variable(integer_bits + fraction_bits), _fraction_bits(fraction_bits) {
+    // Safety check
+    if (integer_bits == 0) {
+        const std::string error_msg = "A fixed point variable needs at least one integer bit (the sign bit).";
+        throw std::runtime_error(error_msg);
+    }
+}
+
+gabe::bcgen::FixedPoint& gabe::bcgen::FixedPoint::operator=(const FixedPoint& other) {
+    // Safety check
+    if (_fraction_bits != other._fraction_bits || _size != other._size) {
+        const std::string error_msg = fmt::format("Cannot assign a Q{}.{} variable to a Q{}.{} variable.",
+            other.integer_bits(), other._fraction_bits, integer_bits(), _fraction_bits
+        );
+        throw std::runtime_error(error_msg);
+    }
+
+    Variable::operator=(other);
+    return *this;
+}
+
+uint64_t gabe::bcgen::FixedPoint::encode(double value) const {
+    // Safety check
+    if (_size > 64) {
+        const std::string error_msg = fmt::format("Cannot encode a value in a fixed point variable with size {}.", _size);
+        throw std::runtime_error(error_msg);
+    }
+
+    // Range of the format
+    // > The bounds are computed as reals, as the maximum of a 64 bits format does not fit in a double
+    const double scaled = std::nearbyint(std::ldexp(value, static_cast<int>(_fraction_bits)));
+    const double min = -std::ldexp(1.0, static_cast<int>(_size - 1));
+    const uint64_t mask = _size == 64 ? ~uint64_t(0) : (uint64_t(1) << _size) - 1;
+
+    if (scaled < min) return (uint64_t(1) << (_size - 1)) & mask;
+    if (scaled >= -min) return mask >> 1;
+    return static_cast<uint64_t>(static_cast<int64_t>(scaled)) & mask;
+}
+
+double gabe::bcgen::FixedPoint::decode(uint64_t value) const {
+    // Safety check
+    if (_size > 64) {
+        const std::string error_msg = fmt::format("Cannot decode a value of a fixed point variable with size {}.", _size);
+        throw std::runtime_error(error_msg);
+    }
+
+    // Sign extension of the value
+    const uint64_t shift = 64 - _size;
+    const int64_t integer = _size ? static_cast<int64_t>(value << shift) >> shift : 0;
+    return std::ldexp(static_cast<double>(integer), -static_cast<int>(_fraction_bits));
 }
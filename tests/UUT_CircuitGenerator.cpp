@@ -1,10 +1,18 @@
 #include <bcgen/CircuitGenerator.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
 #include <limits>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <random>
+#include <bit>
+#include <algorithm>
+#include <numeric>
+#include <optional>
 
 // Don't use this :)
 using Wire = gabe::bcgen::Wire;
@@ -1580,7 +1588,1860 @@ TEST_CASE("2's Complement Operations") {
     // Test suit index:
     // > Test 1: 2's Complement on a variable overriding it
     // > Test 2: 2's Complement on a variable into new variable
+
+    // Evaluates the 2's complement of all the values of 1 to 6 bits, in the lanes of the shadow evaluation
+    for (uint64_t size = 1; size <= 6; size++) {
+        CircuitGeneratorTester circuit("Twos_Complement_Operations", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.shadow(true);
+        circuit.add_input_party(size);
+        circuit.add_output_party(size);
+
+        std::vector<uint64_t> lanes(size);
+        for (uint64_t k = 0; k < (uint64_t(1) << size); k++) {
+            for (uint64_t i = 0; i < size; i++) {
+                lanes[i] |= uint64_t((k >> i) & 0x01) << k;
+            }
+        }
+
+        Var var(size), var_t(size);
+        circuit.add_input_lanes(var, lanes);
+        circuit.add_output(var_t);
+        circuit.start();
+
+        const uint64_t mask = (uint64_t(1) << size) - 1;
+
+        // -------------------
+        // > SECTION - Test 1: 2's Complement on a variable overriding it.
+        // -------------------
+        Var var_c = var;
+        circuit.twos_complement(var_c);
+        for (uint64_t k = 0; k < (uint64_t(1) << size); k++) {
+            REQUIRE(circuit.value(var_c, k) == ((0 - k) & mask));
+        }
+        // > !SECTION - Test 1: 2's Complement on a variable overriding it.
+
+        // -------------------
+        // > SECTION - Test 2: 2's Complement on a variable into new variable.
+        // -------------------
+        // The input variable must not be changed, and the output must have the same size
+        circuit.twos_complement(var, var_t);
+        for (uint64_t k = 0; k < (uint64_t(1) << size); k++) {
+            REQUIRE(circuit.value(var, k) == k);
+            REQUIRE(circuit.value(var_t, k) == ((0 - k) & mask));
+        }
+
+        Var var_w(size + 1);
+        REQUIRE_THROWS_AS(circuit.twos_complement(var, var_w), std::runtime_error);
+        // > !SECTION - Test 2: 2's Complement on a variable into new variable.
+    }
     // > !SECTION - Test suit "2's Complement Operations"
 }
 
+TEST_CASE("Increment and Negation Operations") {
+    // > SECTION - Test suit "Increment and Negation Operations"
+    //
+    // This test suit aims to test the increment, decrement and negation operations of the Circuit Generator class.
+    //
+    // Note: The constructor of CircuitGenerator does not have a public visibility, thus an instance cannot be created.
+    // For the sake of the tests, the tester class makes it accessible.
+    //
+    // Test suit index:
+    // > Test 1: All the 1 to 5 bits inputs
+    // > Test 2: Gates of the operations
+
+    // -------------------
+    // > SECTION - Test 1: All the 1 to 5 bits inputs.
+    // -------------------
+    // Every operation should be correct for all the inputs (and control wire values) and for narrower, equal and wider
+    // outputs, which are evaluated in the lanes of the shadow evaluation.
+    for (uint64_t size = 1; size <= 5; size++) {
+        CircuitGeneratorTester circuit("Increment_Operations", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.shadow(true);
+        circuit.add_input_party(size + 1);
+        circuit.add_output_party(1);
+
+        // The lane k has the value k of the input variable, and the control wire value above it
+        const uint64_t n_lanes = uint64_t(1) << (size + 1);
+        std::vector<uint64_t> lanes(size + 1);
+        for (uint64_t k = 0; k < n_lanes; k++) {
+            for (uint64_t i = 0; i <= size; i++) {
+                lanes[i] |= uint64_t((k >> i) & 0x01) << k;
+            }
+        }
+
+        Var in(size + 1), output(1);
+        circuit.add_input_lanes(in, lanes);
+        circuit.add_output(output);
+        circuit.start();
+
+        Var var = in.slice(0, size);
+        const Wire control = in[size];
+
+        for (uint64_t out_size : { uint64_t(1), size, size + 2 }) {
+            Var inc(out_size), dec(out_size), neg(out_size), cneg(out_size);
+            circuit.increment(var, inc);
+            circuit.decrement(var, dec);
+            circuit.negate(var, neg);
+            circuit.negate(var, control, cneg);
+
+            const uint64_t mask = (uint64_t(1) << out_size) - 1;
+            for (uint64_t k = 0; k < n_lanes; k++) {
+                const uint64_t x = k & ((uint64_t(1) << size) - 1);
+                const int64_t signed_x = x < (uint64_t(1) << (size - 1)) ? x : x - (uint64_t(1) << size);
+                const bool c = k >> size;
+
+                REQUIRE(circuit.value(inc, k) == ((x + 1) & mask));
+                REQUIRE(circuit.value(dec, k) == ((x - 1) & mask));
+                REQUIRE(circuit.value(neg, k) == ((0 - signed_x) & mask));
+                REQUIRE(circuit.value(cneg, k) == ((c ? 0 - signed_x : signed_x) & mask));
+            }
+        }
+
+        // The in place operations should give the same results
+        Var var_inc = var, var_dec = var, var_neg = var;
+        circuit.increment(var_inc);
+        circuit.decrement(var_dec);
+        circuit.negate(var_neg);
+        for (uint64_t k = 0; k < n_lanes; k++) {
+            const uint64_t x = k & ((uint64_t(1) << size) - 1);
+            const uint64_t mask = (uint64_t(1) << size) - 1;
+
+            REQUIRE(circuit.value(var_inc, k) == ((x + 1) & mask));
+            REQUIRE(circuit.value(var_dec, k) == ((x - 1) & mask));
+            REQUIRE(circuit.value(var_neg, k) == ((0 - x) & mask));
+        }
+    }
+    // > !SECTION - Test 1: All the 1 to 5 bits inputs.
+
+    // -------------------
+    // > SECTION - Test 2: Gates of the operations.
+    // -------------------
+    // The operations with the constant one only need a chain of half adders, thus N - 2 non XOR gates for N bits
+    auto costs = [](auto operation) {
+        CircuitGeneratorTester circuit("Increment_Operations_Costs", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.add_input_party(65);
+        circuit.add_output_party(64);
+
+        Var a(64), c(1), out(64);
+        circuit.add_input(a);
+        circuit.add_input(c);
+        circuit.add_output(out);
+        circuit.start();
+
+        const uint64_t and_gates = circuit._gates_counters["AND"];
+        const uint64_t or_gates = circuit._gates_counters["OR"];
+        operation(circuit, a, c[0], out);
+        return circuit._gates_counters["AND"] - and_gates + circuit._gates_counters["OR"] - or_gates;
+    };
+
+    REQUIRE(costs([](CircuitGenerator& circuit, const Var& a, const Wire c, Var& out) { circuit.increment(a, out); }) == 62);
+    REQUIRE(costs([](CircuitGenerator& circuit, const Var& a, const Wire c, Var& out) { circuit.decrement(a, out); }) == 62);
+    REQUIRE(costs([](CircuitGenerator& circuit, const Var& a, const Wire c, Var& out) { circuit.negate(a, out); }) == 62);
+    REQUIRE(costs([](CircuitGenerator& circuit, const Var& a, const Wire c, Var& out) { circuit.twos_complement(a, out); }) == 62);
+    REQUIRE(costs([](CircuitGenerator& circuit, const Var& a, const Wire c, Var& out) { circuit.negate(a, c, out); }) == 125);
+    // > !SECTION - Test 2: Gates of the operations.
+    // > !SECTION - Test suit "Increment and Negation Operations"
+}
+
+TEST_CASE("Depth Tracking") {
+    // > SECTION - Test suit "Depth Tracking"
+    //
+    // This test suit aims to test the depth tracking of the circuit wires.
+    //
+    // Note: The constructor of CircuitGenerator does not have a public visibility, thus an instance cannot be created.
+    // For the sake of the tests, the tester class makes it accessible.
+    //
+    // Test suit index:
+    // > Test 1: Depth of wires
+    // > Test 2: Depth of variables
+    // > Test 3: Depth with the tracking disabled
+
+    // -------------------
+    // > SECTION - Test 1: Depth of wires.
+    // -------------------
+    // This test creates a small chain of gates. The abstract generator has no gates names, thus they are given by the test.
+    // In this test, the following should be expected:
+    // 1. Input and constant wires have a depth of 0
+    // 2. Every gate adds 1 to the depth, and only AND gates add 1 to the AND depth
+    CircuitGeneratorTester circuit("Depth_Tracking", "circuits/tests");
+    circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+    circuit.track_depth(true);
+    circuit.add_input_party(2);
+    circuit.add_output_party(1);
+
+    Wire a, b, x, y, z;
+    circuit.add_input(a);
+    circuit.add_input(b);
+    circuit.add_output(z);
+    circuit.start();
+
+    Wire one;
+    circuit.assign_value(one, 1);
+
+    circuit.AND(a, b, x);
+    circuit.XOR(x, a, y);
+    circuit.AND(y, x, z);
+    circuit.INV(z, z);
+
+    REQUIRE(circuit.depth(a).depth == 0);
+    REQUIRE(circuit.depth(one).depth == 0);
+    REQUIRE(circuit.depth(x).depth == 1);
+    REQUIRE(circuit.depth(x).and_depth == 1);
+    REQUIRE(circuit.depth(y).depth == 2);
+    REQUIRE(circuit.depth(y).and_depth == 1);
+    REQUIRE(circuit.depth(z).depth == 4);
+    REQUIRE(circuit.depth(z).and_depth == 2);
+    // > !SECTION - Test 1: Depth of wires.
+
+    // -------------------
+    // > SECTION - Test 2: Depth of variables.
+    // -------------------
+    // The depth of a variable should be the depth of its deepest wire.
+    Var variable(3);
+    variable[0] = a;
+    variable[1] = y;
+    variable[2] = x;
+
+    REQUIRE(circuit.depth(variable).depth == 2);
+    REQUIRE(circuit.depth(variable).and_depth == 1);
+
+    circuit.stop();
+    // > !SECTION - Test 2: Depth of variables.
+
+    // -------------------
+    // > SECTION - Test 3: Depth with the tracking disabled.
+    // -------------------
+    // A runtime error exception should be raised if the depth is requested without tracking it.
+    CircuitGeneratorTester untracked("Depth_Untracked", "circuits/tests");
+    bool failed_t3 = false;
+
+    try { untracked.depth(a); }
+    catch (std::runtime_error) { failed_t3 = true; }
+
+    REQUIRE(failed_t3);
+    // > !SECTION - Test 3: Depth with the tracking disabled.
+    // > !SECTION - Test suit "Depth Tracking"
+}
+
+TEST_CASE("Profiling") {
+    // > SECTION - Test suit "Profiling"
+    //
+    // This test suit aims to test the profiling of the gates costs by call path.
+    //
+    // Note: The constructor of CircuitGenerator does not have a public visibility, thus an instance cannot be created.
+    // For the sake of the tests, the tester class makes it accessible.
+    //
+    // Test suit index:
+    // > Test 1: Folded stacks report
+    // > Test 2: JSON summary
+
+    // -------------------
+    // > SECTION - Setup
+    // -------------------
+    // This section creates a circuit that multiplies two 8 bits inputs, and sums them inside a user profiling scope.
+    CircuitGeneratorTester circuit("Profiling", "circuits/tests");
+    circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+    circuit.profile(true);
+    circuit.add_input_party(16);
+    circuit.add_output_party(24);
+
+    Var a(8), b(8), product(16), total(8);
+    circuit.add_input(a);
+    circuit.add_input(b);
+    circuit.add_output(product);
+    circuit.add_output(total);
+    circuit.start();
+
+    circuit.multiply_u(a, b, product);
+    {
+        gabe::bcgen::ProfileScope scope(circuit, "user");
+        circuit.sum(a, b, total);
+    }
+
+    const uint64_t and_depth = std::max(circuit.depth(product).and_depth, circuit.depth(total).and_depth);
+    circuit.stop();
+    // > !SECTION - Setup
+
+    // -------------------
+    // > SECTION - Test 1: Folded stacks report.
+    // -------------------
+    // Every gate should be attributed to its call path, and the gates counts of all the lines should add up to the total of
+    // gates of the circuit.
+    const std::string folded = circuit.profile_folded();
+
+    REQUIRE(folded.find("Profiling;multiply_u;sum;AND ") != std::string::npos);
+    REQUIRE(folded.find("Profiling;user;sum;XOR ") != std::string::npos);
+    REQUIRE(folded.find("Profiling;AND ") != std::string::npos);
+
+    uint64_t folded_gates = 0;
+    std::istringstream lines(folded);
+    for (std::string path; lines >> path;) {
+        uint64_t count;
+        lines >> count;
+        folded_gates += count;
+    }
+    REQUIRE(folded_gates == circuit._counter_gates);
+    // > !SECTION - Test 1: Folded stacks report.
+
+    // -------------------
+    // > SECTION - Test 2: JSON summary.
+    // -------------------
+    // The root scope should account for all the gates of the circuit, and at least the AND depth of its outputs, and both
+    // reports should be written next to the circuit.
+    const std::string json = circuit.profile_json();
+
+    REQUIRE(json.rfind(fmt::format("{{\"name\":\"Profiling\",\"calls\":1,\"gates\":{},", circuit._counter_gates), 0) == 0);
+    REQUIRE(std::stoull(json.substr(json.find("\"and_depth\":") + 12)) >= and_depth);
+    REQUIRE(and_depth > 0);
+    REQUIRE(json.find("\"name\":\"user\",\"calls\":1,") != std::string::npos);
+    REQUIRE(std::filesystem::exists("circuits/tests/Profiling_profile.folded"));
+    REQUIRE(std::filesystem::exists("circuits/tests/Profiling_profile.json"));
+    // > !SECTION - Test 2: JSON summary.
+    // > !SECTION - Test suit "Profiling"
+}
+
+TEST_CASE("Shadow Evaluation") {
+    // > SECTION - Test suit "Shadow Evaluation"
+    //
+    // This test suit aims to test the cleartext evaluation of the circuit as the gates are written.
+    //
+    // Note: The constructor of CircuitGenerator does not have a public visibility, thus an instance cannot be created.
+    // For the sake of the tests, the tester class makes it accessible.
+    //
+    // Test suit index:
+    // > Test 1: Single values
+    // > Test 2: Evaluation lanes
+    // > Test 3: Shadow evaluation disabled
+    // > Test 4: Arithmetic operations
+
+    // -------------------
+    // > SECTION - Test 1: Single values.
+    // -------------------
+    // The values of the operations outputs should be available right after the gates are written, as well as the values of
+    // the output wires once the circuit is complete.
+    CircuitGeneratorTester circuit("Shadow_Evaluation", "circuits/tests");
+    circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+    circuit.shadow(true);
+    circuit.add_input_party(16);
+    circuit.add_output_party(8);
+
+    Var a(8), b(8), total(8);
+    circuit.add_input(a, 0xB7);
+    circuit.add_input(b, 0x5C);
+    circuit.add_output(total);
+    circuit.start();
+
+    Var difference(8), x(8), y(8), z(8);
+    Wire greater, equal;
+    circuit.sum(a, b, total);
+    circuit.subtract(a, b, difference);
+    circuit.XOR(a, b, x);
+    circuit.AND(a, b, y);
+    circuit.INV(a, z);
+    circuit.greater_u(a, b, greater);
+    circuit.equal(a, b, equal);
+
+    REQUIRE(circuit.value(a) == 0xB7);
+    REQUIRE(circuit.value(total) == ((0xB7 + 0x5C) & 0xFF));
+    REQUIRE(circuit.value(difference) == ((0xB7 - 0x5C) & 0xFF));
+    REQUIRE(circuit.value(x) == (0xB7 ^ 0x5C));
+    REQUIRE(circuit.value(y) == (0xB7 & 0x5C));
+    REQUIRE(circuit.value(z) == (~0xB7 & 0xFF));
+    REQUIRE(circuit.value(greater) == true);
+    REQUIRE(circuit.value(equal) == false);
+
+    circuit.stop();
+    REQUIRE(circuit.value(total) == ((0xB7 + 0x5C) & 0xFF));
+    // > !SECTION - Test 1: Single values.
+
+    // -------------------
+    // > SECTION - Test 2: Evaluation lanes.
+    // -------------------
+    // Every lane should be an independent evaluation of the circuit.
+    CircuitGeneratorTester lanes_circuit("Shadow_Evaluation_Lanes", "circuits/tests");
+    lanes_circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+    lanes_circuit.shadow(true);
+    lanes_circuit.add_input_party(16);
+    lanes_circuit.add_output_party(9);
+
+    // The lane k has the values k * 3 and 255 - k
+    std::vector<uint64_t> a_lanes(8), b_lanes(8);
+    for (uint64_t k = 0; k < 64; k++) {
+        for (uint64_t i = 0; i < 8; i++) {
+            a_lanes[i] |= uint64_t(((k * 3) >> i) & 0x01) << k;
+            b_lanes[i] |= uint64_t(((255 - k) >> i) & 0x01) << k;
+        }
+    }
+
+    Var c(8), d(8), lanes_total(8);
+    Wire smaller;
+    lanes_circuit.add_input_lanes(c, a_lanes);
+    lanes_circuit.add_input_lanes(d, b_lanes);
+    lanes_circuit.add_output(lanes_total);
+    lanes_circuit.add_output(smaller);
+    lanes_circuit.start();
+
+    lanes_circuit.sum(c, d, lanes_total);
+    lanes_circuit.smaller_u(c, d, smaller);
+
+    for (uint64_t k = 0; k < 64; k++) {
+        REQUIRE(lanes_circuit.value(lanes_total, k) == ((k * 3 + 255 - k) & 0xFF));
+        REQUIRE(lanes_circuit.value(smaller, k) == (k * 3 < 255 - k));
+    }
+    REQUIRE(lanes_circuit.lanes(c) == a_lanes);
+    // > !SECTION - Test 2: Evaluation lanes.
+
+    // -------------------
+    // > SECTION - Test 3: Shadow evaluation disabled.
+    // -------------------
+    // Without the shadow evaluation, the values cannot be given nor read.
+    CircuitGeneratorTester disabled_circuit("Shadow_Evaluation_Disabled", "circuits/tests");
+    disabled_circuit.add_input_party(8);
+
+    Var e(8);
+    REQUIRE_THROWS_AS(disabled_circuit.add_input(e, 0x01), std::runtime_error);
+    REQUIRE_THROWS_AS(disabled_circuit.value(e), std::runtime_error);
+    REQUIRE_THROWS_AS(circuit.value(Var(65)), std::runtime_error);
+    // > !SECTION - Test 3: Shadow evaluation disabled.
+
+    // -------------------
+    // > SECTION - Test 4: Arithmetic operations.
+    // -------------------
+    // The arithmetic operations should be correct for all the 4 bits inputs, including when the output of a sum is also one
+    // of its inputs (used by the multiplications and divisions).
+    for (int64_t x = 0; x < 16; x++) {
+        for (int64_t y = 1; y < 16; y++) {
+            CircuitGeneratorTester arithmetic("Shadow_Evaluation_Arithmetic", "circuits/tests");
+            arithmetic._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+            arithmetic.shadow(true);
+            arithmetic.add_input_party(8);
+            arithmetic.add_output_party(4);
+
+            Var f(4), g(4), accumulator(4);
+            arithmetic.add_input(f, x);
+            arithmetic.add_input(g, y);
+            arithmetic.add_output(accumulator);
+            arithmetic.start();
+
+            Var product_u(8), product_s(8), quotient_u(4), remainder_u(4), quotient_s(4), remainder_s(4);
+            arithmetic.multiply_u(f, g, product_u);
+            arithmetic.multiply_s(f, g, product_s);
+            arithmetic.divide_u(f, g, quotient_u, remainder_u);
+            arithmetic.divide_s(f, g, quotient_s, remainder_s);
+            arithmetic.sum(f, g, accumulator);
+            arithmetic.sum(accumulator, f, accumulator);
+
+            const int64_t signed_x = x < 8 ? x : x - 16;
+            const int64_t signed_y = y < 8 ? y : y - 16;
+            REQUIRE(arithmetic.value(product_u) == x * y);
+            REQUIRE(arithmetic.value(product_s) == ((signed_x * signed_y) & 0xFF));
+            REQUIRE(arithmetic.value(quotient_u) == x / y);
+            REQUIRE(arithmetic.value(remainder_u) == x % y);
+            REQUIRE(arithmetic.value(quotient_s) == ((signed_x / signed_y) & 0x0F));
+            REQUIRE(arithmetic.value(accumulator) == ((2 * x + y) & 0x0F));
+        }
+    }
+    // > !SECTION - Test 4: Arithmetic operations.
+    // > !SECTION - Test suit "Shadow Evaluation"
+}
+
+TEST_CASE("Comparison Operations") {
+    // > SECTION - Test suit "Comparison Operations"
+    //
+    // This test suit aims to test the comparison operations, built as chains and as log depth trees.
+    //
+    // Note: The constructor of CircuitGenerator does not have a public visibility, thus an instance cannot be created.
+    // For the sake of the tests, the tester class makes it accessible.
+    //
+    // Test suit index:
+    // > Test 1: All the 1 to 4 bits inputs
+    // > Test 2: AND gates costs
+
+    // -------------------
+    // > SECTION - Test 1: All the 1 to 4 bits inputs.
+    // -------------------
+    // Every comparison should be correct for all the pairs of inputs, which are evaluated in the lanes of the shadow
+    // evaluation.
+    for (uint64_t size = 1; size <= 4; size++) {
+        const uint64_t n_pairs = 1 << (2 * size);
+
+        for (bool log_depth : {false, true}) {
+            for (uint64_t first = 0; first < n_pairs; first += 64) {
+                CircuitGeneratorTester circuit("Comparison_Operations", "circuits/tests");
+                circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+                circuit.shadow(true);
+                circuit.log_depth_comparators(log_depth);
+                circuit.add_input_party(2 * size);
+                circuit.add_output_party(1);
+
+                // The lane k has the pair first + k
+                std::vector<uint64_t> a_lanes(size), b_lanes(size);
+                for (uint64_t k = 0; k < 64 && first + k < n_pairs; k++) {
+                    for (uint64_t i = 0; i < size; i++) {
+                        a_lanes[i] |= uint64_t(((first + k) >> i) & 0x01) << k;
+                        b_lanes[i] |= uint64_t(((first + k) >> (size + i)) & 0x01) << k;
+                    }
+                }
+
+                Var a(size), b(size);
+                Wire output;
+                circuit.add_input_lanes(a, a_lanes);
+                circuit.add_input_lanes(b, b_lanes);
+                circuit.add_output(output);
+                circuit.start();
+
+                Wire equal, greater_u, greater_s, smaller_u, smaller_s;
+                Wire greater_or_equal_u, greater_or_equal_s, smaller_or_equal_u, smaller_or_equal_s;
+                Wire comparator_u[3], comparator_s[3];
+                circuit.equal(a, b, equal);
+                circuit.greater_u(a, b, greater_u);
+                circuit.greater_s(a, b, greater_s);
+                circuit.smaller_u(a, b, smaller_u);
+                circuit.smaller_s(a, b, smaller_s);
+                circuit.greater_or_equal_u(a, b, greater_or_equal_u);
+                circuit.greater_or_equal_s(a, b, greater_or_equal_s);
+                circuit.smaller_or_equal_u(a, b, smaller_or_equal_u);
+                circuit.smaller_or_equal_s(a, b, smaller_or_equal_s);
+                circuit.comparator_u(a, b, comparator_u[0], comparator_u[1], comparator_u[2]);
+                circuit.comparator_s(a, b, comparator_s[0], comparator_s[1], comparator_s[2]);
+
+                for (uint64_t k = 0; k < 64 && first + k < n_pairs; k++) {
+                    const int64_t x = (first + k) & ((1 << size) - 1);
+                    const int64_t y = (first + k) >> size;
+                    const int64_t signed_x = x < (1 << (size - 1)) ? x : x - (1 << size);
+                    const int64_t signed_y = y < (1 << (size - 1)) ? y : y - (1 << size);
+
+                    REQUIRE(circuit.value(equal, k) == (x == y));
+                    REQUIRE(circuit.value(greater_u, k) == (x > y));
+                    REQUIRE(circuit.value(greater_s, k) == (signed_x > signed_y));
+                    REQUIRE(circuit.value(smaller_u, k) == (x < y));
+                    REQUIRE(circuit.value(smaller_s, k) == (signed_x < signed_y));
+                    REQUIRE(circuit.value(greater_or_equal_u, k) == (x >= y));
+                    REQUIRE(circuit.value(greater_or_equal_s, k) == (signed_x >= signed_y));
+                    REQUIRE(circuit.value(smaller_or_equal_u, k) == (x <= y));
+                    REQUIRE(circuit.value(smaller_or_equal_s, k) == (signed_x <= signed_y));
+                    REQUIRE(circuit.value(comparator_u[0], k) == (x == y));
+                    REQUIRE(circuit.value(comparator_u[1], k) == (x > y));
+                    REQUIRE(circuit.value(comparator_u[2], k) == (x < y));
+                    REQUIRE(circuit.value(comparator_s[0], k) == (x == y));
+                    REQUIRE(circuit.value(comparator_s[1], k) == (signed_x > signed_y));
+                    REQUIRE(circuit.value(comparator_s[2], k) == (signed_x < signed_y));
+                }
+            }
+        }
+    }
+    // > !SECTION - Test 1: All the 1 to 4 bits inputs.
+
+    // -------------------
+    // > SECTION - Test 2: AND gates costs.
+    // -------------------
+    // The chained comparisons should cost a single AND gate per bit, and the comparators one more AND gate per bit (but the
+    // first one) for the equal output. The trees should cost more AND gates for a smaller AND depth.
+    auto costs = [](bool log_depth, auto operation) {
+        CircuitGeneratorTester circuit("Comparison_Operations_Costs", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.track_depth(true);
+        circuit.log_depth_comparators(log_depth);
+        circuit.add_input_party(128);
+        circuit.add_output_party(1);
+
+        Var a(64), b(64);
+        Wire output;
+        circuit.add_input(a);
+        circuit.add_input(b);
+        circuit.add_output(output);
+        circuit.start();
+
+        const uint64_t and_gates = circuit._gates_counters["AND"] + circuit._gates_counters["OR"];
+        operation(circuit, a, b, output);
+        return std::make_pair(circuit._gates_counters["AND"] + circuit._gates_counters["OR"] - and_gates, circuit.depth(output).and_depth);
+    };
+
+    auto smaller = [](CircuitGenerator& circuit, const Var& a, const Var& b, Wire& out) { circuit.smaller_s(a, b, out); };
+    auto comparator = [](CircuitGenerator& circuit, const Var& a, const Var& b, Wire& out) { Wire e, s; circuit.comparator_u(a, b, e, out, s); };
+
+    REQUIRE(costs(false, smaller).first == 64);
+    REQUIRE(costs(false, comparator).first == 127);
+    REQUIRE(costs(true, smaller).first > 64);
+    REQUIRE(costs(true, smaller).second <= 2 * 6 + 1);
+    REQUIRE(costs(true, comparator).second <= 2 * 6 + 1);
+    // > !SECTION - Test 2: AND gates costs.
+    // > !SECTION - Test suit "Comparison Operations"
+}
+
+TEST_CASE("Mixed Size Operations") {
+    // > SECTION - Test suit "Mixed Size Operations"
+    //
+    // This test suit aims to test the arithmetic and comparison operations between variables of different sizes.
+    //
+    // Note: The constructor of CircuitGenerator does not have a public visibility, thus an instance cannot be created.
+    // For the sake of the tests, the tester class makes it accessible.
+    //
+    // Test suit index:
+    // > Test 1: All the 1 to 4 bits inputs
+    // > Test 2: Extension gates
+
+    // -------------------
+    // > SECTION - Test 1: All the 1 to 4 bits inputs.
+    // -------------------
+    // Every operation should be correct for all the pairs of inputs and for narrower, equal and wider outputs, which are
+    // evaluated in the lanes of the shadow evaluation.
+    for (uint64_t size_a = 1; size_a <= 4; size_a++) {
+        for (uint64_t size_b = 1; size_b <= 4; size_b++) {
+            const uint64_t n_pairs = 1 << (size_a + size_b);
+            const std::vector<uint64_t> out_sizes = { 1, std::max(size_a, size_b), size_a + size_b + 1 };
+
+            for (uint64_t first = 0; first < n_pairs; first += 64) {
+                CircuitGeneratorTester circuit("Mixed_Size_Operations", "circuits/tests");
+                circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+                circuit.shadow(true);
+                circuit.add_input_party(size_a + size_b);
+                circuit.add_output_party(1);
+
+                // The lane k has the pair first + k
+                std::vector<uint64_t> a_lanes(size_a), b_lanes(size_b);
+                for (uint64_t k = 0; k < 64 && first + k < n_pairs; k++) {
+                    for (uint64_t i = 0; i < size_a; i++) {
+                        a_lanes[i] |= uint64_t(((first + k) >> i) & 0x01) << k;
+                    }
+                    for (uint64_t i = 0; i < size_b; i++) {
+                        b_lanes[i] |= uint64_t(((first + k) >> (size_a + i)) & 0x01) << k;
+                    }
+                }
+
+                Var a(size_a), b(size_b);
+                Wire output;
+                circuit.add_input_lanes(a, a_lanes);
+                circuit.add_input_lanes(b, b_lanes);
+                circuit.add_output(output);
+                circuit.start();
+
+                // Comparisons
+                Wire equal, greater_u, smaller_s, comparator_s[3];
+                circuit.equal(a, b, equal);
+                circuit.greater_u(a, b, greater_u);
+                circuit.smaller_s(a, b, smaller_s);
+                circuit.comparator_s(a, b, comparator_s[0], comparator_s[1], comparator_s[2]);
+
+                // Arithmetic operations with every output size
+                std::vector<std::vector<Var>> results;
+                for (auto size : out_sizes) {
+                    results.push_back(std::vector<Var>(11, Var(size)));
+                    std::vector<Var>& r = results.back();
+                    circuit.sum(a, b, r[0]);
+                    circuit.sum_s(a, b, r[1]);
+                    circuit.subtract(a, b, r[2]);
+                    circuit.subtract_s(a, b, r[3]);
+                    circuit.multiply_u(a, b, r[4]);
+                    circuit.multiply_s(a, b, r[5]);
+                    circuit.divide_u(a, b, r[6], r[7]);
+                    circuit.divide_u_quotient(a, b, r[8]);
+                    circuit.divide_u_remainder(a, b, r[9]);
+                    circuit.divide_s_quotient(a, b, r[10]);
+                }
+
+                for (uint64_t k = 0; k < 64 && first + k < n_pairs; k++) {
+                    const int64_t x = (first + k) & ((1 << size_a) - 1);
+                    const int64_t y = (first + k) >> size_a;
+                    const int64_t signed_x = x < (1 << (size_a - 1)) ? x : x - (1 << size_a);
+                    const int64_t signed_y = y < (1 << (size_b - 1)) ? y : y - (1 << size_b);
+
+                    REQUIRE(circuit.value(equal, k) == (x == y));
+                    REQUIRE(circuit.value(greater_u, k) == (x > y));
+                    REQUIRE(circuit.value(smaller_s, k) == (signed_x < signed_y));
+                    REQUIRE(circuit.value(comparator_s[0], k) == (signed_x == signed_y));
+                    REQUIRE(circuit.value(comparator_s[1], k) == (signed_x > signed_y));
+                    REQUIRE(circuit.value(comparator_s[2], k) == (signed_x < signed_y));
+
+                    for (uint64_t i = 0; i < out_sizes.size(); i++) {
+                        const uint64_t mask = (1 << out_sizes[i]) - 1;
+                        std::vector<Var>& r = results[i];
+
+                        REQUIRE(circuit.value(r[0], k) == ((x + y) & mask));
+                        REQUIRE(circuit.value(r[1], k) == ((signed_x + signed_y) & mask));
+                        REQUIRE(circuit.value(r[2], k) == ((x - y) & mask));
+                        REQUIRE(circuit.value(r[3], k) == ((signed_x - signed_y) & mask));
+                        REQUIRE(circuit.value(r[4], k) == ((x * y) & mask));
+                        REQUIRE(circuit.value(r[5], k) == ((signed_x * signed_y) & mask));
+
+                        // Divisions by zero are not defined
+                        if (y == 0) continue;
+
+                        REQUIRE(circuit.value(r[6], k) == ((x / y) & mask));
+                        REQUIRE(circuit.value(r[7], k) == ((x % y) & mask));
+                        REQUIRE(circuit.value(r[8], k) == ((x / y) & mask));
+                        REQUIRE(circuit.value(r[9], k) == ((x % y) & mask));
+                        REQUIRE(circuit.value(r[10], k) == ((signed_x / signed_y) & mask));
+                    }
+                }
+            }
+        }
+    }
+    // > !SECTION - Test 1: All the 1 to 4 bits inputs.
+
+    // -------------------
+    // > SECTION - Test 2: Extension gates.
+    // -------------------
+    // The operations with a narrow variable should not create gates for its extension wires, thus they should cost less
+    // than the same operations with two variables of the output size. Variables padded with the zero wire cost at least as much.
+    auto costs = [](uint64_t size_b, bool padded, auto operation) {
+        CircuitGeneratorTester circuit("Mixed_Size_Operations_Costs", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.add_input_party(64 + size_b);
+        circuit.add_output_party(64);
+
+        Var a(64), b(size_b), out(64);
+        circuit.add_input(a);
+        circuit.add_input(b);
+        circuit.add_output(out);
+        circuit.start();
+
+        Var padded_b(64);
+        for (uint64_t i = 0; i < 64; i++) {
+            padded_b[i] = i < size_b ? b[i] : circuit._zero_wire;
+        }
+
+        const uint64_t gates = circuit._counter_gates;
+        operation(circuit, a, padded ? padded_b : b, out);
+        return circuit._counter_gates - gates;
+    };
+
+    auto sum = [](CircuitGenerator& circuit, const Var& a, const Var& b, Var& out) { circuit.sum(a, b, out); };
+    auto multiply = [](CircuitGenerator& circuit, const Var& a, const Var& b, Var& out) { circuit.multiply_u(a, b, out); };
+    auto divide = [](CircuitGenerator& circuit, const Var& a, const Var& b, Var& out) { circuit.divide_u_quotient(a, b, out); };
+    auto greater = [](CircuitGenerator& circuit, const Var& a, const Var& b, Var& out) { circuit.greater_u(b, a, out[0]); };
+
+    // > The mixed sum has the full adders of the 8 bits, and then only the half adders of the carry
+    // > Without OR gates, the OR of each full adder is emulated with 4 gates
+    const uint64_t or_cost = BCGEN_OR_GATES == 1 ? 1 : 4;
+    REQUIRE(costs(8, false, sum) <= (4 + or_cost) * 8 + 2 * 56);
+    for (auto operation : std::vector<std::function<void(CircuitGenerator&, const Var&, const Var&, Var&)>>{ sum, multiply, divide, greater }) {
+        REQUIRE(costs(8, false, operation) < costs(64, false, operation));
+        REQUIRE(costs(8, false, operation) <= costs(8, true, operation));
+    }
+    // > !SECTION - Test 2: Extension gates.
+    // > !SECTION - Test suit "Mixed Size Operations"
+}
+
+TEST_CASE("Multi-Operand Operations") {
+    // > SECTION - Test suit "Multi-Operand Operations"
+    //
+    // This test suit aims to test the addition of many variables and the inner product operations of the Circuit Generator
+    // class.
+    //
+    // Note: The constructor of CircuitGenerator does not have a public visibility, thus an instance cannot be created.
+    // For the sake of the tests, the tester class makes it accessible.
+    //
+    // Test suit index:
+    // > Test 1: Random inputs of several sizes
+    // > Test 2: Gates and depth of the operations
+    // > Test 3: Vectors with different number of variables
+
+    // -------------------
+    // > SECTION - Test 1: Random inputs of several sizes.
+    // -------------------
+    // The operations should be correct for any number of variables, variables of different sizes and narrower or wider
+    // outputs, which are evaluated in the lanes of the shadow evaluation.
+    std::mt19937_64 random(0xBC6E);
+    auto signed_value = [](uint64_t value, uint64_t size) {
+        return size < 64 && (value >> (size - 1)) & 0x01 ? int64_t(value - (uint64_t(1) << size)) : int64_t(value);
+    };
+
+    for (uint64_t n_variables : { 0, 1, 2, 3, 7, 16 }) {
+        CircuitGeneratorTester circuit("Multi_Operand_Operations", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.shadow(true);
+
+        // Variables with sizes from 1 to 9 bits
+        std::vector<Var> in_a, in_b;
+        uint64_t n_wires = 0;
+        for (uint64_t i = 0; i < n_variables; i++) {
+            in_a.emplace_back(1 + (i * 5) % 9);
+            in_b.emplace_back(1 + (i * 7 + 3) % 9);
+            n_wires += in_a.back().size() + in_b.back().size();
+        }
+
+        // > The circuit needs an input wire even without input variables
+        circuit.add_input_party(n_wires + 1);
+        circuit.add_output_party(1);
+
+        Var unused(1);
+        circuit.add_input_lanes(unused, { 0 });
+        for (uint64_t i = 0; i < n_variables; i++) {
+            std::vector<uint64_t> lanes_a(in_a[i].size()), lanes_b(in_b[i].size());
+            for (auto & lane : lanes_a) lane = random();
+            for (auto & lane : lanes_b) lane = random();
+            circuit.add_input_lanes(in_a[i], lanes_a);
+            circuit.add_input_lanes(in_b[i], lanes_b);
+        }
+
+        Wire output;
+        circuit.add_output(output);
+        circuit.start();
+
+        for (uint64_t out_size : { 4, 12, 24 }) {
+            Var sum(out_size), sum_s(out_size), product_u(out_size), product_s(out_size);
+            circuit.sum_many(in_a, sum);
+            circuit.sum_many_s(in_a, sum_s);
+            circuit.inner_product_u(in_a, in_b, product_u);
+            circuit.inner_product_s(in_a, in_b, product_s);
+
+            const uint64_t mask = (uint64_t(1) << out_size) - 1;
+            for (uint64_t lane = 0; lane < 64; lane++) {
+                uint64_t expected_sum = 0, expected_sum_s = 0, expected_product_u = 0, expected_product_s = 0;
+                for (uint64_t i = 0; i < n_variables; i++) {
+                    const uint64_t a = circuit.value(in_a[i], lane);
+                    const uint64_t b = circuit.value(in_b[i], lane);
+                    expected_sum += a;
+                    expected_sum_s += signed_value(a, in_a[i].size());
+                    expected_product_u += a * b;
+                    expected_product_s += signed_value(a, in_a[i].size()) * signed_value(b, in_b[i].size());
+                }
+
+                REQUIRE(circuit.value(sum, lane) == (expected_sum & mask));
+                REQUIRE(circuit.value(sum_s, lane) == (expected_sum_s & mask));
+                REQUIRE(circuit.value(product_u, lane) == (expected_product_u & mask));
+                REQUIRE(circuit.value(product_s, lane) == (expected_product_s & mask));
+            }
+        }
+    }
+    // > !SECTION - Test 1: Random inputs of several sizes.
+
+    // -------------------
+    // > SECTION - Test 2: Gates and depth of the operations.
+    // -------------------
+    // The compressor tree should have less AND gates than chained additions, which propagate the carries of every addition,
+    // and its AND depth should be the one of the final adder plus a few stages
+    auto costs = [](bool chained) {
+        CircuitGeneratorTester circuit("Multi_Operand_Operations_Costs", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.track_depth(true);
+        circuit.add_input_party(16 * 32);
+        circuit.add_output_party(36);
+
+        std::vector<Var> in(16, Var(32));
+        Var out(36);
+        for (auto & variable : in) {
+            circuit.add_input(variable);
+        }
+        circuit.add_output(out);
+        circuit.start();
+
+        if (chained) {
+            for (auto & wire : out) {
+                wire = circuit._zero_wire;
+            }
+            for (auto & variable : in) {
+                circuit.sum(out, variable, out);
+            }
+        } else {
+            circuit.sum_many(in, out);
+        }
+
+        uint64_t and_depth = 0;
+        for (auto & wire : out) {
+            and_depth = std::max(and_depth, circuit.depth(wire).and_depth);
+        }
+
+        return std::make_pair(circuit._gates_counters["AND"] + circuit._gates_counters["OR"], and_depth);
+    };
+
+    const auto chained = costs(true);
+    const auto compressed = costs(false);
+    REQUIRE(compressed.first < chained.first);
+    REQUIRE(compressed.first < chained.first / 2);
+    REQUIRE(compressed.second <= chained.second);
+    // > Without OR gates, the OR of each carry is emulated with an AND, which doubles the AND depth of the carry chain
+    const uint64_t carry_and_depth = BCGEN_OR_GATES == 1 ? 1 : 2;
+    REQUIRE(compressed.second <= carry_and_depth * (36 + 6));
+    // > !SECTION - Test 2: Gates and depth of the operations.
+
+    // -------------------
+    // > SECTION - Test 3: Vectors with different number of variables.
+    // -------------------
+    {
+        CircuitGeneratorTester circuit("Multi_Operand_Operations_Errors", "circuits/tests");
+        circuit.add_input_party(24);
+        circuit.add_output_party(8);
+
+        Var a(8), b(8), c(8), out(8);
+        circuit.add_input(a);
+        circuit.add_input(b);
+        circuit.add_input(c);
+        circuit.add_output(out);
+        circuit.start();
+
+        REQUIRE_THROWS_AS(circuit.inner_product_u({ a, b }, { c }, out), std::runtime_error);
+        REQUIRE_THROWS_AS(circuit.inner_product_s({ a }, { b, c }, out), std::runtime_error);
+    }
+    // > !SECTION - Test 3: Vectors with different number of variables.
+    // > !SECTION - Test suit "Multi-Operand Operations"
+}
+
+TEST_CASE("Population Count Operations") {
+    // > SECTION - Test suit "Population Count Operations"
+    //
+    // This test suit aims to test the population count and Hamming distance operations of the Circuit Generator class.
+    //
+    // Note: The constructor of CircuitGenerator does not have a public visibility, thus an instance cannot be created.
+    // For the sake of the tests, the tester class makes it accessible.
+    //
+    // Test suit index:
+    // > Test 1: Random inputs of several sizes
+    // > Test 2: Gates and depth of the operations
+
+    // -------------------
+    // > SECTION - Test 1: Random inputs of several sizes.
+    // -------------------
+    // The operations should be correct for variables of any size (also different ones) and for narrower or wider outputs,
+    // which are evaluated in the lanes of the shadow evaluation.
+    std::mt19937_64 random(0xBC6E);
+
+    for (uint64_t size : { 1, 2, 3, 5, 8, 13, 31, 64 }) {
+        CircuitGeneratorTester circuit("Population_Count_Operations", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.shadow(true);
+
+        const uint64_t size_b = (size + 1) / 2;
+        circuit.add_input_party(size + size_b);
+        circuit.add_output_party(1);
+
+        Var a(size), b(size_b);
+        std::vector<uint64_t> lanes_a(size), lanes_b(size_b);
+        for (auto & lane : lanes_a) lane = random();
+        for (auto & lane : lanes_b) lane = random();
+        circuit.add_input_lanes(a, lanes_a);
+        circuit.add_input_lanes(b, lanes_b);
+
+        Wire output;
+        circuit.add_output(output);
+        circuit.start();
+
+        for (uint64_t out_size : { 2, 7, 10 }) {
+            Var count(out_size), distance(out_size), distance_r(out_size);
+            circuit.popcount(a, count);
+            circuit.hamming_distance(a, b, distance);
+            circuit.hamming_distance(b, a, distance_r);
+
+            const uint64_t mask = (uint64_t(1) << out_size) - 1;
+            for (uint64_t lane = 0; lane < 64; lane++) {
+                uint64_t expected_count = 0, expected_distance = 0;
+                for (uint64_t i = 0; i < size; i++) {
+                    const bool bit_a = (lanes_a[i] >> lane) & 0x01;
+                    const bool bit_b = i < size_b && (lanes_b[i] >> lane) & 0x01;
+                    expected_count += bit_a;
+                    expected_distance += bit_a != bit_b;
+                }
+
+                REQUIRE(circuit.value(count, lane) == (expected_count & mask));
+                REQUIRE(circuit.value(distance, lane) == (expected_distance & mask));
+                REQUIRE(circuit.value(distance_r, lane) == (expected_distance & mask));
+            }
+        }
+    }
+    // > !SECTION - Test 1: Random inputs of several sizes.
+
+    // -------------------
+    // > SECTION - Test 2: Gates and depth of the operations.
+    // -------------------
+    // The count of N wires should have at most N non XOR gates, and a logarithmic AND depth
+    for (uint64_t size : { 64, 256, 1024 }) {
+        CircuitGeneratorTester circuit("Population_Count_Operations_Costs", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.track_depth(true);
+        circuit.add_input_party(size);
+        circuit.add_output_party(11);
+
+        Var a(size), count(11);
+        circuit.add_input(a);
+        circuit.add_output(count);
+        circuit.start();
+
+        circuit.popcount(a, count);
+
+        uint64_t and_depth = 0;
+        for (auto & wire : count) {
+            and_depth = std::max(and_depth, circuit.depth(wire).and_depth);
+        }
+
+        REQUIRE(circuit._gates_counters["AND"] + circuit._gates_counters["OR"] <= size);
+        REQUIRE(and_depth <= 3 * 11);
+    }
+    // > !SECTION - Test 2: Gates and depth of the operations.
+    // > !SECTION - Test suit "Population Count Operations"
+}
+
+TEST_CASE("Leading Zeros Operations") {
+    // > SECTION - Test suit "Leading Zeros Operations"
+    //
+    // This test suit aims to test the priority encoder, leading and trailing zeros counts and logarithm operations of the
+    // Circuit Generator class.
+    //
+    // Note: The constructor of CircuitGenerator does not have a public visibility, thus an instance cannot be created.
+    // For the sake of the tests, the tester class makes it accessible.
+    //
+    // Test suit index:
+    // > Test 1: All the 1 to 6 bits inputs, and random inputs of 32, 64 and 128 bits
+    // > Test 2: Gates and depth of the operations
+
+    // -------------------
+    // > SECTION - Test 1: All the 1 to 6 bits inputs, and random inputs of 32, 64 and 128 bits.
+    // -------------------
+    // The operations should be correct for all the positions of the most and least significant wires that are one, and for
+    // zero variables, which are evaluated in the lanes of the shadow evaluation.
+    std::mt19937_64 random(0xBC6E);
+
+    for (uint64_t size : { 1, 2, 3, 4, 5, 6, 32, 64, 128 }) {
+        CircuitGeneratorTester circuit("Leading_Zeros_Operations", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.shadow(true);
+        circuit.add_input_party(size);
+        circuit.add_output_party(1);
+
+        // The lanes have all the values of the small variables, and random values with random zero wires around them for the
+        // big ones (the first lane is zero)
+        std::vector<uint64_t> lanes(size);
+        for (uint64_t lane = 1; lane < 64; lane++) {
+            const uint64_t high = random() % size;
+            const uint64_t low = random() % (high + 1);
+            for (uint64_t i = 0; i < size; i++) {
+                const bool bit = size <= 6 ? (lane >> i) & 0x01 : i == high || i == low || (i > low && i < high && random() & 0x01);
+                lanes[i] |= uint64_t(bit) << lane;
+            }
+        }
+
+        Var a(size);
+        circuit.add_input_lanes(a, lanes);
+
+        Wire output;
+        circuit.add_output(output);
+        circuit.start();
+
+        Var one_hot(size), leading(9), trailing(9), logarithm(9), narrow(2);
+        circuit.priority_encoder(a, one_hot);
+        circuit.clz(a, leading);
+        circuit.ctz(a, trailing);
+        circuit.ilog2(a, logarithm);
+        circuit.clz(a, narrow);
+
+        for (uint64_t lane = 0; lane < 64 && (size > 6 || lane < (uint64_t(1) << size)); lane++) {
+            int64_t msb = -1, lsb = -1;
+            for (uint64_t i = 0; i < size; i++) {
+                if ((lanes[i] >> lane) & 0x01) {
+                    msb = i;
+                    if (lsb < 0) lsb = i;
+                }
+            }
+
+            for (uint64_t i = 0; i < size; i++) {
+                REQUIRE(circuit.value(one_hot[i], lane) == (int64_t(i) == msb));
+            }
+            REQUIRE(circuit.value(leading, lane) == size - 1 - msb);
+            REQUIRE(circuit.value(trailing, lane) == (lsb < 0 ? size : lsb));
+            REQUIRE(circuit.value(logarithm, lane) == (msb < 0 ? 0 : msb));
+            REQUIRE(circuit.value(narrow, lane) == ((size - 1 - msb) & 0x03));
+        }
+    }
+    // > !SECTION - Test 1: All the 1 to 6 bits inputs, and random inputs of 32, 64 and 128 bits.
+
+    // -------------------
+    // > SECTION - Test 2: Gates and depth of the operations.
+    // -------------------
+    // The operations only have the OR gates of the prefix tree, about 2N for N wires, with a logarithmic depth
+    const std::vector<std::pair<uint64_t, uint64_t>> expected = { { 32, 57 }, { 64, 120 }, { 128, 247 } };
+    for (auto & [size, or_gates] : expected) {
+        CircuitGeneratorTester circuit("Leading_Zeros_Operations_Costs", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.track_depth(true);
+        circuit.add_input_party(size);
+        circuit.add_output_party(8);
+
+        Var a(size), count(8);
+        circuit.add_input(a);
+        circuit.add_output(count);
+        circuit.start();
+
+        circuit.clz(a, count);
+
+        uint64_t depth = 0;
+        for (auto & wire : count) {
+            depth = std::max(depth, circuit.depth(wire).depth);
+        }
+
+#if BCGEN_OR_GATES == 1
+        REQUIRE(circuit._gates_counters["AND"] == 0);
+        REQUIRE(circuit._gates_counters["OR"] == or_gates);
+#else
+        // > Without OR gates, each OR is emulated with an AND
+        REQUIRE(circuit._gates_counters["AND"] == or_gates);
+        REQUIRE(circuit._gates_counters["OR"] == 0);
+#endif
+        // > The emulated OR is 3 gates deep
+        const uint64_t or_depth = BCGEN_OR_GATES == 1 ? 1 : 3;
+        REQUIRE(depth <= 3 * or_depth * std::bit_width(size));
+    }
+    // > !SECTION - Test 2: Gates and depth of the operations.
+    // > !SECTION - Test suit "Leading Zeros Operations"
+}
+
+TEST_CASE("Sorting Operations") {
+    // > SECTION - Test suit "Sorting Operations"
+    //
+    // This test suit aims to test the sorting networks and the sorting operations of the Circuit Generator class.
+    //
+    // Note: The constructor of CircuitGenerator does not have a public visibility, thus an instance cannot be created.
+    // For the sake of the tests, the tester class makes it accessible.
+    //
+    // Test suit index:
+    // > Test 1: Sorting networks
+    // > Test 2: Sorting variables with payloads
+    // > Test 3: Conditional swap
+    // > Test 4: Invalid sizes
+
+    const std::vector<gabe::bcgen::SortingNetwork> networks = {
+        gabe::bcgen::SortingNetwork::OddEvenMerge, gabe::bcgen::SortingNetwork::Bitonic
+    };
+
+    // -------------------
+    // > SECTION - Test 1: Sorting networks.
+    // -------------------
+    // A network sorts every input if it sorts every input of zeros and ones (0-1 principle), and the comparators and depth of
+    // the networks for powers of 2 are known
+    auto depth = [](const std::vector<gabe::bcgen::Comparator>& comparators, uint64_t size) {
+        std::vector<uint64_t> levels(size, 0);
+        uint64_t result = 0;
+        for (auto & comparator : comparators) {
+            const uint64_t level = std::max(levels[comparator.low], levels[comparator.high]) + 1;
+            levels[comparator.low] = levels[comparator.high] = level;
+            result = std::max(result, level);
+        }
+        return result;
+    };
+
+    for (auto network : networks) {
+        for (uint64_t size = 0; size <= 16; size++) {
+            const auto comparators = CircuitGenerator::sorting_network(size, network);
+            bool sorted = true;
+            for (uint64_t input = 0; input < (uint64_t(1) << size); input++) {
+                uint64_t values = input;
+                for (auto & comparator : comparators) {
+                    const uint64_t low = (values >> comparator.low) & 0x01;
+                    const uint64_t high = (values >> comparator.high) & 0x01;
+                    values ^= (low > high) * ((uint64_t(1) << comparator.low) | (uint64_t(1) << comparator.high));
+                }
+
+                // The sorted input has all the zeros before the ones
+                const uint64_t zeros = ~values & ((uint64_t(1) << size) - 1);
+                sorted = sorted && ((zeros + 1) & zeros) == 0;
+            }
+            REQUIRE(sorted);
+        }
+    }
+
+    REQUIRE(CircuitGenerator::sorting_network(8, networks[0]).size() == 19);
+    REQUIRE(CircuitGenerator::sorting_network(8, networks[1]).size() == 24);
+    REQUIRE(CircuitGenerator::sorting_network(16, networks[0]).size() == 63);
+    REQUIRE(CircuitGenerator::sorting_network(16, networks[1]).size() == 80);
+    REQUIRE(depth(CircuitGenerator::sorting_network(8, networks[0]), 8) == 6);
+    REQUIRE(depth(CircuitGenerator::sorting_network(8, networks[1]), 8) == 6);
+    REQUIRE(depth(CircuitGenerator::sorting_network(16, networks[0]), 16) == 10);
+    REQUIRE(depth(CircuitGenerator::sorting_network(16, networks[1]), 16) == 10);
+    // > !SECTION - Test 1: Sorting networks.
+
+    // -------------------
+    // > SECTION - Test 2: Sorting variables with payloads.
+    // -------------------
+    // The variables should be sorted, and each payload should still be the payload of its variable, which are evaluated in
+    // the lanes of the shadow evaluation
+    std::mt19937_64 random(0xBC6E);
+
+    for (auto network : networks) {
+        for (bool ascending : { true, false }) {
+            for (uint64_t size : { 1, 2, 3, 5, 8, 13 }) {
+                CircuitGeneratorTester circuit("Sorting_Operations", "circuits/tests");
+                circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+                circuit.shadow(true);
+                circuit.add_input_party(size * 5);
+                circuit.add_output_party(1);
+
+                // Keys of 5 bits, which have repeated values, and payloads with the original position of each key
+                std::vector<Var> keys(size, Var(5)), payloads(size, Var(4));
+                for (uint64_t i = 0; i < size; i++) {
+                    std::vector<uint64_t> lanes(5);
+                    for (auto & lane : lanes) lane = random();
+                    circuit.add_input_lanes(keys[i], lanes);
+                }
+
+                Wire output;
+                circuit.add_output(output);
+                circuit.start();
+
+                for (uint64_t i = 0; i < size; i++) {
+                    circuit.assign_value(payloads[i], i);
+                }
+
+                std::vector<std::vector<uint64_t>> values(64);
+                for (uint64_t lane = 0; lane < 64; lane++) {
+                    for (auto & key : keys) {
+                        values[lane].push_back(circuit.value(key, lane));
+                    }
+                }
+
+                std::vector<Var> sorted = keys;
+                circuit.sort(sorted, payloads, ascending, network);
+
+                for (uint64_t lane = 0; lane < 64; lane++) {
+                    std::vector<uint64_t> expected = values[lane];
+                    std::sort(expected.begin(), expected.end());
+                    if (!ascending) std::reverse(expected.begin(), expected.end());
+
+                    for (uint64_t i = 0; i < size; i++) {
+                        REQUIRE(circuit.value(sorted[i], lane) == expected[i]);
+                        REQUIRE(values[lane][circuit.value(payloads[i], lane)] == expected[i]);
+                    }
+                }
+            }
+        }
+    }
+    // > !SECTION - Test 2: Sorting variables with payloads.
+
+    // -------------------
+    // > SECTION - Test 3: Conditional swap.
+    // -------------------
+    // The swap should only have an AND gate per bit, and the sort a comparison and a swap per comparator
+    {
+        CircuitGeneratorTester circuit("Sorting_Operations_Costs", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.add_input_party(8 * 16 + 1);
+        circuit.add_output_party(1);
+
+        std::vector<Var> keys(8, Var(16));
+        Wire control;
+        for (auto & key : keys) {
+            circuit.add_input(key);
+        }
+        circuit.add_input(control);
+        circuit.add_output(control);
+        circuit.start();
+
+        circuit.conditional_swap(keys[0], keys[1], control);
+        REQUIRE(circuit._gates_counters["AND"] == 16);
+
+        circuit.sort(keys);
+        REQUIRE(circuit._gates_counters["AND"] + circuit._gates_counters["OR"] == 16 + 19 * 2 * 16);
+    }
+    // > !SECTION - Test 3: Conditional swap.
+
+    // -------------------
+    // > SECTION - Test 4: Invalid sizes.
+    // -------------------
+    {
+        CircuitGeneratorTester circuit("Sorting_Operations_Errors", "circuits/tests");
+        circuit.add_input_party(24);
+        circuit.add_output_party(8);
+
+        Var a(8), b(8), c(8), d(4);
+        circuit.add_input(a);
+        circuit.add_input(b);
+        circuit.add_input(c);
+        circuit.add_output(a);
+        circuit.start();
+
+        std::vector<Var> keys = { a, b, d }, valid_keys = { a, b }, payloads = { c };
+        REQUIRE_THROWS_AS(circuit.conditional_swap(a, d, b[0]), std::runtime_error);
+        REQUIRE_THROWS_AS(circuit.sort(keys), std::runtime_error);
+        REQUIRE_THROWS_AS(circuit.sort(valid_keys, payloads), std::runtime_error);
+    }
+    // > !SECTION - Test 4: Invalid sizes.
+    // > !SECTION - Test suit "Sorting Operations"
+}
+
+TEST_CASE("Permutation Operations") {
+    // > SECTION - Test suit "Permutation Operations"
+    //
+    // This test suit aims to test the permutation network and the permutation operation of the Circuit Generator class.
+    //
+    // Note: The constructor of CircuitGenerator does not have a public visibility, thus an instance cannot be created.
+    // For the sake of the tests, the tester class makes it accessible.
+    //
+    // Test suit index:
+    // > Test 1: Permutation networks
+    // > Test 2: Permuting variables
+    // > Test 3: Permutation costs
+    // > Test 4: Invalid inputs
+
+    std::mt19937_64 random(0xBC6E);
+
+    // -------------------
+    // > SECTION - Test 1: Permutation networks.
+    // -------------------
+    // The control bits of every permutation should route it through the network, which has the known amount of switches
+    auto routes = [](const std::vector<uint64_t>& permutation) {
+        const auto switches = CircuitGenerator::permutation_network(permutation.size());
+        const auto control_bits = CircuitGenerator::permutation_control_bits(permutation);
+        if (control_bits.size() != switches.size()) return false;
+
+        std::vector<uint64_t> values(permutation.size());
+        std::iota(values.begin(), values.end(), 0);
+        for (uint64_t i = 0; i < switches.size(); i++) {
+            if (control_bits[i]) std::swap(values[switches[i].low], values[switches[i].high]);
+        }
+        return values == permutation;
+    };
+
+    for (uint64_t size = 0; size <= 7; size++) {
+        std::vector<uint64_t> permutation(size);
+        std::iota(permutation.begin(), permutation.end(), 0);
+
+        bool routed = true;
+        do {
+            routed = routed && routes(permutation);
+        } while (std::next_permutation(permutation.begin(), permutation.end()));
+        REQUIRE(routed);
+    }
+
+    for (uint64_t size = 8; size <= 100; size++) {
+        std::vector<uint64_t> permutation(size);
+        std::iota(permutation.begin(), permutation.end(), 0);
+
+        for (uint64_t i = 0; i < 10; i++) {
+            std::shuffle(permutation.begin(), permutation.end(), random);
+            REQUIRE(routes(permutation));
+        }
+
+        uint64_t expected = 0;
+        for (uint64_t i = 1; i <= size; i++) {
+            expected += std::bit_width(i - 1);
+        }
+        REQUIRE(CircuitGenerator::permutation_network(size).size() == expected);
+    }
+
+    REQUIRE(CircuitGenerator::permutation_network(0).size() == 0);
+    REQUIRE(CircuitGenerator::permutation_network(1).size() == 0);
+    REQUIRE(CircuitGenerator::permutation_network(2).size() == 1);
+    REQUIRE(CircuitGenerator::permutation_network(3).size() == 3);
+    REQUIRE(CircuitGenerator::permutation_network(8).size() == 17);
+    REQUIRE(CircuitGenerator::permutation_network(1024).size() == 1024 * 10 - 1024 + 1);
+    // > !SECTION - Test 1: Permutation networks.
+
+    // -------------------
+    // > SECTION - Test 2: Permuting variables.
+    // -------------------
+    // Each lane of the shadow evaluation has the control bits of a different permutation, and the variables should end in the
+    // positions of the permutation
+    for (uint64_t size : { 2, 3, 5, 8, 13, 32 }) {
+        const uint64_t n_switches = CircuitGenerator::permutation_network(size).size();
+
+        CircuitGeneratorTester circuit("Permutation_Operations", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.shadow(true);
+        circuit.add_input_party(n_switches + 1);
+        circuit.add_output_party(1);
+
+        std::vector<std::vector<uint64_t>> permutations(64, std::vector<uint64_t>(size));
+        std::vector<uint64_t> lanes(n_switches, 0);
+        for (uint64_t lane = 0; lane < 64; lane++) {
+            std::iota(permutations[lane].begin(), permutations[lane].end(), 0);
+            std::shuffle(permutations[lane].begin(), permutations[lane].end(), random);
+
+            const auto control_bits = CircuitGenerator::permutation_control_bits(permutations[lane]);
+            for (uint64_t i = 0; i < n_switches; i++) {
+                lanes[i] |= uint64_t(control_bits[i]) << lane;
+            }
+        }
+
+        Var control(n_switches);
+        Wire output;
+        circuit.add_input_lanes(control, lanes);
+        circuit.add_input(output);
+        circuit.add_output(output);
+        circuit.start();
+
+        // Variables with their original position
+        std::vector<Var> variables(size, Var(6));
+        for (uint64_t i = 0; i < size; i++) {
+            circuit.assign_value(variables[i], i);
+        }
+
+        circuit.permute(variables, control);
+
+        for (uint64_t lane = 0; lane < 64; lane++) {
+            for (uint64_t i = 0; i < size; i++) {
+                REQUIRE(circuit.value(variables[i], lane) == permutations[lane][i]);
+            }
+        }
+    }
+    // > !SECTION - Test 2: Permuting variables.
+
+    // -------------------
+    // > SECTION - Test 3: Permutation costs.
+    // -------------------
+    // Each switch should only have an AND gate per bit
+    {
+        CircuitGeneratorTester circuit("Permutation_Operations_Costs", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.add_input_party(8 * 16 + 17);
+        circuit.add_output_party(16);
+
+        std::vector<Var> variables(8, Var(16));
+        Var control(17);
+        for (auto & variable : variables) {
+            circuit.add_input(variable);
+        }
+        circuit.add_input(control);
+        circuit.add_output(variables[0]);
+        circuit.start();
+
+        circuit.permute(variables, control);
+        REQUIRE(circuit._gates_counters["AND"] == 17 * 16);
+        REQUIRE(circuit._gates_counters["OR"] == 0);
+    }
+    // > !SECTION - Test 3: Permutation costs.
+
+    // -------------------
+    // > SECTION - Test 4: Invalid inputs.
+    // -------------------
+    {
+        REQUIRE_THROWS_AS(CircuitGenerator::permutation_control_bits({ 0, 0, 1 }), std::runtime_error);
+        REQUIRE_THROWS_AS(CircuitGenerator::permutation_control_bits({ 0, 3, 1 }), std::runtime_error);
+
+        CircuitGeneratorTester circuit("Permutation_Operations_Errors", "circuits/tests");
+        circuit.add_input_party(24);
+        circuit.add_output_party(8);
+
+        Var a(8), b(8), c(8), d(4);
+        circuit.add_input(a);
+        circuit.add_input(b);
+        circuit.add_input(c);
+        circuit.add_output(a);
+        circuit.start();
+
+        std::vector<Var> variables = { a, b, d }, valid_variables = { a, b, c };
+        REQUIRE_THROWS_AS(circuit.permute(variables, c.slice(0, 3)), std::runtime_error);
+        REQUIRE_THROWS_AS(circuit.permute(valid_variables, c.slice(0, 2)), std::runtime_error);
+    }
+    // > !SECTION - Test 4: Invalid inputs.
+    // > !SECTION - Test suit "Permutation Operations"
+}
+
+TEST_CASE("Array Operations") {
+    // > SECTION - Test suit "Array Operations"
+    //
+    // This test suit aims to test the decoder and the array operations of the Circuit Generator class.
+    //
+    // Note: The constructor of CircuitGenerator does not have a public visibility, thus an instance cannot be created.
+    // For the sake of the tests, the tester class makes it accessible.
+    //
+    // Test suit index:
+    // > Test 1: Decoder
+    // > Test 2: Reading and writing arrays
+    // > Test 3: Array costs
+    // > Test 4: Invalid sizes
+
+    std::mt19937_64 random(0xBC6E);
+
+    // -------------------
+    // > SECTION - Test 1: Decoder.
+    // -------------------
+    // The decoded wire of each value should only be one in the lanes where the input has that value, for outputs smaller and
+    // bigger than the values of the input
+    for (uint64_t n_bits = 0; n_bits <= 8; n_bits++) {
+        for (uint64_t size : { 1, 2, 3, 5, 16, 17, 64, 100, 256, 300 }) {
+            CircuitGeneratorTester circuit("Array_Operations", "circuits/tests");
+            circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+            circuit.shadow(true);
+            circuit.add_input_party(n_bits + 1);
+            circuit.add_output_party(1);
+
+            // Lane values with every small value and random bigger values
+            std::vector<uint64_t> values(64), lanes(n_bits, 0);
+            for (uint64_t lane = 0; lane < 64; lane++) {
+                values[lane] = (lane < 32 ? lane : random()) & ((uint64_t(1) << n_bits) - 1);
+                for (uint64_t i = 0; i < n_bits; i++) {
+                    lanes[i] |= ((values[lane] >> i) & 0x01) << lane;
+                }
+            }
+
+            Var index(n_bits);
+            Wire output;
+            circuit.add_input_lanes(index, lanes);
+            circuit.add_input(output);
+            circuit.add_output(output);
+            circuit.start();
+
+            Var one_hot(size);
+            circuit.decoder(index, one_hot);
+
+            bool decoded = true;
+            for (uint64_t i = 0; i < size; i++) {
+                uint64_t expected = 0;
+                for (uint64_t lane = 0; lane < 64; lane++) {
+                    expected |= uint64_t(values[lane] == i) << lane;
+                }
+                decoded = decoded && circuit.lanes(one_hot[i]) == expected;
+            }
+            REQUIRE(decoded);
+        }
+    }
+    // > !SECTION - Test 1: Decoder.
+
+    // -------------------
+    // > SECTION - Test 2: Reading and writing arrays.
+    // -------------------
+    // The read element and the written array should match the arrays evaluated in each lane, including indexes out of the
+    // array
+    for (uint64_t size : { 1, 2, 5, 8, 13, 32 }) {
+        CircuitGeneratorTester circuit("Array_Operations", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.shadow(true);
+        circuit.add_input_party(size * 8 + 6 + 8);
+        circuit.add_output_party(1);
+
+        std::vector<Var> array(size, Var(8));
+        Var index(6), value(8);
+        for (auto & element : array) {
+            std::vector<uint64_t> lanes(8);
+            for (auto & lane : lanes) lane = random();
+            circuit.add_input_lanes(element, lanes);
+        }
+        // > Half of the lanes have an index inside the array
+        std::vector<uint64_t> index_lanes(6, 0), value_lanes(8);
+        for (uint64_t lane = 0; lane < 64; lane++) {
+            const uint64_t cur_index = lane < 32 ? random() % size : random() % 64;
+            for (uint64_t i = 0; i < 6; i++) {
+                index_lanes[i] |= ((cur_index >> i) & 0x01) << lane;
+            }
+        }
+        for (auto & lane : value_lanes) lane = random();
+        circuit.add_input_lanes(index, index_lanes);
+        circuit.add_input_lanes(value, value_lanes);
+
+        Wire output;
+        circuit.add_output(output);
+        circuit.start();
+
+        // Expected results
+        std::vector<std::vector<uint64_t>> expected(64);
+        std::vector<uint64_t> indexes(64), read(64);
+        for (uint64_t lane = 0; lane < 64; lane++) {
+            for (auto & element : array) {
+                expected[lane].push_back(circuit.value(element, lane));
+            }
+            indexes[lane] = circuit.value(index, lane);
+            read[lane] = indexes[lane] < size ? expected[lane][indexes[lane]] : 0;
+            if (indexes[lane] < size) expected[lane][indexes[lane]] = circuit.value(value, lane);
+        }
+
+        Var element(8);
+        circuit.array_read(array, index, element);
+        circuit.array_write(array, index, value);
+
+        for (uint64_t lane = 0; lane < 64; lane++) {
+            REQUIRE(circuit.value(element, lane) == read[lane]);
+            for (uint64_t i = 0; i < size; i++) {
+                REQUIRE(circuit.value(array[i], lane) == expected[lane][i]);
+            }
+        }
+    }
+    // > !SECTION - Test 2: Reading and writing arrays.
+
+    // -------------------
+    // > SECTION - Test 3: Array costs.
+    // -------------------
+    // The decoder should have 2^k-2 AND gates, the array operations one more AND gate per bit of the array, and a lookup table
+    // of constants only the decoder
+    {
+        CircuitGeneratorTester circuit("Array_Operations_Costs", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.add_input_party(16 * 8 + 8 + 8);
+        circuit.add_output_party(8);
+
+        std::vector<Var> array(16, Var(8));
+        Var index(8), value(8);
+        for (auto & element : array) {
+            circuit.add_input(element);
+        }
+        circuit.add_input(index);
+        circuit.add_input(value);
+        circuit.add_output(value);
+        circuit.start();
+
+        Var one_hot(256);
+        circuit.decoder(index, one_hot);
+        REQUIRE(circuit._gates_counters["AND"] == 254);
+        REQUIRE(circuit._gates_counters["OR"] == 0);
+
+        // > The 4 bits above the array size are ORed into the root of the tree
+        circuit._gates_counters.clear();
+        Var element(8);
+        circuit.array_read(array, index, element);
+#if BCGEN_OR_GATES == 1
+        REQUIRE(circuit._gates_counters["AND"] == 15 + 16 * 8);
+        REQUIRE(circuit._gates_counters["OR"] == 3);
+#else
+        // > Without OR gates, each OR is emulated with an AND
+        REQUIRE(circuit._gates_counters["AND"] == 15 + 16 * 8 + 3);
+        REQUIRE(circuit._gates_counters["OR"] == 0);
+#endif
+
+        circuit._gates_counters.clear();
+        circuit.array_write(array, index.slice(0, 4), value);
+        REQUIRE(circuit._gates_counters["AND"] == 14 + 16 * 8);
+        REQUIRE(circuit._gates_counters["OR"] == 0);
+
+        std::vector<Var> table(16, Var(8));
+        for (uint64_t i = 0; i < 16; i++) {
+            circuit.assign_value(table[i], (i * 37) & 0xFF);
+        }
+        circuit._gates_counters.clear();
+        circuit.array_read(table, index.slice(0, 4), element);
+        REQUIRE(circuit._gates_counters["AND"] == 14);
+    }
+    // > !SECTION - Test 3: Array costs.
+
+    // -------------------
+    // > SECTION - Test 4: Invalid sizes.
+    // -------------------
+    {
+        CircuitGeneratorTester circuit("Array_Operations_Errors", "circuits/tests");
+        circuit.add_input_party(24);
+        circuit.add_output_party(8);
+
+        Var a(8), b(8), c(4), d(4);
+        circuit.add_input(a);
+        circuit.add_input(b);
+        circuit.add_input(c);
+        circuit.add_input(d);
+        circuit.add_output(a);
+        circuit.start();
+
+        std::vector<Var> array = { a, b, c }, valid_array = { a, b };
+        REQUIRE_THROWS_AS(circuit.array_read(array, d, a), std::runtime_error);
+        REQUIRE_THROWS_AS(circuit.array_read(valid_array, d, c), std::runtime_error);
+        REQUIRE_THROWS_AS(circuit.array_write(array, d, a), std::runtime_error);
+        REQUIRE_THROWS_AS(circuit.array_write(valid_array, d, c), std::runtime_error);
+    }
+    // > !SECTION - Test 4: Invalid sizes.
+    // > !SECTION - Test suit "Array Operations"
+}
+
+TEST_CASE("Fixed Point Operations") {
+    // > SECTION - Test suit "Fixed Point Operations"
+    //
+    // This test suit aims to test the fixed point operations of the Circuit Generator class.
+    //
+    // Note: The constructor of CircuitGenerator does not have a public visibility, thus an instance cannot be created.
+    // For the sake of the tests, the tester class makes it accessible.
+    //
+    // Test suit index:
+    // > Test 1: Arithmetic operations
+    // > Test 2: Comparisons
+    // > Test 3: Fixed point costs
+
+    using gabe::bcgen::FixedPoint;
+    using gabe::bcgen::Rounding;
+    std::mt19937_64 random(0xBC6E);
+
+    const std::vector<std::pair<uint64_t, uint64_t>> formats_a = { {4, 4}, {2, 6}, {6, 2} };
+    const std::vector<std::pair<uint64_t, uint64_t>> formats_b = { {4, 4}, {3, 2} };
+    const std::vector<std::pair<uint64_t, uint64_t>> formats_out = { {4, 4}, {8, 8}, {3, 2}, {2, 7} };
+    const std::vector<Rounding> roundings = { Rounding::Truncate, Rounding::Nearest, Rounding::NearestEven };
+
+    // Sign extension of a value with a size
+    auto signed_value = [](uint64_t value, uint64_t size) {
+        return static_cast<int64_t>(value << (64 - size)) >> (64 - size);
+    };
+
+    // Expected conversion of an exact value with some fraction bits to a format
+    auto expected_conversion = [](__int128 value, uint64_t fraction_bits, const FixedPoint& out, Rounding rounding, bool saturate) {
+        __int128 result = value;
+        if (fraction_bits <= out.fraction_bits()) {
+            result = value * (__int128(1) << (out.fraction_bits() - fraction_bits));
+        } else {
+            const uint64_t dropped = fraction_bits - out.fraction_bits();
+            const __int128 half = __int128(1) << (dropped - 1);
+            result = value >> dropped;
+            const __int128 remainder = value - result * (__int128(1) << dropped);
+            if (rounding == Rounding::Nearest) result += remainder >= half;
+            if (rounding == Rounding::NearestEven) result += remainder > half || (remainder == half && (result & 1));
+        }
+
+        const __int128 max = (__int128(1) << (out.size() - 1)) - 1;
+        if (saturate) result = std::clamp(result, -max - 1, max);
+        return uint64_t(result) & ((uint64_t(1) << out.size()) - 1);
+    };
+
+    // Runs an operation over the random values of the 64 lanes
+    // > The expected function receives the exact input integers
+    auto check = [&](std::pair<uint64_t, uint64_t> format_a, std::pair<uint64_t, uint64_t> format_b, std::pair<uint64_t, uint64_t> format_out,
+                     const std::function<void(CircuitGeneratorTester&, const FixedPoint&, const FixedPoint&, FixedPoint&)>& operation,
+                     const std::function<std::optional<uint64_t>(int64_t, int64_t, const FixedPoint&, const FixedPoint&, const FixedPoint&)>& expected) {
+        CircuitGeneratorTester circuit("Fixed_Point_Operations", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.shadow(true);
+
+        FixedPoint a(format_a.first, format_a.second), b(format_b.first, format_b.second), out(format_out.first, format_out.second);
+        circuit.add_input_party(a.size() + b.size());
+        circuit.add_output_party(1);
+
+        std::vector<uint64_t> lanes_a(a.size()), lanes_b(b.size());
+        for (auto & lane : lanes_a) lane = random();
+        for (auto & lane : lanes_b) lane = random();
+        circuit.add_input_lanes(a, lanes_a);
+        circuit.add_input_lanes(b, lanes_b);
+
+        Wire output;
+        circuit.add_output(output);
+        circuit.start();
+
+        operation(circuit, a, b, out);
+
+        bool correct = true;
+        for (uint64_t lane = 0; lane < 64; lane++) {
+            const std::optional<uint64_t> result = expected(signed_value(circuit.value(a, lane), a.size()), signed_value(circuit.value(b, lane), b.size()), a, b, out);
+            correct = correct && (!result || circuit.value(out, lane) == *result);
+        }
+        return correct;
+    };
+
+    // -------------------
+    // > SECTION - Test 1: Arithmetic operations.
+    // -------------------
+    // Every operation should give the exact result converted to the output format, with every rounding, with and without
+    // saturation
+    for (auto format_a : formats_a) {
+        for (auto format_b : formats_b) {
+            for (auto format_out : formats_out) {
+                for (bool saturate : { false, true }) {
+                    for (auto rounding : roundings) {
+                        REQUIRE(check(format_a, format_b, format_out,
+                            [&](CircuitGeneratorTester& circuit, const FixedPoint& a, const FixedPoint& b, FixedPoint& out) { circuit.sum_fixed(a, b, out, rounding, saturate); },
+                            [&](int64_t a, int64_t b, const FixedPoint& fa, const FixedPoint& fb, const FixedPoint& out) {
+                                const uint64_t fraction_bits = std::max(fa.fraction_bits(), fb.fraction_bits());
+                                const __int128 sum = __int128(a) * (1 << (fraction_bits - fa.fraction_bits())) + __int128(b) * (1 << (fraction_bits - fb.fraction_bits()));
+                                return std::optional<uint64_t>(expected_conversion(sum, fraction_bits, out, rounding, saturate));
+                            }
+                        ));
+
+                        REQUIRE(check(format_a, format_b, format_out,
+                            [&](CircuitGeneratorTester& circuit, const FixedPoint& a, const FixedPoint& b, FixedPoint& out) { circuit.subtract_fixed(a, b, out, rounding, saturate); },
+                            [&](int64_t a, int64_t b, const FixedPoint& fa, const FixedPoint& fb, const FixedPoint& out) {
+                                const uint64_t fraction_bits = std::max(fa.fraction_bits(), fb.fraction_bits());
+                                const __int128 difference = __int128(a) * (1 << (fraction_bits - fa.fraction_bits())) - __int128(b) * (1 << (fraction_bits - fb.fraction_bits()));
+                                return std::optional<uint64_t>(expected_conversion(difference, fraction_bits, out, rounding, saturate));
+                            }
+                        ));
+
+                        REQUIRE(check(format_a, format_b, format_out,
+                            [&](CircuitGeneratorTester& circuit, const FixedPoint& a, const FixedPoint& b, FixedPoint& out) { circuit.multiply_fixed(a, b, out, rounding, saturate); },
+                            [&](int64_t a, int64_t b, const FixedPoint& fa, const FixedPoint& fb, const FixedPoint& out) {
+                                return std::optional<uint64_t>(expected_conversion(__int128(a) * b, fa.fraction_bits() + fb.fraction_bits(), out, rounding, saturate));
+                            }
+                        ));
+
+                        REQUIRE(check(format_a, format_b, format_out,
+                            [&](CircuitGeneratorTester& circuit, const FixedPoint& a, const FixedPoint&, FixedPoint& out) { circuit.convert_fixed(a, out, rounding, saturate); },
+                            [&](int64_t a, int64_t, const FixedPoint& fa, const FixedPoint&, const FixedPoint& out) {
+                                return std::optional<uint64_t>(expected_conversion(a, fa.fraction_bits(), out, rounding, saturate));
+                            }
+                        ));
+                    }
+
+                    // > The quotient is rounded towards zero, and is not defined for a zero divisor
+                    REQUIRE(check(format_a, format_b, format_out,
+                        [&](CircuitGeneratorTester& circuit, const FixedPoint& a, const FixedPoint& b, FixedPoint& out) { circuit.divide_fixed(a, b, out, saturate); },
+                        [&](int64_t a, int64_t b, const FixedPoint& fa, const FixedPoint& fb, const FixedPoint& out) -> std::optional<uint64_t> {
+                            if (b == 0) return std::nullopt;
+
+                            const int64_t shift = int64_t(out.fraction_bits() + fb.fraction_bits()) - int64_t(fa.fraction_bits());
+                            const __int128 dividend = shift > 0 ? __int128(a) << shift : __int128(a);
+                            const __int128 divisor = shift < 0 ? __int128(b) << -shift : __int128(b);
+                            return expected_conversion(dividend / divisor, 0, FixedPoint(out.size(), 0), Rounding::Truncate, saturate);
+                        }
+                    ));
+                }
+            }
+        }
+    }
+    // > !SECTION - Test 1: Arithmetic operations.
+
+    // -------------------
+    // > SECTION - Test 2: Comparisons.
+    // -------------------
+    // The comparisons should compare the values of different formats
+    for (auto format_a : formats_a) {
+        for (auto format_b : formats_b) {
+            auto exact = [](int64_t a, int64_t b, const FixedPoint& fa, const FixedPoint& fb) {
+                const uint64_t fraction_bits = std::max(fa.fraction_bits(), fb.fraction_bits());
+                return std::make_pair(a << (fraction_bits - fa.fraction_bits()), b << (fraction_bits - fb.fraction_bits()));
+            };
+
+            REQUIRE(check(format_a, format_b, { 1, 0 },
+                [&](CircuitGeneratorTester& circuit, const FixedPoint& a, const FixedPoint& b, FixedPoint& out) { circuit.equal_fixed(a, b, out[0]); },
+                [&](int64_t a, int64_t b, const FixedPoint& fa, const FixedPoint& fb, const FixedPoint&) {
+                    auto [x, y] = exact(a, b, fa, fb);
+                    return std::optional<uint64_t>(x == y);
+                }
+            ));
+
+            REQUIRE(check(format_a, format_b, { 1, 0 },
+                [&](CircuitGeneratorTester& circuit, const FixedPoint& a, const FixedPoint& b, FixedPoint& out) { circuit.greater_fixed(a, b, out[0]); },
+                [&](int64_t a, int64_t b, const FixedPoint& fa, const FixedPoint& fb, const FixedPoint&) {
+                    auto [x, y] = exact(a, b, fa, fb);
+                    return std::optional<uint64_t>(x > y);
+                }
+            ));
+
+            REQUIRE(check(format_a, format_b, { 1, 0 },
+                [&](CircuitGeneratorTester& circuit, const FixedPoint& a, const FixedPoint& b, FixedPoint& out) { circuit.smaller_fixed(a, b, out[0]); },
+                [&](int64_t a, int64_t b, const FixedPoint& fa, const FixedPoint& fb, const FixedPoint&) {
+                    auto [x, y] = exact(a, b, fa, fb);
+                    return std::optional<uint64_t>(x < y);
+                }
+            ));
+        }
+    }
+    // > !SECTION - Test 2: Comparisons.
+
+    // -------------------
+    // > SECTION - Test 3: Fixed point costs.
+    // -------------------
+    // A truncated product should only compute the product bits of the output, and a truncated conversion should not have any
+    // gates
+    {
+        CircuitGeneratorTester circuit("Fixed_Point_Operations_Costs", "circuits/tests");
+        circuit._gates_map = { {"xor", "XOR"}, {"inv", "INV"}, {"and", "AND"}, {"or", "OR"} };
+        circuit.add_input_party(64);
+        circuit.add_output_party(32);
+
+        FixedPoint a(16, 16), b(16, 16), out(16, 16);
+        circuit.add_input(a);
+        circuit.add_input(b);
+        circuit.add_output(out);
+        circuit.start();
+
+        Var product(48);
+        circuit.multiply_s(a, b, product);
+        const uint64_t truncated_gates = circuit._gates_counters["AND"];
+
+        circuit.multiply_fixed(a, b, out);
+        REQUIRE(circuit._gates_counters["AND"] == 2 * truncated_gates);
+
+        Var full_product(64);
+        circuit._gates_counters.clear();
+        circuit.multiply_s(a, b, full_product);
+        REQUIRE(circuit._gates_counters["AND"] > truncated_gates);
+
+        FixedPoint narrow(8, 8);
+        circuit._counter_gates = 0;
+        circuit.convert_fixed(a, narrow);
+        REQUIRE(circuit._counter_gates == 0);
+    }
+    // > !SECTION - Test 3: Fixed point costs.
+    // > !SECTION - Test suit "Fixed Point Operations"
+}
+
 TEST_CASE("Memory Management") {}
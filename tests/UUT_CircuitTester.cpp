@@ -0,0 +1,821 @@
+#include <bcgen/CircuitGenerator.hpp>
+#include <bcgen/CircuitTester.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Don't use this :)
+using Wire = gabe::bcgen::Wire;
+using Var = gabe::bcgen::Variable;
+using BristolGenerator = gabe::bcgen::BristolCircuitGenerator;
+using LibscapiGenerator = gabe::bcgen::LibscapiCircuitGenerator;
+using BristolTester = gabe::bcgen::BristolCircuitTester;
+using LibscapiTester = gabe::bcgen::LibscapiCircuitTester;
+using FashionGenerator = gabe::bcgen::BristolFashionCircuitGenerator;
+using FashionTester = gabe::bcgen::BristolFashionCircuitTester;
+using BinaryGenerator = gabe::bcgen::BinaryCircuitGenerator;
+using BinaryTester = gabe::bcgen::BinaryCircuitTester;
+using BinaryLayout = gabe::bcgen::binary_format::Layout;
+
+// Exposes the multithreading control variables of the Bristol tester
+class BristolTesterTester : public BristolTester
+{
+public:
+    using BristolTester::_parallel_threshold;
+    using BristolTester::_phases;
+    using BristolTester::_scan_uint;
+};
+
+// Exposes the wires counter of the Bristol generator
+class BristolGeneratorTester : public BristolGenerator
+{
+public:
+    using BristolGenerator::BristolGenerator;
+    using BristolGenerator::_counter_wires;
+};
+
+// Appends the bits of a value into a list of circuit inputs (least significant bit first)
+static void push_bits(std::vector<uint8_t>& inputs, uint64_t value, uint64_t size) {
+    for (uint64_t i = 0; i < size; i++) {
+        inputs.push_back((value >> i) & 0x01);
+    }
+}
+
+// Creates a circuit that outputs the sum and the difference of two 8 bits inputs
+static void sum_subtract_circuit(gabe::bcgen::CircuitGenerator& generator) {
+    generator.add_input_party(8);
+    generator.add_input_party(8);
+    generator.add_output_party(8);
+    generator.add_output_party(8);
+
+    Var in_1(8), in_2(8);
+    generator.add_input(in_1);
+    generator.add_input(in_2);
+
+    Var out_sum(8), out_sub(8);
+    generator.add_output(out_sum);
+    generator.add_output(out_sub);
+
+    generator.start();
+    generator.sum(in_1, in_2, out_sum);
+    generator.subtract(in_1, in_2, out_sub);
+    generator.stop();
+}
+
+// Creates a circuit that outputs (A + B) - (A XOR B) of two 32 bits inputs
+static void arithmetic_circuit(gabe::bcgen::CircuitGenerator& generator) {
+    generator.add_input_party(32);
+    generator.add_input_party(32);
+    generator.add_output_party(32);
+
+    Var in_1(32), in_2(32);
+    generator.add_input(in_1);
+    generator.add_input(in_2);
+
+    Var out(32);
+    generator.add_output(out);
+
+    generator.start();
+    Var a_plus_b(32), a_xor_b(32);
+    generator.sum(in_1, in_2, a_plus_b);
+    generator.XOR(in_1, in_2, a_xor_b);
+    generator.subtract(a_plus_b, a_xor_b, out);
+    generator.stop();
+}
+
+TEST_CASE("Evaluate") {
+    // > SECTION - Test suit "Evaluate"
+    //
+    // This test suit aims to test the programmatic execution of circuits with the Circuit Tester classes.
+    //
+    // Test suit index:
+    // > Test 1: Evaluate a Bristol circuit
+    // > Test 2: Evaluate a Libscapi circuit
+    // > Test 3: Evaluate with a wrong amount of inputs
+
+    // -------------------
+    // > SECTION - Setup
+    // -------------------
+    // This section creates the same circuit in both Bristol and Libscapi formats. The circuit has 2 input parties of 8 wires, and
+    // 2 output parties of 8 wires (sum and subtraction of the inputs).
+    {
+        BristolGenerator bristol("Evaluate", "circuits/tests");
+        sum_subtract_circuit(bristol);
+
+        LibscapiGenerator libscapi("Evaluate", "circuits/tests");
+        sum_subtract_circuit(libscapi);
+    }
+    // > !SECTION - Setup
+
+    // -------------------
+    // > SECTION - Test 1: Evaluate a Bristol circuit.
+    // -------------------
+    // This test opens the Bristol circuit without console output and evaluates it multiple times. Each evaluation should return
+    // one entry per output party, each with a single 64 bits word containing the 8 output wires.
+    BristolTester bristol_tester;
+    bristol_tester.verbose(false);
+    bristol_tester.open("bristol_Evaluate", "circuits/tests");
+
+    for (uint64_t a : {0, 3, 100, 255}) {
+        for (uint64_t b : {0, 5, 27, 200}) {
+            std::vector<uint8_t> inputs;
+            push_bits(inputs, a, 8);
+            push_bits(inputs, b, 8);
+
+            std::vector<std::vector<uint64_t>> outputs = bristol_tester.evaluate(inputs);
+
+            REQUIRE(outputs.size() == 2);
+            REQUIRE(outputs[0].size() == 1);
+            REQUIRE(outputs[1].size() == 1);
+            REQUIRE(outputs[0][0] == ((a + b) & 0xFF));
+            REQUIRE(outputs[1][0] == ((a - b) & 0xFF));
+        }
+    }
+    // > !SECTION - Test 1: Evaluate a Bristol circuit.
+
+    // -------------------
+    // > SECTION - Test 2: Evaluate a Libscapi circuit.
+    // -------------------
+    // Same as Test 1, but for the Libscapi circuit format.
+    LibscapiTester libscapi_tester;
+    libscapi_tester.verbose(false);
+    libscapi_tester.open("libscapi_Evaluate", "circuits/tests");
+
+    for (uint64_t a : {0, 3, 100, 255}) {
+        for (uint64_t b : {0, 5, 27, 200}) {
+            std::vector<uint8_t> inputs;
+            push_bits(inputs, a, 8);
+            push_bits(inputs, b, 8);
+
+            std::vector<std::vector<uint64_t>> outputs = libscapi_tester.evaluate(inputs);
+
+            REQUIRE(outputs.size() == 2);
+            REQUIRE(outputs[0][0] == ((a + b) & 0xFF));
+            REQUIRE(outputs[1][0] == ((a - b) & 0xFF));
+        }
+    }
+    // > !SECTION - Test 2: Evaluate a Libscapi circuit.
+
+    // -------------------
+    // > SECTION - Test 3: Evaluate with a wrong amount of inputs.
+    // -------------------
+    // The circuit expects 16 input values. A runtime error exception should be raised otherwise.
+    bool failed_t3 = false;
+
+    try { bristol_tester.evaluate(std::vector<uint8_t>(15, 0)); }
+    catch (std::runtime_error) { failed_t3 = true; }
+
+    REQUIRE(failed_t3);
+    // > !SECTION - Test 3: Evaluate with a wrong amount of inputs.
+    // > !SECTION - Test suit "Evaluate"
+}
+
+TEST_CASE("Parallel Evaluate") {
+    // > SECTION - Test suit "Parallel Evaluate"
+    //
+    // This test suit aims to test the multithreaded and the bit-sliced (batch) executions of circuits.
+    //
+    // Test suit index:
+    // > Test 1: Levels statistics
+    // > Test 2: Multithreaded evaluation
+    // > Test 3: Batch evaluation
+
+    // -------------------
+    // > SECTION - Setup
+    // -------------------
+    // This section creates a 32 bits arithmetic circuit, and opens it with a very low threshold to split the levels between
+    // the threads, so that the multithreaded path is used even for a small circuit.
+    {
+        BristolGenerator bristol("Arithmetic", "circuits/tests");
+        arithmetic_circuit(bristol);
+    }
+
+    BristolTesterTester tester;
+    tester.verbose(false);
+    tester._parallel_threshold = 4;
+    tester.open("bristol_Arithmetic", "circuits/tests");
+
+    const std::vector<std::pair<uint64_t, uint64_t>> values = { {0, 0}, {1, 0xFFFFFFFF}, {300, 7}, {0xFFFFFFFF, 0xFFFFFFFF}, {123456, 654321} };
+    // > !SECTION - Setup
+
+    // -------------------
+    // > SECTION - Test 1: Levels statistics.
+    // -------------------
+    // Every gate should belong to a single level, and some of the levels should be split between the threads.
+    uint64_t total_gates = 0;
+    for (auto & level : tester.statistics()) {
+        REQUIRE(level.gates > 0);
+        total_gates += level.gates;
+    }
+
+    bool has_parallel_phase = false;
+    for (auto & phase : tester._phases) {
+        has_parallel_phase |= phase.parallel;
+    }
+
+    std::vector<uint8_t> zeros(64, 0);
+    tester.evaluate(zeros);
+
+    REQUIRE(total_gates > 0);
+    REQUIRE(has_parallel_phase);
+    // > !SECTION - Test 1: Levels statistics.
+
+    // -------------------
+    // > SECTION - Test 2: Multithreaded evaluation.
+    // -------------------
+    // The same circuit is evaluated with 1 and 4 threads. Both should output the expected result.
+    for (uint64_t n_threads : {1, 4}) {
+        tester.threads(n_threads);
+
+        for (auto [a, b] : values) {
+            std::vector<uint8_t> inputs;
+            push_bits(inputs, a, 32);
+            push_bits(inputs, b, 32);
+
+            REQUIRE(tester.evaluate(inputs)[0][0] == (((a + b) - (a ^ b)) & 0xFFFFFFFF));
+        }
+    }
+    // > !SECTION - Test 2: Multithreaded evaluation.
+
+    // -------------------
+    // > SECTION - Test 3: Batch evaluation.
+    // -------------------
+    // All the values are evaluated at once, each in its own instance (bit) of the input wires values. Every instance should
+    // output its expected result.
+    for (uint64_t n_threads : {1, 4}) {
+        tester.threads(n_threads);
+
+        std::vector<uint64_t> inputs(64, 0x00);
+        for (uint64_t k = 0; k < values.size(); k++) {
+            for (uint64_t i = 0; i < 32; i++) {
+                inputs[i] |= ((values[k].first >> i) & 0x01) << k;
+                inputs[32 + i] |= ((values[k].second >> i) & 0x01) << k;
+            }
+        }
+
+        std::vector<std::vector<uint64_t>> outputs = tester.evaluate_batch(inputs);
+        REQUIRE(outputs.size() == 1);
+        REQUIRE(outputs[0].size() == 32);
+
+        for (uint64_t k = 0; k < values.size(); k++) {
+            uint64_t result = 0;
+            for (uint64_t i = 0; i < 32; i++) {
+                result |= ((outputs[0][i] >> k) & 0x01) << i;
+            }
+
+            const uint64_t a = values[k].first, b = values[k].second;
+            REQUIRE(result == (((a + b) - (a ^ b)) & 0xFFFFFFFF));
+        }
+    }
+    // > !SECTION - Test 3: Batch evaluation.
+    // > !SECTION - Test suit "Parallel Evaluate"
+}
+
+TEST_CASE("Integer Scanner") {
+    // > SECTION - Test suit "Integer Scanner"
+    //
+    // This test suit aims to test the integer scanner used to read the circuit files. The scanner converts up to 8 digits at a
+    // time when there are enough characters left in the text, and one digit at a time otherwise. Both paths are tested.
+    //
+    // Test suit index:
+    // > Test 1: Scan integers of multiple sizes
+    // > Test 2: Scan a text without an integer
+
+    // -------------------
+    // > SECTION - Test 1: Scan integers of multiple sizes.
+    // -------------------
+    // A text with integers of 1 up to 20 digits, separated by different whitespaces, is scanned. Every integer should be read
+    // back, and the cursor should end at the end of the text.
+    const std::vector<uint64_t> values = {
+        0, 7, 42, 123, 9999, 12345678, 123456789, 1000000000, 98765432101234, 18446744073709551615ULL
+    };
+
+    std::string text;
+    for (auto value : values) {
+        text += std::to_string(value) + (value % 2 ? " \n" : "\t ");
+    }
+    text += "XOR";
+
+    std::string_view line = text;
+    for (auto value : values) {
+        REQUIRE(BristolTesterTester::_scan_uint(line) == value);
+    }
+    REQUIRE(line.find("XOR") != std::string_view::npos);
+    // > !SECTION - Test 1: Scan integers of multiple sizes.
+
+    // -------------------
+    // > SECTION - Test 2: Scan a text without an integer.
+    // -------------------
+    // A runtime error exception should be raised if there is no integer to scan.
+    bool failed_t2 = false;
+
+    std::string_view gate_name = "  AND\n";
+    try { BristolTesterTester::_scan_uint(gate_name); }
+    catch (std::runtime_error) { failed_t2 = true; }
+
+    REQUIRE(failed_t2);
+    // > !SECTION - Test 2: Scan a text without an integer.
+    // > !SECTION - Test suit "Integer Scanner"
+}
+
+TEST_CASE("Binary Circuits") {
+    // > SECTION - Test suit "Binary Circuits"
+    //
+    // This test suit aims to test the generation and the execution of circuits with the binary circuit format.
+    //
+    // Test suit index:
+    // > Test 1: Binary circuits size
+    // > Test 2: Evaluate binary circuits
+    // > Test 3: Corrupted binary circuit
+
+    // -------------------
+    // > SECTION - Setup
+    // -------------------
+    // This section creates the same 32 bits arithmetic circuit in Bristol format and in binary format, with both layouts and with
+    // and without checksums.
+    {
+        BristolGenerator bristol("Binary", "circuits/tests");
+        arithmetic_circuit(bristol);
+
+        BinaryGenerator fixed("Fixed", "circuits/tests", BinaryLayout::Fixed);
+        arithmetic_circuit(fixed);
+
+        BinaryGenerator varint("Varint", "circuits/tests", BinaryLayout::Varint);
+        arithmetic_circuit(varint);
+
+        BinaryGenerator unchecked("Unchecked", "circuits/tests", BinaryLayout::Varint, false);
+        arithmetic_circuit(unchecked);
+    }
+
+    const std::vector<std::pair<uint64_t, uint64_t>> values = { {0, 0}, {1, 0xFFFFFFFF}, {300, 7}, {0xFFFFFFFF, 0xFFFFFFFF}, {123456, 654321} };
+    // > !SECTION - Setup
+
+    // -------------------
+    // > SECTION - Test 1: Binary circuits size.
+    // -------------------
+    // Both binary layouts should be smaller than the Bristol circuit, and the variable length layout smaller than the fixed one.
+    const uint64_t bristol_size = std::filesystem::file_size("circuits/tests/bristol_Binary.txt");
+    const uint64_t fixed_size = std::filesystem::file_size("circuits/tests/binary_Fixed.bcg");
+    const uint64_t varint_size = std::filesystem::file_size("circuits/tests/binary_Varint.bcg");
+
+    REQUIRE(fixed_size < bristol_size);
+    REQUIRE(varint_size * 4 < bristol_size);
+    REQUIRE(varint_size < fixed_size);
+    // > !SECTION - Test 1: Binary circuits size.
+
+    // -------------------
+    // > SECTION - Test 2: Evaluate binary circuits.
+    // -------------------
+    // All the binary circuits should output the expected result.
+    for (auto name : {"binary_Fixed", "binary_Varint", "binary_Unchecked"}) {
+        BinaryTester tester;
+        tester.verbose(false);
+        tester.open(name, "circuits/tests");
+
+        for (auto [a, b] : values) {
+            std::vector<uint8_t> inputs;
+            push_bits(inputs, a, 32);
+            push_bits(inputs, b, 32);
+
+            REQUIRE(tester.evaluate(inputs)[0][0] == (((a + b) - (a ^ b)) & 0xFFFFFFFF));
+        }
+    }
+    // > !SECTION - Test 2: Evaluate binary circuits.
+
+    // -------------------
+    // > SECTION - Test 3: Corrupted binary circuit.
+    // -------------------
+    // A byte of the gates section of a circuit with checksums is changed. A runtime error exception should be raised when the
+    // circuit is opened.
+    std::filesystem::copy_file(
+        "circuits/tests/binary_Varint.bcg", "circuits/tests/binary_Corrupted.bcg",
+        std::filesystem::copy_options::overwrite_existing
+    );
+    {
+        std::fstream corrupted("circuits/tests/binary_Corrupted.bcg", std::ios::in | std::ios::out | std::ios::binary);
+        corrupted.seekp(varint_size / 2);
+        corrupted.put(static_cast<char>(0xAA));
+    }
+
+    bool failed_t3 = false;
+
+    BinaryTester corrupted_tester;
+    corrupted_tester.verbose(false);
+    try { corrupted_tester.open("binary_Corrupted", "circuits/tests"); }
+    catch (std::runtime_error) { failed_t3 = true; }
+
+    REQUIRE(failed_t3);
+    // > !SECTION - Test 3: Corrupted binary circuit.
+    // > !SECTION - Test suit "Binary Circuits"
+}
+
+TEST_CASE("Bristol Fashion") {
+    // > SECTION - Test suit "Bristol Fashion"
+    //
+    // This test suit aims to test the generation and the execution of circuits with the Bristol Fashion format.
+    //
+    // Test suit index:
+    // > Test 1: Bristol Fashion gates
+    // > Test 2: Evaluate a Bristol Fashion circuit
+
+    // -------------------
+    // > SECTION - Setup
+    // -------------------
+    // This section creates the 32 bits arithmetic circuit in Bristol Fashion format, and reads all its gate lines.
+    {
+        FashionGenerator fashion("Arithmetic", "circuits/tests");
+        arithmetic_circuit(fashion);
+    }
+
+    std::ifstream circuit("circuits/tests/bristol_fashion_Arithmetic.txt");
+    uint64_t n_lines, n_wires;
+    circuit >> n_lines >> n_wires;
+
+    // Skips the rest of the first line, the parties lines and the empty line
+    std::string line;
+    for (int i = 0; i < 4; i++) std::getline(circuit, line);
+
+    std::vector<std::string> lines(n_lines);
+    for (auto & gate_line : lines) std::getline(circuit, gate_line);
+    // > !SECTION - Setup
+
+    // -------------------
+    // > SECTION - Test 1: Bristol Fashion gates.
+    // -------------------
+    // The constant wires should be assigned with EQ gates and the 32 output wires copied with EQW gates. The AND gates should
+    // be batched in MAND lines of independent gates, thus no AND output should be an input of the same MAND line.
+    uint64_t n_eq = 0, n_eqw = 0, n_mand = 0;
+    for (auto & gate_line : lines) {
+        std::istringstream gate(gate_line);
+        uint64_t n_inputs, n_outputs;
+        gate >> n_inputs >> n_outputs;
+
+        std::vector<uint64_t> labels(n_inputs + n_outputs);
+        for (auto & label : labels) gate >> label;
+
+        std::string name;
+        gate >> name;
+
+        n_eq += name == "EQ";
+        n_eqw += name == "EQW";
+
+        if (name == "MAND") {
+            n_mand++;
+            REQUIRE(n_inputs == 2 * n_outputs);
+            for (uint64_t i = n_inputs; i < labels.size(); i++) {
+                REQUIRE(std::find(labels.begin(), labels.begin() + n_inputs, labels[i]) == labels.begin() + n_inputs);
+            }
+        }
+    }
+
+    REQUIRE(n_eq == 2);
+    REQUIRE(n_eqw == 32);
+    REQUIRE(n_mand > 0);
+    // > !SECTION - Test 1: Bristol Fashion gates.
+
+    // -------------------
+    // > SECTION - Test 2: Evaluate a Bristol Fashion circuit.
+    // -------------------
+    // The circuit should output the expected result, and have less gate lines than gates.
+    FashionTester tester;
+    tester.verbose(false);
+    tester.open("bristol_fashion_Arithmetic", "circuits/tests");
+
+    uint64_t total_gates = 0;
+    for (auto & level : tester.statistics()) {
+        total_gates += level.gates;
+    }
+    REQUIRE(n_lines < total_gates);
+
+    for (auto [a, b] : std::vector<std::pair<uint64_t, uint64_t>>{ {0, 0}, {1, 0xFFFFFFFF}, {300, 7}, {123456, 654321} }) {
+        std::vector<uint8_t> inputs;
+        push_bits(inputs, a, 32);
+        push_bits(inputs, b, 32);
+
+        REQUIRE(tester.evaluate(inputs)[0][0] == (((a + b) - (a ^ b)) & 0xFFFFFFFF));
+    }
+    // > !SECTION - Test 2: Evaluate a Bristol Fashion circuit.
+    // > !SECTION - Test suit "Bristol Fashion"
+}
+
+TEST_CASE("Wire Labels") {
+    // > SECTION - Test suit "Wire Labels"
+    //
+    // This test suit aims to test the circuits that exceed the wires supported by the wire labels (see label_t).
+    //
+    // Test suit index:
+    // > Test 1: Generate a circuit with too many wires
+    // > Test 2: Open a circuit with too many wires
+
+    // -------------------
+    // > SECTION - Test 1: Generate a circuit with too many wires.
+    // -------------------
+    // The wires counter is moved to the last supported label. The next gate still gets a label, but the one after should raise
+    // a runtime error exception instead of reusing the labels of the circuit.
+    {
+        BristolGeneratorTester generator("Labels", "circuits/tests");
+        generator.add_input_party(2);
+        generator.add_output_party(1);
+
+        Var in(2), out(1);
+        generator.add_input(in);
+        generator.add_output(out);
+        generator.start();
+
+        generator._counter_wires = gabe::bcgen::max_wires - 1;
+
+        Wire last;
+        REQUIRE_NOTHROW(generator.XOR(in[0], in[1], last));
+        REQUIRE(last.label == gabe::bcgen::max_wires - 1);
+        REQUIRE_THROWS_AS(generator.AND(in[0], last, out[0]), std::runtime_error);
+    }
+    // > !SECTION - Test 1: Generate a circuit with too many wires.
+
+    // -------------------
+    // > SECTION - Test 2: Open a circuit with too many wires.
+    // -------------------
+    // A circuit with 2^32 wires can only be opened with 64 bits labels. Otherwise, a runtime error exception should be
+    // raised instead of truncating the labels.
+    {
+        std::ofstream circuit("circuits/tests/Labels_Overflow.txt", std::ios::out | std::ios::trunc);
+        circuit << "1 4294967296\n1 2\n1 1\n\n2 1 0 1 4294967295 XOR\n";
+    }
+
+    BristolTester tester;
+    tester.verbose(false);
+    if (gabe::bcgen::max_wires < 4294967296) {
+        REQUIRE_THROWS_AS(tester.open("Labels_Overflow", "circuits/tests"), std::runtime_error);
+    }
+    // > !SECTION - Test 2: Open a circuit with too many wires.
+    // > !SECTION - Test suit "Wire Labels"
+}
+
+TEST_CASE("Labels Reuse") {
+    // > SECTION - Test suit "Labels Reuse"
+    //
+    // This test suit aims to test the circuits generated with the labels of dead wires reused.
+    //
+    // Test suit index:
+    // > Test 1: Circuits wires
+    // > Test 2: Evaluate circuits with reused labels
+
+    // -------------------
+    // > SECTION - Setup
+    // -------------------
+    // This section creates the same 32 bits arithmetic circuit with and without reused labels, in every format.
+    {
+        BristolGenerator bristol("Unique", "circuits/tests");
+        arithmetic_circuit(bristol);
+
+        BristolGenerator reused_bristol("Reused", "circuits/tests");
+        reused_bristol.reuse_labels(true);
+        arithmetic_circuit(reused_bristol);
+
+        LibscapiGenerator reused_libscapi("Reused", "circuits/tests");
+        reused_libscapi.reuse_labels(true);
+        arithmetic_circuit(reused_libscapi);
+
+        FashionGenerator reused_fashion("Reused", "circuits/tests");
+        reused_fashion.reuse_labels(true);
+        arithmetic_circuit(reused_fashion);
+
+        BinaryGenerator reused_binary("Reused", "circuits/tests", BinaryLayout::Varint);
+        reused_binary.reuse_labels(true);
+        arithmetic_circuit(reused_binary);
+    }
+
+    const std::vector<std::pair<uint64_t, uint64_t>> values = { {0, 0}, {1, 0xFFFFFFFF}, {300, 7}, {0xFFFFFFFF, 0xFFFFFFFF}, {123456, 654321} };
+    // > !SECTION - Setup
+
+    // -------------------
+    // > SECTION - Test 1: Circuits wires.
+    // -------------------
+    // Both circuits should have the same gates, but the circuit with reused labels should have much less wires. Its output
+    // wires should still be the last ones.
+    uint64_t unique_gates, unique_wires, reused_gates, reused_wires;
+    std::ifstream("circuits/tests/bristol_Unique.txt") >> unique_gates >> unique_wires;
+    std::ifstream("circuits/tests/bristol_Reused.txt") >> reused_gates >> reused_wires;
+
+    REQUIRE(reused_gates == unique_gates);
+    REQUIRE(reused_wires * 3 < unique_wires);
+    // > !SECTION - Test 1: Circuits wires.
+
+    // -------------------
+    // > SECTION - Test 2: Evaluate circuits with reused labels.
+    // -------------------
+    // All the circuits should output the expected result, with a single thread and with multiple threads.
+    auto check = [&](gabe::bcgen::CircuitTester& tester, const std::string& name) {
+        tester.verbose(false);
+        tester.open(name, "circuits/tests");
+
+        for (auto threads : {1, 4}) {
+            tester.threads(threads);
+
+            for (auto [a, b] : values) {
+                std::vector<uint8_t> inputs;
+                push_bits(inputs, a, 32);
+                push_bits(inputs, b, 32);
+
+                REQUIRE(tester.evaluate(inputs)[0][0] == (((a + b) - (a ^ b)) & 0xFFFFFFFF));
+            }
+        }
+    };
+
+    BristolTester bristol_tester;
+    check(bristol_tester, "bristol_Reused");
+
+    LibscapiTester libscapi_tester;
+    check(libscapi_tester, "libscapi_Reused");
+
+    FashionTester fashion_tester;
+    check(fashion_tester, "bristol_fashion_Reused");
+
+    BinaryTester binary_tester;
+    check(binary_tester, "binary_Reused");
+    // > !SECTION - Test 2: Evaluate circuits with reused labels.
+    // > !SECTION - Test suit "Labels Reuse"
+}
+
+TEST_CASE("Gates Scheduling") {
+    // > SECTION - Test suit "Gates Scheduling"
+    //
+    // This test suit aims to test the circuits generated with their gates scheduled.
+    //
+    // Test suit index:
+    // > Test 1: Reuse distances
+    // > Test 2: Evaluate scheduled circuits
+
+    // -------------------
+    // > SECTION - Setup
+    // -------------------
+    // This section creates the same 32 bits arithmetic circuit with scheduled gates, with and without reused labels, in every
+    // format.
+    std::vector<gabe::bcgen::ScheduleReport> reports;
+    {
+        BristolGenerator bristol("Scheduled", "circuits/tests");
+        bristol.schedule_gates(true);
+        arithmetic_circuit(bristol);
+        reports.push_back(bristol.schedule_report());
+
+        LibscapiGenerator libscapi("Scheduled", "circuits/tests");
+        libscapi.schedule_gates(true);
+        arithmetic_circuit(libscapi);
+        reports.push_back(libscapi.schedule_report());
+
+        FashionGenerator fashion("Scheduled", "circuits/tests");
+        fashion.schedule_gates(true);
+        arithmetic_circuit(fashion);
+        reports.push_back(fashion.schedule_report());
+
+        BinaryGenerator binary("Scheduled", "circuits/tests", BinaryLayout::Varint);
+        binary.schedule_gates(true);
+        arithmetic_circuit(binary);
+        reports.push_back(binary.schedule_report());
+
+        BristolGenerator reused_bristol("ScheduledReused", "circuits/tests");
+        reused_bristol.schedule_gates(true);
+        reused_bristol.reuse_labels(true);
+        arithmetic_circuit(reused_bristol);
+        reports.push_back(reused_bristol.schedule_report());
+
+        BinaryGenerator reused_binary("ScheduledReused", "circuits/tests", BinaryLayout::Varint);
+        reused_binary.schedule_gates(true);
+        reused_binary.reuse_labels(true);
+        arithmetic_circuit(reused_binary);
+        reports.push_back(reused_binary.schedule_report());
+    }
+
+    const std::vector<std::pair<uint64_t, uint64_t>> values = { {0, 0}, {1, 0xFFFFFFFF}, {300, 7}, {0xFFFFFFFF, 0xFFFFFFFF}, {123456, 654321} };
+    // > !SECTION - Setup
+
+    // -------------------
+    // > SECTION - Test 1: Reuse distances.
+    // -------------------
+    // The scheduling should never lengthen the mean reuse distance, and every format should report the same distances.
+    for (auto & report : reports) {
+        REQUIRE(report.before.mean > 0);
+        REQUIRE(report.after.mean <= report.before.mean);
+        REQUIRE(report.after.mean == reports[0].after.mean);
+        REQUIRE(report.after.max == reports[0].after.max);
+    }
+    // > !SECTION - Test 1: Reuse distances.
+
+    // -------------------
+    // > SECTION - Test 2: Evaluate scheduled circuits.
+    // -------------------
+    // All the circuits should output the expected result, with a single thread and with multiple threads.
+    auto check = [&](gabe::bcgen::CircuitTester& tester, const std::string& name) {
+        tester.verbose(false);
+        tester.open(name, "circuits/tests");
+
+        for (auto threads : {1, 4}) {
+            tester.threads(threads);
+
+            for (auto [a, b] : values) {
+                std::vector<uint8_t> inputs;
+                push_bits(inputs, a, 32);
+                push_bits(inputs, b, 32);
+
+                REQUIRE(tester.evaluate(inputs)[0][0] == (((a + b) - (a ^ b)) & 0xFFFFFFFF));
+            }
+        }
+    };
+
+    BristolTester bristol_tester;
+    check(bristol_tester, "bristol_Scheduled");
+
+    LibscapiTester libscapi_tester;
+    check(libscapi_tester, "libscapi_Scheduled");
+
+    FashionTester fashion_tester;
+    check(fashion_tester, "bristol_fashion_Scheduled");
+
+    BinaryTester binary_tester;
+    check(binary_tester, "binary_Scheduled");
+
+    BristolTester reused_bristol_tester;
+    check(reused_bristol_tester, "bristol_ScheduledReused");
+
+    BinaryTester reused_binary_tester;
+    check(reused_binary_tester, "binary_ScheduledReused");
+    // > !SECTION - Test 2: Evaluate scheduled circuits.
+    // > !SECTION - Test suit "Gates Scheduling"
+}
+
+TEST_CASE("Oblivious Permutation") {
+    // > SECTION - Test suit "Oblivious Permutation"
+    //
+    // This test suit aims to test the evaluation of a permutation network, whose control bits are computed by the party that
+    // knows the permutation.
+    //
+    // Test suit index:
+    // > Test 1: Evaluate every permutation
+
+    // -------------------
+    // > SECTION - Setup
+    // -------------------
+    // This section creates a Bristol circuit that permutes 6 variables of 8 bits (first input party) with the control bits of
+    // the second input party. Each output party is a permuted variable.
+    const uint64_t n_switches = gabe::bcgen::CircuitGenerator::permutation_network(6).size();
+    {
+        BristolGenerator bristol("Permutation", "circuits/tests");
+        bristol.add_input_party(6 * 8);
+        bristol.add_input_party(n_switches);
+
+        std::vector<Var> variables(6, Var(8));
+        Var control(n_switches);
+        for (auto & variable : variables) {
+            bristol.add_input(variable);
+        }
+        bristol.add_input(control);
+
+        std::vector<Var> outputs(6, Var(8));
+        for (auto & output : outputs) {
+            bristol.add_output_party(8);
+            bristol.add_output(output);
+        }
+
+        bristol.start();
+        bristol.permute(variables, control);
+        for (uint64_t i = 0; i < 6; i++) {
+            outputs[i] = variables[i];
+        }
+        bristol.stop();
+    }
+    // > !SECTION - Setup
+
+    // -------------------
+    // > SECTION - Test 1: Evaluate every permutation.
+    // -------------------
+    // The output party i should be the input variable at position i of the permutation.
+    BristolTester tester;
+    tester.verbose(false);
+    tester.open("bristol_Permutation", "circuits/tests");
+
+    const std::vector<uint64_t> values = { 11, 22, 33, 44, 55, 66 };
+    std::vector<uint64_t> permutation = { 0, 1, 2, 3, 4, 5 };
+    bool permuted = true;
+    do {
+        std::vector<uint8_t> inputs;
+        for (auto value : values) {
+            push_bits(inputs, value, 8);
+        }
+        for (auto bit : gabe::bcgen::CircuitGenerator::permutation_control_bits(permutation)) {
+            inputs.push_back(bit);
+        }
+
+        std::vector<std::vector<uint64_t>> outputs = tester.evaluate(inputs);
+        for (uint64_t i = 0; i < 6; i++) {
+            permuted = permuted && outputs[i][0] == values[permutation[i]];
+        }
+    } while (std::next_permutation(permutation.begin(), permutation.end()));
+
+    REQUIRE(permuted);
+    // > !SECTION - Test 1: Evaluate every permutation.
+    // > !SECTION - Test suit "Oblivious Permutation"
+}
@@ -1,5 +1,7 @@
 #include <bcgen/CircuitGenerator.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <utility>
 
 // Don't do this :)
 using Wire = gabe::bcgen::Wire;
@@ -23,13 +25,155 @@ TEST_CASE( "Wire" ) {
 }
 
 TEST_CASE( "Variable" ) {
-    // Wire is just a struct with a single value. It should not require a test.
-    // Anyhow... Test cases:
-    // 1. Default wire construction
-    // 2. Wire construction with label attribution
+    // Test cases:
+    // 1. Small and big variables construction
+    // 2. Variable copy
+    // 3. Variable move
+    // 4. Assignment of variables with different sizes
+
+    SECTION( "Small and big variables construction" ) {
+        Var small(8), big(Var::inline_size + 1);
+        REQUIRE(small.size() == 8);
+        REQUIRE(big.size() == Var::inline_size + 1);
+
+        for (auto & wire : big) {
+            REQUIRE(wire.label == 0);
+        }
+    }
+
+    SECTION( "Variable copy" ) {
+        Var var(100);
+        for (uint64_t i = 0; i < var.size(); i++) { var[i].label = i; }
+
+        Var copy(var);
+        copy[0].label = 42;
+        REQUIRE(copy[99].label == 99);
+        REQUIRE(var[0].label == 0);
+    }
+
+    SECTION( "Variable move" ) {
+        Var var(100);
+        for (uint64_t i = 0; i < var.size(); i++) { var[i].label = i; }
+
+        Var moved(std::move(var));
+        REQUIRE(moved.size() == 100);
+        REQUIRE(moved[99].label == 99);
+
+        Var other(100);
+        other = std::move(moved);
+        REQUIRE(other[50].label == 50);
+    }
+
+    SECTION( "Assignment of variables with different sizes" ) {
+        Var var_a(8), var_b(4);
+        REQUIRE_THROWS_AS(var_a = var_b, std::runtime_error);
+    }
+}
+
+TEST_CASE( "Variable View" ) {
+    // Test cases:
+    // 1. Slice of a variable
+    // 2. Reversed variable
+    // 3. Views copies
+    // 4. Concatenation of variables
+    // 5. Slice out of the variable
+
+    Var var(8);
+    for (uint64_t i = 0; i < var.size(); i++) { var[i].label = i; }
+
+    SECTION( "Slice of a variable" ) {
+        gabe::bcgen::VariableView view = var.slice(2, 4);
+        REQUIRE(view.size() == 4);
+        REQUIRE(view[0].label == 2);
+        REQUIRE(view[3].label == 5);
+
+        // The view modifies the variable wires
+        view[1].label = 42;
+        REQUIRE(var[3].label == 42);
+    }
 
-    // SECTION( "Default variable construction" ) {
-    //     Var var;
-    //     // REQUIRE(wire.label == 0);
-    // }
+    SECTION( "Reversed variable" ) {
+        gabe::bcgen::VariableView view = var.reversed();
+        REQUIRE(view[0].label == 7);
+        REQUIRE(view[7].label == 0);
+        REQUIRE(view.slice(1, 2)[1].label == 5);
+
+        uint64_t expected = 7;
+        for (auto & wire : view) {
+            REQUIRE(wire.label == expected--);
+        }
+
+        // Assigning a variable to its own reversed view reverses it
+        var = var.reversed();
+        REQUIRE(var[0].label == 7);
+        REQUIRE(var[7].label == 0);
+    }
+
+    SECTION( "Views copies" ) {
+        // Copying a view into a variable copies the wires, copying it into a view views the same wires
+        Var copy = var.slice(0, 4);
+        gabe::bcgen::VariableView view = var.slice(0, 4);
+        gabe::bcgen::VariableView view_copy = view;
+        copy[0].label = 42;
+        view_copy[1].label = 43;
+        REQUIRE(var[0].label == 0);
+        REQUIRE(var[1].label == 43);
+
+        // Assigning into a view modifies the viewed wires
+        var.slice(4, 4) = var.slice(0, 4);
+        REQUIRE(var[5].label == 43);
+    }
+
+    SECTION( "Concatenation of variables" ) {
+        Var concatenation = Var::concatenate(var.slice(0, 2), var.slice(6, 2));
+        REQUIRE(concatenation.size() == 4);
+        REQUIRE(concatenation[1].label == 1);
+        REQUIRE(concatenation[2].label == 6);
+    }
+
+    SECTION( "Slice out of the variable" ) {
+        REQUIRE_THROWS_AS(var.slice(6, 3), std::runtime_error);
+    }
+}
+
+TEST_CASE( "Fixed Point" ) {
+    // Test cases:
+    // 1. Fixed point formats
+    // 2. Encoding and decoding of values
+    // 3. Assignment of variables with different formats
+
+    using FixedPoint = gabe::bcgen::FixedPoint;
+
+    SECTION( "Fixed point formats" ) {
+        FixedPoint fixed(16, 8);
+        REQUIRE(fixed.size() == 24);
+        REQUIRE(fixed.integer_bits() == 16);
+        REQUIRE(fixed.fraction_bits() == 8);
+        REQUIRE_THROWS_AS(FixedPoint(0, 8), std::runtime_error);
+    }
+
+    SECTION( "Encoding and decoding of values" ) {
+        FixedPoint fixed(4, 4);
+        REQUIRE(fixed.encode(1.5) == 0x18);
+        REQUIRE(fixed.encode(-1.5) == 0xE8);
+        REQUIRE(fixed.encode(0.03125) == 0x00);
+        REQUIRE(fixed.encode(0.09375) == 0x02);
+        REQUIRE(fixed.decode(0xE8) == -1.5);
+
+        // Values out of the range are saturated
+        REQUIRE(fixed.encode(100) == 0x7F);
+        REQUIRE(fixed.encode(-100) == 0x80);
+
+        FixedPoint wide(32, 32);
+        REQUIRE(wide.decode(wide.encode(-12345.5)) == -12345.5);
+        REQUIRE_THROWS_AS(FixedPoint(33, 32).encode(1), std::runtime_error);
+    }
+
+    SECTION( "Assignment of variables with different formats" ) {
+        FixedPoint fixed_a(4, 4), fixed_b(4, 4), fixed_c(2, 6);
+        fixed_b[0].label = 7;
+        fixed_a = fixed_b;
+        REQUIRE(fixed_a[0].label == 7);
+        REQUIRE_THROWS_AS(fixed_a = fixed_c, std::runtime_error);
+    }
 }